@@ -218,6 +218,13 @@ DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 // Backdoor to get the number of lazy clears for testing
 DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
+// Backdoor to get the number of command blocks allocated from the heap for testing
+DAWN_NATIVE_EXPORT uint64_t GetCommandBlockAllocationCountForTesting(WGPUDevice device);
+
+// Backdoor to get the number of pipeline barrier commands recorded for testing. Only counted by
+// backends with explicit barriers.
+DAWN_NATIVE_EXPORT uint64_t GetPipelineBarrierCountForTesting(WGPUDevice device);
+
 //  Query if texture has been initialized
 DAWN_NATIVE_EXPORT bool IsTextureSubresourceInitialized(
     WGPUTexture texture,
@@ -351,6 +358,24 @@ struct DAWN_NATIVE_EXPORT AllocatorMemoryInfo {
 };
 DAWN_NATIVE_EXPORT AllocatorMemoryInfo GetAllocatorMemoryInfo(WGPUDevice device);
 
+// Statistics of the staging memory used to upload data for Queue::WriteBuffer, WriteTexture and
+// internal uploads. Counters are cumulative over the lifetime of the device.
+struct DAWN_NATIVE_EXPORT UploadMemoryInfo {
+    // Total bytes reserved for uploads.
+    uint64_t uploadedBytes = 0;
+    // Number of uploads that wrapped around to the front of a staging ring buffer.
+    uint64_t ringBufferWrapCount = 0;
+    // Number of uploads too large for the ring buffers.
+    uint64_t largeUploadCount = 0;
+    // Number of large uploads that reused a pooled staging buffer.
+    uint64_t largeUploadReuseCount = 0;
+    // Size of the ring buffers that are currently being created.
+    uint64_t ringBufferSize = 0;
+    // Total size of the staging buffers currently held.
+    uint64_t stagingMemorySize = 0;
+};
+DAWN_NATIVE_EXPORT UploadMemoryInfo GetUploadMemoryInfo(WGPUDevice device);
+
 // Free any unused GPU memory like staging buffers, cached resources, etc. Returns true if there are
 // still objects to delete and ReduceMemoryUsage() should be run again after a short delay to allow
 // submitted work to complete.
@@ -112,6 +112,12 @@ class DAWN_PLATFORM_EXPORT JobHandle {
 using PostWorkerTaskCallback = void (*)(void* userdata);
 using PostWorkerJobCallback = JobStatus (*)(void* userdata);
 
+// Worker tasks with a higher priority are started before the pending tasks with a lower priority.
+enum class TaskPriority {
+    UserVisible,  // Work the application is waiting on, like asynchronous pipeline creation.
+    Background,   // Work nothing is waiting on, like storing blobs in the cache.
+};
+
 class DAWN_PLATFORM_EXPORT WorkerTaskPool {
   public:
     WorkerTaskPool() = default;
@@ -127,6 +133,12 @@ class DAWN_PLATFORM_EXPORT WorkerTaskPool {
     virtual std::unique_ptr<WaitableEvent> PostWorkerTask(PostWorkerTaskCallback,
                                                           void* userdata) = 0;
 
+    // Posts a task with the given priority. The default implementation ignores the priority.
+    virtual std::unique_ptr<WaitableEvent> PostWorkerTaskWithPriority(
+        PostWorkerTaskCallback callback,
+        void* userdata,
+        TaskPriority priority);
+
     // This will start up to a worker which calls |cb| with |userdata| when scheduling permits while
     // |cb| returns |Continue|. In general, |cb| should periodically yield regardless of whether it
     // completed its work in order to allow for cancellation or reprioritization when appropriate.
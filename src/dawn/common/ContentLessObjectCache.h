@@ -28,12 +28,15 @@
 #ifndef SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
 #define SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
 
+#include <array>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <utility>
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/container/inlined_vector.h"
+#include "absl/hash/hash.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 #include "src/dawn/common/ContentLessObjectCacheable.h"
 #include "src/dawn/common/Ref.h"
@@ -87,8 +90,6 @@ struct ContentLessObjectCacheKeyFuncs {
     struct EqualityFunc {
         using is_transparent = void;
 
-        explicit EqualityFunc(ContentLessObjectCache<RefCountedT>* cache) : mCache(cache) {}
-
         bool operator()(const WeakRefAndHash<RefCountedT>& a,
                         const WeakRefAndHash<RefCountedT>& b) const {
             Ref<RefCountedT> aRef = a.weakRef.Promote();
@@ -96,10 +97,10 @@ struct ContentLessObjectCacheKeyFuncs {
 
             bool equal = (aRef && bRef && BaseEqualityFunc()(aRef.Get(), bRef.Get()));
             if (aRef) {
-                mCache->TrackTemporaryRef(std::move(aRef));
+                ContentLessObjectCache<RefCountedT>::TrackTemporaryRef(std::move(aRef));
             }
             if (bRef) {
-                mCache->TrackTemporaryRef(std::move(bRef));
+                ContentLessObjectCache<RefCountedT>::TrackTemporaryRef(std::move(bRef));
             }
             return equal;
         }
@@ -119,17 +120,18 @@ struct ContentLessObjectCacheKeyFuncs {
             Ref<RefCountedT> aRef = a.weakRef.Promote();
             bool equal = aRef && BaseEqualityFunc()(aRef.Get(), b);
             if (aRef) {
-                mCache->TrackTemporaryRef(std::move(aRef));
+                ContentLessObjectCache<RefCountedT>::TrackTemporaryRef(std::move(aRef));
             }
             return equal;
         }
-
-        raw_ptr<ContentLessObjectCache<RefCountedT>> mCache = nullptr;
     };
 };
 
 }  // namespace detail
 
+// The cache is split into shards, selected by the hash of the objects, that each have their own
+// lock so that operations on unrelated objects don't contend. Lookups only take a shared lock on
+// their shard, which lets threads deduplicating against live objects proceed in parallel.
 template <typename RefCountedT>
 class ContentLessObjectCache {
     static_assert(std::is_base_of_v<detail::ContentLessObjectCacheableBase, RefCountedT>,
@@ -140,10 +142,7 @@ class ContentLessObjectCache {
     using CacheKeyFuncs = detail::ContentLessObjectCacheKeyFuncs<RefCountedT>;
 
   public:
-    ContentLessObjectCache()
-        : mCache(/*reservation_size=*/0,
-                 typename CacheKeyFuncs::HashFunc(),
-                 typename CacheKeyFuncs::EqualityFunc(this)) {}
+    ContentLessObjectCache() = default;
 
     // The dtor asserts that the cache is empty to aid in finding pointer leaks that can be
     // possible if the RefCountedT doesn't correctly implement the DeleteThis function to Uncache.
@@ -153,47 +152,55 @@ class ContentLessObjectCache {
     // inserted or existing object, and the second is a bool that is true if we inserted
     // `object` and false otherwise.
     std::pair<Ref<RefCountedT>, bool> Insert(RefCountedT* obj) {
-        return WithLockAndCleanup([&]() -> std::pair<Ref<RefCountedT>, bool> {
-            auto [it, inserted] = mCache.emplace(obj);
-            if (inserted) {
-                obj->mCache = this;
-                return {obj, inserted};
-            } else {
-                // Try to promote the found WeakRef to a Ref. If promotion fails, remove the old Key
-                // and insert this one.
-                Ref<RefCountedT> ref = it->weakRef.Promote();
-                if (ref != nullptr) {
-                    return {std::move(ref), false};
-                } else {
-                    mCache.erase(it);
-                    auto result = mCache.emplace(obj);
-                    DAWN_ASSERT(result.second);
+        Shard& shard = GetShard(obj);
+
+        // Most insertions of an equivalent object hit a live cached object. Check for one while
+        // only sharing the lock before falling back to the exclusive insertion path.
+        Ref<RefCountedT> existing = WithLockAndCleanup<std::shared_lock<std::shared_mutex>>(
+            shard, [&]() -> Ref<RefCountedT> { return FindLocked(shard, obj); });
+        if (existing != nullptr) {
+            return {std::move(existing), false};
+        }
+
+        return WithLockAndCleanup<std::unique_lock<std::shared_mutex>>(
+            shard, [&]() -> std::pair<Ref<RefCountedT>, bool> {
+                auto [it, inserted] = shard.set.emplace(obj);
+                if (inserted) {
                     obj->mCache = this;
-                    return {obj, true};
+                    return {obj, inserted};
+                } else {
+                    // Try to promote the found WeakRef to a Ref. If promotion fails, remove the old
+                    // Key and insert this one.
+                    Ref<RefCountedT> ref = it->weakRef.Promote();
+                    if (ref != nullptr) {
+                        return {std::move(ref), false};
+                    } else {
+                        shard.set.erase(it);
+                        auto result = shard.set.emplace(obj);
+                        DAWN_ASSERT(result.second);
+                        obj->mCache = this;
+                        return {obj, true};
+                    }
                 }
-            }
-        });
+            });
     }
 
     // Returns a valid Ref<T> if we can Promote the underlying WeakRef. Returns nullptr otherwise.
     Ref<RefCountedT> Find(RefCountedT* blueprint) {
-        return WithLockAndCleanup([&]() -> Ref<RefCountedT> {
-            auto it = mCache.find(blueprint);
-            if (it != mCache.end()) {
-                return it->weakRef.Promote();
-            }
-            return nullptr;
-        });
+        Shard& shard = GetShard(blueprint);
+        return WithLockAndCleanup<std::shared_lock<std::shared_mutex>>(
+            shard, [&]() -> Ref<RefCountedT> { return FindLocked(shard, blueprint); });
     }
 
     // Erases the object from the cache if it exists and are pointer equal. Otherwise does not
     // modify the cache. Since Erase never Promotes any WeakRefs, it does not need to be wrapped by
     // a WithLockAndCleanup, and a simple lock is enough.
     void Erase(RefCountedT* obj) {
+        Shard& shard = GetShard(obj);
         size_t count;
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            count = mCache.erase(detail::ForErase<RefCountedT>(obj));
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            count = shard.set.erase(detail::ForErase<RefCountedT>(obj));
         }
         if (count == 0) {
             return;
@@ -203,43 +210,76 @@ class ContentLessObjectCache {
 
     // Returns true iff the cache is empty.
     bool Empty() {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mCache.empty();
+        for (Shard& shard : mShards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            if (!shard.set.empty()) {
+                return false;
+            }
+        }
+        return true;
     }
 
   private:
     friend struct CacheKeyFuncs::EqualityFunc;
 
-    void TrackTemporaryRef(Ref<RefCountedT> ref) { mTemporaryRefs->push_back(std::move(ref)); }
-    template <typename F>
-    auto WithLockAndCleanup(F func) {
+    static constexpr size_t kNumShards = 16;
+
+    using Set = absl::flat_hash_set<detail::WeakRefAndHash<RefCountedT>,
+                                    typename CacheKeyFuncs::HashFunc,
+                                    typename CacheKeyFuncs::EqualityFunc>;
+
+    struct Shard {
+        std::shared_mutex mutex;
+        Set set;
+    };
+
+    Shard& GetShard(const RefCountedT* obj) {
+        // Mix the object's hash since the objects' hash functions don't necessarily spread their low
+        // bits well.
+        size_t hash = typename CacheKeyFuncs::HashFunc()(obj);
+        return mShards[absl::Hash<size_t>()(hash) % kNumShards];
+    }
+
+    // Must be called inside WithLockAndCleanup with at least a shared lock on `shard`.
+    Ref<RefCountedT> FindLocked(const Shard& shard, RefCountedT* blueprint) const {
+        auto it = shard.set.find(blueprint);
+        if (it != shard.set.end()) {
+            return it->weakRef.Promote();
+        }
+        return nullptr;
+    }
+
+    static void TrackTemporaryRef(Ref<RefCountedT> ref) {
+        DAWN_ASSERT(tTemporaryRefs != nullptr);
+        tTemporaryRefs->push_back(std::move(ref));
+    }
+
+    template <typename Lock, typename F>
+    auto WithLockAndCleanup(Shard& shard, F func) {
         using RetType = decltype(func());
         RetType result;
 
         // Creates and owns a temporary InlinedVector that we point to internally to track Refs.
         absl::InlinedVector<Ref<RefCountedT>, 4> temps;
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mTemporaryRefs = &temps;
+            Lock lock(shard.mutex);
+            tTemporaryRefs = &temps;
             result = func();
-            mTemporaryRefs = nullptr;
+            tTemporaryRefs = nullptr;
         }
         return result;
     }
 
-    std::mutex mMutex;
-    absl::flat_hash_set<detail::WeakRefAndHash<RefCountedT>,
-                        typename CacheKeyFuncs::HashFunc,
-                        typename CacheKeyFuncs::EqualityFunc>
-        mCache;
+    std::array<Shard, kNumShards> mShards;
 
-    // The cache has a pointer to a InlinedVector of temporary Refs that are by-products of Promotes
-    // inside the EqualityFunc. These Refs need to outlive the EqualityFunc calls because otherwise,
-    // they could be the last living Ref of the object resulting in a re-entrant Erase call that
-    // deadlocks on the mutex.
+    // The thread has a pointer to a InlinedVector of temporary Refs that are by-products of
+    // Promotes inside the EqualityFunc. These Refs need to outlive the EqualityFunc calls because
+    // otherwise, they could be the last living Ref of the object resulting in a re-entrant Erase
+    // call that deadlocks on the mutex. The pointer is per-thread as lookups from multiple threads
+    // can run concurrently under a shared lock.
     // Absl should make fewer than 1 equality checks per set operation, so a InlinedVector of length
     // 4 should be sufficient for most cases. See dawn:1993 for more details.
-    raw_ptr<absl::InlinedVector<Ref<RefCountedT>, 4>> mTemporaryRefs = nullptr;
+    static inline thread_local absl::InlinedVector<Ref<RefCountedT>, 4>* tTemporaryRefs = nullptr;
 };
 
 }  // namespace dawn
@@ -29,10 +29,24 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "src/dawn/common/Math.h"
 
 namespace dawn {
+namespace {
+
+std::atomic<uint64_t> sNextAllocatorId = 1;
+
+// The thread cache found by the last lookup on this thread, so that consecutive allocations from
+// the same allocator don't need to lock the map of thread caches.
+struct LastThreadCache {
+    uint64_t allocatorId = 0;
+    void* cache = nullptr;
+};
+thread_local LastThreadCache tLastThreadCache;
+
+}  // anonymous namespace
 
 // static
 MemoryBlockAllocator::FreeBlock* MemoryBlockAllocator::FreeBlock::FromHeapArray(
@@ -60,7 +74,9 @@ MemoryBlockAllocator::FreeBlock::FreeBlock(uint64_t serial, HeapArray<std::byte>
 }
 
 MemoryBlockAllocator::MemoryBlockAllocator(size_t blockSize, uint64_t keepAliveWindow)
-    : mBlockSize(std::max(blockSize, sizeof(FreeBlock))), mKeepAliveWindow(keepAliveWindow) {}
+    : mBlockSize(std::max(blockSize, sizeof(FreeBlock))),
+      mKeepAliveWindow(keepAliveWindow),
+      mId(sNextAllocatorId.fetch_add(1, std::memory_order_relaxed)) {}
 
 MemoryBlockAllocator::~MemoryBlockAllocator() {
     TrimMemory();
@@ -70,22 +86,58 @@ size_t MemoryBlockAllocator::GetBlockSize() const {
     return mBlockSize;
 }
 
+uint64_t MemoryBlockAllocator::GetHeapAllocationCount() const {
+    return mHeapAllocationCount.load(std::memory_order_relaxed);
+}
+
+MutexProtected<MemoryBlockAllocator::ThreadCache>* MemoryBlockAllocator::GetThreadCache() {
+    if (tLastThreadCache.allocatorId == mId) {
+        return static_cast<MutexProtected<ThreadCache>*>(tLastThreadCache.cache);
+    }
+
+    MutexProtected<ThreadCache>* cache = mThreadCaches.Use([&](auto threadCaches) {
+        std::unique_ptr<MutexProtected<ThreadCache>>& entry = (*threadCaches)[GetThreadUniqueId()];
+        if (entry == nullptr) {
+            entry = std::make_unique<MutexProtected<ThreadCache>>();
+        }
+        return entry.get();
+    });
+    tLastThreadCache = {mId, cache};
+    return cache;
+}
+
 HeapArray<std::byte> MemoryBlockAllocator::Allocate(size_t minimumSize) {
     if (minimumSize > mBlockSize) {
+        mHeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
         // SAFETY: caller is responsible for initializing the memory
         return DAWN_UNSAFE_BUFFERS(HeapArray<std::byte>::Uninit(minimumSize));
     }
 
-    HeapArray<std::byte> block = mFreeList.Use([&](auto freeList) -> HeapArray<std::byte> {
+    HeapArray<std::byte> block = GetThreadCache()->Use([&](auto cache) -> HeapArray<std::byte> {
+        if (cache->freeList.empty()) {
+            // The thread allocates more blocks than it keeps around, let it keep more of the
+            // blocks it returns.
+            cache->capacity = std::min(cache->capacity + 1, kMaxThreadCacheCapacity);
+            return {};
+        }
+        cache->size--;
+        return cache->freeList.tail()->value()->UnlinkAndAcquireHeapArray();
+    });
+    if (!block.empty()) {
+        return block;
+    }
+
+    block = mFreeList.Use([&](auto freeList) -> HeapArray<std::byte> {
         if (freeList->empty()) {
             return {};
         }
         return freeList->tail()->value()->UnlinkAndAcquireHeapArray();
     });
-
     if (!block.empty()) {
         return block;
     }
+
+    mHeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
     // SAFETY: caller is responsible for initializing the memory
     return DAWN_UNSAFE_BUFFERS(HeapArray<std::byte>::Uninit(mBlockSize));
 }
@@ -94,54 +146,134 @@ void MemoryBlockAllocator::Return(HeapArray<std::byte>&& block) {
     if (block.size() != mBlockSize) {
         return;
     }
-    mFreeList.Use([&](auto freeList) {
-        freeList->Append(FreeBlock::FromHeapArray(mTickSerial, std::move(block)));
+    uint64_t serial = mTickSerial.load(std::memory_order_relaxed);
+    bool cached = GetThreadCache()->Use([&](auto cache) {
+        if (cache->size >= cache->capacity) {
+            return false;
+        }
+        cache->freeList.Append(FreeBlock::FromHeapArray(serial, std::move(block)));
+        cache->size++;
+        return true;
     });
+    if (!cached) {
+        mFreeList.Use([&](auto freeList) {
+            freeList->Append(FreeBlock::FromHeapArray(serial, std::move(block)));
+        });
+    }
 }
 
 void MemoryBlockAllocator::Return(std::vector<HeapArray<std::byte>>&& blocks) {
-    mFreeList.Use([&](auto freeList) {
+    // Only exactly mBlockSize blocks are pooled for reuse. Blocks of any other size are freed
+    // below when `blocks` is cleared.
+    size_t pooledCount = std::count_if(blocks.begin(), blocks.end(), [&](const auto& block) {
+        return block.size() == mBlockSize;
+    });
+    uint64_t serial = mTickSerial.load(std::memory_order_relaxed);
+
+    // The last blocks of the batch go to the thread's free list so that, like in the shared free
+    // list, the most recently returned blocks are the first to be reused.
+    size_t overflowCount = GetThreadCache()->Use([&](auto cache) {
+        size_t room = cache->capacity - std::min(cache->size, cache->capacity);
+        size_t overflow = pooledCount - std::min(room, pooledCount);
+        size_t skipped = 0;
         for (HeapArray<std::byte>& block : blocks) {
             if (block.size() != mBlockSize) {
-                // Only exactly mBlockSize blocks are pooled for reuse. Blocks of any other size
-                // are freed below when `blocks` is cleared.
                 continue;
             }
-            freeList->Append(FreeBlock::FromHeapArray(mTickSerial, std::move(block)));
+            if (skipped < overflow) {
+                skipped++;
+                continue;
+            }
+            cache->freeList.Append(FreeBlock::FromHeapArray(serial, std::move(block)));
+            cache->size++;
         }
+        return overflow;
     });
+
+    if (overflowCount > 0) {
+        // Blocks moved into the thread's free list are left empty and skipped here.
+        mFreeList.Use([&](auto freeList) {
+            for (HeapArray<std::byte>& block : blocks) {
+                if (block.size() != mBlockSize) {
+                    continue;
+                }
+                freeList->Append(FreeBlock::FromHeapArray(serial, std::move(block)));
+            }
+        });
+    }
     blocks.clear();
 }
 
+size_t MemoryBlockAllocator::EvictColdBlocks(LinkedList<FreeBlock>* freeList,
+                                             uint64_t tickSerial) const {
+    size_t count = 0;
+    for (LinkNode<FreeBlock>* node : *freeList) {
+        FreeBlock* fb = node->value();
+        if (fb->GetLastKnownSerial() + mKeepAliveWindow > tickSerial) {
+            break;
+        }
+        fb->UnlinkAndAcquireHeapArray();
+        count++;
+    }
+    return count;
+}
+
+// static
+size_t MemoryBlockAllocator::FreeBlocks(LinkedList<FreeBlock>* freeList) {
+    size_t count = 0;
+    for (LinkNode<FreeBlock>* node : *freeList) {
+        node->value()->UnlinkAndAcquireHeapArray();
+        count++;
+    }
+    return count;
+}
+
 void MemoryBlockAllocator::Tick() {
-    mFreeList.Use([&](auto freeList) {
-        mTickSerial++;
-        for (LinkNode<FreeBlock>* node : *freeList) {
-            FreeBlock* fb = node->value();
-            if (fb->GetLastKnownSerial() + mKeepAliveWindow > mTickSerial) {
-                break;
+    uint64_t tickSerial = mTickSerial.fetch_add(1, std::memory_order_relaxed) + 1;
+    mFreeList.Use([&](auto freeList) { EvictColdBlocks(&*freeList, tickSerial); });
+
+    mThreadCaches.Use([&](auto threadCaches) {
+        for (auto it = threadCaches->begin(); it != threadCaches->end();) {
+            auto current = it++;
+            // The cache of an exited thread can't be used anymore, reclaim it entirely.
+            if (!IsThreadAlive(current->first)) {
+                current->second->Use([&](auto cache) { FreeBlocks(&cache->freeList); });
+                threadCaches->erase(current);
+                continue;
             }
-            fb->UnlinkAndAcquireHeapArray();
+            current->second->Use([&](auto cache) {
+                cache->size -= EvictColdBlocks(&cache->freeList, tickSerial);
+            });
         }
     });
 }
 
 void MemoryBlockAllocator::TrimMemory() {
-    mFreeList.Use([&](auto freeList) {
-        for (LinkNode<FreeBlock>* node : *freeList) {
-            node->value()->UnlinkAndAcquireHeapArray();
+    mFreeList.Use([&](auto freeList) { FreeBlocks(&*freeList); });
+    mThreadCaches.Use([&](auto threadCaches) {
+        for (auto& [threadId, threadCache] : *threadCaches) {
+            threadCache->Use([&](auto cache) {
+                FreeBlocks(&cache->freeList);
+                cache->size = 0;
+            });
         }
     });
 }
 
 size_t MemoryBlockAllocator::GetRecycledBlockCountForTesting() {
-    return mFreeList.Use([&](auto freeList) {
+    size_t total = mFreeList.Use([&](auto freeList) {
         size_t count = 0;
         for ([[maybe_unused]] LinkNode<FreeBlock>* node : *freeList) {
             count++;
         }
         return count;
     });
+    mThreadCaches.Use([&](auto threadCaches) {
+        for (auto& [threadId, threadCache] : *threadCaches) {
+            total += threadCache->Use([&](auto cache) { return cache->size; });
+        }
+    });
+    return total;
 }
 
 }  // namespace dawn
@@ -28,12 +28,16 @@
 #ifndef SRC_DAWN_COMMON_MEMORYBLOCKALLOCATOR_H_
 #define SRC_DAWN_COMMON_MEMORYBLOCKALLOCATOR_H_
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/dawn/common/LinkedList.h"
 #include "src/dawn/common/MutexProtected.h"
+#include "src/dawn/common/ThreadLocal.h"
 #include "src/utils/heap_array.h"
 #include "src/utils/non_copyable.h"
 #include "src/utils/non_movable.h"
@@ -55,6 +59,13 @@ namespace dawn {
 // (`Append()`) and popping from the tail provides LIFO / MRU allocation order so that returned
 // blocks remain warm in CPU cache. Since new nodes are always appended at the tail, the oldest
 // blocks remain at the head for early-terminating eviction in Tick().
+//
+// Returned blocks are first kept in a free list owned by the returning thread, and allocations
+// are first served from the calling thread's list. A thread that both records and releases
+// commands (the usual frame loop) then recycles its own blocks without touching the shared free
+// list. The per-thread lists have their own mutex, which is only contended by Tick() and
+// TrimMemory(). Their capacity adapts to how many blocks the thread allocates; returned blocks
+// that don't fit overflow into the shared free list, which every thread falls back to.
 class MemoryBlockAllocator : public dawn::NonCopyable {
   public:
     // Sized slightly below 16 KiB (16384 bytes) so that heap allocator bookkeeping
@@ -74,6 +85,10 @@ class MemoryBlockAllocator : public dawn::NonCopyable {
     size_t GetRecycledBlockCountForTesting();
     size_t GetBlockSize() const;
 
+    // Returns the number of blocks that had to be allocated from the heap since creation, either
+    // because no recycled block was available or because they were larger than the block size.
+    uint64_t GetHeapAllocationCount() const;
+
   private:
     // A FreeBlock is placement-new'd into the HeapArray it describes, so that recycling a block
     // requires no separate node allocation.
@@ -94,10 +109,36 @@ class MemoryBlockAllocator : public dawn::NonCopyable {
         HeapArray<std::byte> mSelfBlock;
     };
 
+    // The capacity of each thread's free list, in blocks. It starts at the minimum and grows
+    // every time the thread has to allocate outside of its free list, so that it settles on the
+    // number of blocks the thread records between releasing them.
+    static constexpr size_t kMinThreadCacheCapacity = 4;
+    static constexpr size_t kMaxThreadCacheCapacity = 256;
+
+    struct ThreadCache {
+        LinkedList<FreeBlock> freeList;
+        size_t size = 0;
+        size_t capacity = kMinThreadCacheCapacity;
+    };
+    using ThreadCacheMap =
+        absl::flat_hash_map<ThreadUniqueId, std::unique_ptr<MutexProtected<ThreadCache>>>;
+
+    MutexProtected<ThreadCache>* GetThreadCache();
+
+    // Free the blocks that exceeded the keep alive window / all the blocks of `freeList`, and
+    // return how many were freed.
+    size_t EvictColdBlocks(LinkedList<FreeBlock>* freeList, uint64_t tickSerial) const;
+    static size_t FreeBlocks(LinkedList<FreeBlock>* freeList);
+
     const size_t mBlockSize;
     const uint64_t mKeepAliveWindow;
+    // Unique among all allocators so that the thread-local lookup of the current thread's cache
+    // can't match a destroyed allocator that had the same address.
+    const uint64_t mId;
     MutexProtected<LinkedList<FreeBlock>> mFreeList;
-    uint64_t mTickSerial = 0;
+    MutexProtected<ThreadCacheMap> mThreadCaches;
+    std::atomic<uint64_t> mTickSerial = 0;
+    std::atomic<uint64_t> mHeapAllocationCount = 0;
 };
 
 }  // namespace dawn
@@ -144,7 +144,8 @@ AsyncTaskManager::~AsyncTaskManager() {
 void AsyncTaskManager::PostConstructedTask(Ref<AsyncTask> asyncTask) {
     // Insert the new task and send it off to the workpool to have it completed.
     mTasks.Use([&asyncTask](auto tasks) { tasks->emplace(asyncTask); });
-    mWorkerTaskPool->PostWorkerTask(RunTask, asyncTask.Get());
+    mWorkerTaskPool->PostWorkerTaskWithPriority(RunTask, asyncTask.Get(),
+                                                platform::TaskPriority::UserVisible);
 }
 
 void AsyncTaskManager::WaitAllPendingTasks() {
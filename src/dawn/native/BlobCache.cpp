@@ -96,23 +96,197 @@ ResultOrError<Blob> CheckAndUnpackHashPrefixedPayload(Blob&& blobWithHash) {
 
 }  // namespace detail
 
-BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc, bool enableHashValidation)
+namespace {
+
+std::string_view KeyView(std::span<const std::byte> key) {
+    return DAWN_UNSAFE_TODO(
+        std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+}
+
+Blob CreateBlobFromPayload(const std::vector<std::byte>& payload) {
+    Blob blob = Blob::Create(payload.size());
+    std::ranges::copy(payload, blob.Data().begin());
+    return blob;
+}
+
+}  // anonymous namespace
+
+BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc,
+                     bool enableHashValidation,
+                     size_t memoryBudget)
     : mHashValidation(enableHashValidation),
       mLoadCallbackInfo(desc.dawnLoadCacheDataCallbackInfo),
-      mStoreCallbackInfo(desc.dawnStoreCacheDataCallbackInfo) {}
+      mStoreCallbackInfo(desc.dawnStoreCacheDataCallbackInfo),
+      // Blobs can only be found again if the embedder can load them. Don't keep them in memory
+      // otherwise, so that caching can still be disabled by removing the callbacks.
+      mMemoryBudget(mLoadCallbackInfo.callback != nullptr ? memoryBudget : 0) {}
+
+BlobCache::~BlobCache() {
+    // The queued stores must be handed to the embedder while its callbacks are still valid, and
+    // the pool's task must not run after the BlobCache is gone.
+    DetachWorkerTaskPool();
+}
+
+void BlobCache::SetWorkerTaskPool(dawn::platform::WorkerTaskPool* workerTaskPool) {
+    DAWN_ASSERT(workerTaskPool != nullptr);
+    mHasWorkerTaskPool = true;
+    mState->workerTaskPool = workerTaskPool;
+}
+
+void BlobCache::DetachWorkerTaskPool() {
+    // Stores that are queued after the pool is detached run synchronously, so waiting for the task
+    // that is already scheduled leaves nothing for the pool to do.
+    mState.Use<NotifyType::None>([](auto state) {
+        state->workerTaskPool = nullptr;
+        state.Wait([](auto& s) { return !s.flushScheduled; });
+    });
+}
 
 ResultOrError<Blob> BlobCache::Load(const CacheKey& key) {
-    return LoadInternal(key);
+    DAWN_ASSERT(ValidateCacheKey(key));
+
+    if (mMemoryBudget != 0 || mHasWorkerTaskPool) {
+        if (Payload payload = FindInMemory(key)) {
+            return CreateBlobFromPayload(*payload);
+        }
+    }
+
+    Blob blob;
+    DAWN_TRY_ASSIGN(blob, LoadInternal(key));
+    if (mMemoryBudget != 0 && !blob.Empty()) {
+        AddToMemoryTier(key, std::make_shared<const std::vector<std::byte>>(blob.Data().begin(),
+                                                                            blob.Data().end()));
+    }
+    return std::move(blob);
 }
 
 void BlobCache::Store(const CacheKey& key, std::span<const std::byte> value) {
-    StoreInternal(key, value);
+    if (mMemoryBudget == 0 && (!mHasWorkerTaskPool || mStoreCallbackInfo.callback == nullptr)) {
+        StoreInternal(key, value);
+        return;
+    }
+
+    DAWN_ASSERT(ValidateCacheKey(key));
+    DAWN_CHECK(value.data() != nullptr);
+    DAWN_CHECK(value.size() > 0);
+
+    Payload payload = std::make_shared<const std::vector<std::byte>>(value.begin(), value.end());
+    if (mMemoryBudget != 0) {
+        AddToMemoryTier(key, payload);
+    }
+    if (mStoreCallbackInfo.callback == nullptr) {
+        return;
+    }
+
+    // Queue the store and make sure a task will pick it up. The task drains the queue in batches
+    // until it finds it empty.
+    bool queued = false;
+    dawn::platform::WorkerTaskPool* postTaskOn = nullptr;
+    mState.Use<NotifyType::None>([&](auto state) {
+        if (state->workerTaskPool == nullptr) {
+            return;
+        }
+        queued = true;
+        state->pendingStores.push_back({key, std::move(payload)});
+        if (!state->flushScheduled) {
+            state->flushScheduled = true;
+            postTaskOn = state->workerTaskPool;
+        }
+    });
+
+    if (!queued) {
+        StoreInternal(key, *payload);
+    } else if (postTaskOn != nullptr) {
+        // DetachWorkerTaskPool() waits for the task, so the pool is still alive here.
+        postTaskOn->PostWorkerTaskWithPriority(FlushPendingStoresTask, this,
+                                               platform::TaskPriority::Background);
+    }
 }
 
 void BlobCache::Store(const CacheKey& key, const Blob& value) {
     Store(key, value.Data());
 }
 
+void BlobCache::Flush() {
+    mState.Use<NotifyType::None>([](auto state) {
+        state.Wait([](auto& s) { return !s.flushScheduled; });
+    });
+}
+
+// static
+void BlobCache::FlushPendingStoresTask(void* userdata) {
+    BlobCache* cache = static_cast<BlobCache*>(userdata);
+
+    std::vector<PendingStore> batch;
+    while (true) {
+        batch.clear();
+        bool done = cache->mState.Use([&](auto state) {
+            if (state->pendingStores.empty()) {
+                // Waiters on Flush() are notified when the state is released.
+                state->flushScheduled = false;
+                return true;
+            }
+            batch.swap(state->pendingStores);
+            return false;
+        });
+        if (done) {
+            return;
+        }
+
+        for (const PendingStore& store : batch) {
+            cache->StoreInternal(store.key, *store.value);
+        }
+    }
+}
+
+BlobCache::Payload BlobCache::FindInMemory(const CacheKey& key) {
+    return mState.Use<NotifyType::None>([&](auto state) -> Payload {
+        auto it = state->entries.find(KeyView(key));
+        if (it != state->entries.end()) {
+            // Mark the entry as the most recently used.
+            state->lru.splice(state->lru.begin(), state->lru, it->second);
+            return it->second->value;
+        }
+
+        // Stores that are still queued are found in the memory tier unless it is disabled, or they
+        // were already evicted from it.
+        for (const PendingStore& store : state->pendingStores) {
+            if (std::ranges::equal(store.key, key)) {
+                return store.value;
+            }
+        }
+        return nullptr;
+    });
+}
+
+void BlobCache::AddToMemoryTier(const CacheKey& key, Payload value) {
+    DAWN_ASSERT(mMemoryBudget != 0);
+    if (value->size() > mMemoryBudget) {
+        return;
+    }
+
+    mState.Use<NotifyType::None>([&](auto state) {
+        auto it = state->entries.find(KeyView(key));
+        if (it != state->entries.end()) {
+            state->memoryUsage -= it->second->value->size();
+            state->lru.erase(it->second);
+            state->entries.erase(it);
+        }
+
+        // Evict the least recently used entries until the new one fits in the budget.
+        while (state->memoryUsage + value->size() > mMemoryBudget) {
+            const MemoryEntry& last = state->lru.back();
+            state->memoryUsage -= last.value->size();
+            state->entries.erase(std::string_view(last.key));
+            state->lru.pop_back();
+        }
+
+        state->memoryUsage += value->size();
+        state->lru.push_front({std::string(KeyView(key)), std::move(value)});
+        state->entries.emplace(std::string_view(state->lru.front().key), state->lru.begin());
+    });
+}
+
 Blob BlobCache::GenerateActualStoredBlobForTesting(std::span<const std::byte> value) {
     if (!mHashValidation) {
         Blob blob = Blob::Create(value.size());
@@ -29,10 +29,17 @@
 #define SRC_DAWN_NATIVE_BLOBCACHE_H_
 
 #include <algorithm>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+#include "src/dawn/common/MutexProtected.h"
 #include "src/dawn/common/Sha3.h"
 #include "src/dawn/native/Blob.h"
 #include "src/dawn/native/CacheResult.h"
@@ -41,7 +48,8 @@
 
 namespace dawn::platform {
 class CachingInterface;
-}
+class WorkerTaskPool;
+}  // namespace dawn::platform
 
 namespace dawn::native {
 
@@ -53,9 +61,31 @@ std::vector<std::byte> GenerateHashPrefixedPayload(std::span<const std::byte> va
 }  // namespace detail
 
 // This class should always be thread-safe because it may be called asynchronously.
+//
+// The BlobCache can optionally front the embedder's callbacks with two tiers:
+//   * An in-memory LRU cache holding up to `memoryBudget` bytes of recently stored and loaded
+//     blobs. Loads that hit it don't call the embedder's load callback.
+//   * When a WorkerTaskPool is set, stores are queued and handed to the embedder's store callback
+//     in batches on the pool (write-behind), so that hashing and storing the blobs is not on the
+//     critical path of pipeline creation.
 class BlobCache {
   public:
-    BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc, bool enableHashValidation);
+    // The memory budget used by the device when the AsyncBlobCache toggle is enabled.
+    static constexpr size_t kDefaultMemoryBudget = 32 * 1024 * 1024;
+
+    BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc,
+              bool enableHashValidation,
+              size_t memoryBudget = 0);
+    ~BlobCache();
+
+    // Makes stores asynchronous, using `workerTaskPool` which must outlive the BlobCache or be
+    // detached with DetachWorkerTaskPool() before it is destroyed. Must be called before any other
+    // thread uses the BlobCache.
+    void SetWorkerTaskPool(dawn::platform::WorkerTaskPool* workerTaskPool);
+
+    // Waits until all the queued stores have been passed to the embedder, then stops using the
+    // WorkerTaskPool so that it can be destroyed. The stores that follow are synchronous.
+    void DetachWorkerTaskPool();
 
     // Returns empty blob if the key is not found in the cache. Returns an internal error if hash
     // validation is enabled and the key is found but the hash validation fails.
@@ -65,6 +95,9 @@ class BlobCache {
     void Store(const CacheKey& key, std::span<const std::byte> value);
     void Store(const CacheKey& key, const Blob& value);
 
+    // Waits until all the queued stores have been passed to the embedder.
+    void Flush();
+
     // Store a CacheResult into the cache if it isn't cached yet.
     // Calls T::ToBlob which should be defined elsewhere.
     template <typename T>
@@ -79,8 +112,36 @@ class BlobCache {
     Blob GenerateActualStoredBlobForTesting(std::span<const std::byte> value);
 
   private:
-    // Non-thread safe internal implementations of load and store. Exposed callers that use
-    // these helpers need to make sure that these are entered with `mMutex` held.
+    using Payload = std::shared_ptr<const std::vector<std::byte>>;
+
+    struct MemoryEntry {
+        std::string key;
+        Payload value;
+    };
+    struct PendingStore {
+        CacheKey key;
+        Payload value;
+    };
+    struct State {
+        // The memory tier, ordered from the most to the least recently used entry. The map's keys
+        // point to the keys of the entries in the list.
+        std::list<MemoryEntry> lru;
+        absl::flat_hash_map<std::string_view, std::list<MemoryEntry>::iterator> entries;
+        size_t memoryUsage = 0;
+
+        // The pool that the stores are queued on, or nullptr if they are synchronous.
+        raw_ptr<dawn::platform::WorkerTaskPool> workerTaskPool = nullptr;
+        std::vector<PendingStore> pendingStores;
+        bool flushScheduled = false;
+    };
+
+    // Returns the payload for `key` from the memory tier or the queued stores, or nullptr.
+    Payload FindInMemory(const CacheKey& key);
+    void AddToMemoryTier(const CacheKey& key, Payload value);
+
+    static void FlushPendingStoresTask(void* userdata);
+
+    // Internal implementations of load and store calling the embedder's callbacks.
     // If hash validation enabled:
     //   * StoreInternal insert the hash of |value| as prefix,
     //   * LoadInternal validate that the hash of the content after the prefix matches.
@@ -95,6 +156,11 @@ class BlobCache {
     const bool mHashValidation;
     const WGPUDawnLoadCacheDataCallbackInfo mLoadCallbackInfo;
     const WGPUDawnStoreCacheDataCallbackInfo mStoreCallbackInfo;
+    const size_t mMemoryBudget;
+    // Whether a WorkerTaskPool was ever set, in which case Load() may find queued stores.
+    bool mHasWorkerTaskPool = false;
+
+    MutexCondVarProtected<State> mState;
 };
 
 }  // namespace dawn::native
@@ -39,7 +39,7 @@ class CacheKey : public stream::ByteVectorSink {
   public:
     using stream::ByteVectorSink::ByteVectorSink;
 
-    enum class Type { ComputePipeline, RenderPipeline, Shader };
+    enum class Type { ComputePipeline, RenderPipeline, Shader, LoweredTintIR };
 };
 
 }  // namespace dawn::native
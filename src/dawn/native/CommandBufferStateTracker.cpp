@@ -27,6 +27,7 @@
 
 #include "src/dawn/native/CommandBufferStateTracker.h"
 
+#include <algorithm>
 #include <bit>
 #include <limits>
 #include <optional>
@@ -368,6 +369,12 @@ MaybeError CommandBufferStateTracker::ValidateCanDrawIndexed() {
 }
 
 MaybeError CommandBufferStateTracker::ValidateNoDifferentTextureViewsOnSameTexture() {
+    // The result only depends on the bind groups, skip the check if it already passed for them.
+    if (mAspects[VALIDATION_ASPECT_BIND_GROUPS] && mCurrentValidatedBindGroupState.has_value() &&
+        mValidatedBindGroupStates[*mCurrentValidatedBindGroupState].textureViewsValidated) {
+        return {};
+    }
+
     // TODO(dawn:1855): Look into optimizations as flat_hash_map does many allocations
     absl::flat_hash_map<const TextureBase*, VectorOfTextureViews> textureToViews;
 
@@ -399,6 +406,9 @@ MaybeError CommandBufferStateTracker::ValidateNoDifferentTextureViewsOnSameTextu
             texture, ityp::span<size_t, const TextureViewBase* const>(views));
     }
 
+    if (mAspects[VALIDATION_ASPECT_BIND_GROUPS] && mCurrentValidatedBindGroupState.has_value()) {
+        mValidatedBindGroupStates[*mCurrentValidatedBindGroupState].textureViewsValidated = true;
+    }
     return {};
 }
 
@@ -534,6 +544,14 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
     DAWN_CHECK(mAspects[VALIDATION_ASPECT_PIPELINE]);
     DAWN_CHECK((aspects & ~kLazyAspects).none());
 
+    if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
+        mCurrentValidatedBindGroupState = FindValidatedBindGroupState();
+        if (mCurrentValidatedBindGroupState.has_value()) {
+            mAspects.set(VALIDATION_ASPECT_BIND_GROUPS);
+            aspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
+        }
+    }
+
     if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
         bool matches = true;
 
@@ -559,6 +577,7 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
 
         if (matches) {
             mAspects.set(VALIDATION_ASPECT_BIND_GROUPS);
+            AddValidatedBindGroupState();
         }
     }
 
@@ -842,6 +861,45 @@ void CommandBufferStateTracker::SetImmediateData(uint32_t offset, size_t size) {
     mImmediateDataMask |= ImmediateMask(((1u << slotCount) - 1u) << startSlot);
 }
 
+std::optional<size_t> CommandBufferStateTracker::FindValidatedBindGroupState() const {
+    for (size_t i = 0; i < kValidatedBindGroupStateCount; ++i) {
+        const ValidatedBindGroupState& state = mValidatedBindGroupStates[i];
+        if (state.pipeline != mLastPipeline) {
+            continue;
+        }
+
+        bool matches = true;
+        for (BindGroupIndex group : mLastPipelineLayout->GetBindGroupLayoutsMask()) {
+            if (state.bindGroups[group] != mBindgroups[group] ||
+                !std::equal(state.dynamicOffsets[group].begin(), state.dynamicOffsets[group].end(),
+                            mDynamicOffsets[group].begin(), mDynamicOffsets[group].end())) {
+                matches = false;
+                break;
+            }
+        }
+        if (matches) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+void CommandBufferStateTracker::AddValidatedBindGroupState() {
+    // Replace the entries in round-robin order.
+    size_t index = mNextValidatedBindGroupState;
+    mNextValidatedBindGroupState = (index + 1) % kValidatedBindGroupStateCount;
+
+    ValidatedBindGroupState& state = mValidatedBindGroupStates[index];
+    state.pipeline = mLastPipeline;
+    state.bindGroups = {};
+    for (BindGroupIndex group : mLastPipelineLayout->GetBindGroupLayoutsMask()) {
+        state.bindGroups[group] = mBindgroups[group];
+        state.dynamicOffsets[group] = mDynamicOffsets[group];
+    }
+    state.textureViewsValidated = false;
+    mCurrentValidatedBindGroupState = index;
+}
+
 void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
     mLastPipeline = pipeline;
     mLastPipelineLayout = pipeline != nullptr ? pipeline->GetLayout() : nullptr;
@@ -28,6 +28,8 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDBUFFERSTATETRACKER_H_
 #define SRC_DAWN_NATIVE_COMMANDBUFFERSTATETRACKER_H_
 
+#include <array>
+#include <optional>
 #include <vector>
 
 #include "partition_alloc/pointers/raw_ptr_exclusion.h"
@@ -105,6 +107,10 @@ class CommandBufferStateTracker {
 
     void SetPipelineCommon(PipelineBase* pipeline);
 
+    // Looks up, or records, the current pipeline and bind groups in mValidatedBindGroupStates.
+    std::optional<size_t> FindValidatedBindGroupState() const;
+    void AddValidatedBindGroupState();
+
     ValidationAspects mAspects;
 
     VertexBufferMask mVertexBuffersUsed;
@@ -128,6 +134,24 @@ class CommandBufferStateTracker {
     RAW_PTR_EXCLUSION const RequiredBufferSizes* mMinBufferSizes = nullptr;
 
     ImmediateMask mImmediateDataMask;
+
+    // A small cache of the pipeline and bind group combinations that passed the bind group
+    // validation, so that draws alternating between a few pipelines and bind groups don't
+    // revalidate each time the state changes. Only the bind groups and dynamic offsets used by the
+    // pipeline layout are recorded. The pointers stay valid because the encoder keeps the objects
+    // alive.
+    struct ValidatedBindGroupState {
+        RAW_PTR_EXCLUSION PipelineBase* pipeline = nullptr;
+        RAW_PTR_EXCLUSION PerBindGroup<BindGroupBase*> bindGroups = {};
+        PerBindGroup<ityp::vector<BindingIndex, uint32_t>> dynamicOffsets;
+        // Whether ValidateNoDifferentTextureViewsOnSameTexture passed for these bind groups.
+        bool textureViewsValidated = false;
+    };
+    static constexpr size_t kValidatedBindGroupStateCount = 4;
+    std::array<ValidatedBindGroupState, kValidatedBindGroupStateCount> mValidatedBindGroupStates;
+    size_t mNextValidatedBindGroupState = 0;
+    // Index of the entry matching the current state, set while VALIDATION_ASPECT_BIND_GROUPS is.
+    std::optional<size_t> mCurrentValidatedBindGroupState;
 };
 
 }  // namespace dawn::native
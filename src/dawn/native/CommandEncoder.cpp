@@ -2331,9 +2331,9 @@ void CommandEncoder::APIWriteTimestamp(QuerySetBase* querySet, uint32_t queryInd
 }
 
 CommandBufferBase* CommandEncoder::APIFinish(const CommandBufferDescriptor* descriptor) {
-    // This function will create new object, need to lock the Device.
-    auto deviceGuard = GetDevice()->GetGuard();
-
+    // The device is only locked when creating the command buffer (see Finish()) so that
+    // independent encoders can be finished and validated concurrently. Errors are reported with
+    // ConsumedError which locks the device itself.
     Ref<CommandBufferBase> commandBuffer;
     if (GetDevice()->ConsumedError(Finish(descriptor), &commandBuffer, "finishing %s.", this)) {
         Ref<CommandBufferBase> errorCommandBuffer =
@@ -2367,6 +2367,9 @@ ResultOrError<Ref<CommandBufferBase>> CommandEncoder::Finish(
         descriptor = &defaultDescriptor;
     }
 
+    // Everything above only touches state owned by this encoder, but creating the command buffer
+    // creates a new object so we need to lock the Device.
+    auto deviceGuard = device->GetGuard();
     return device->CreateCommandBuffer(this, descriptor);
 }
 
@@ -35,6 +35,7 @@
 #include "src/dawn/native/BindGroupLayout.h"
 #include "src/dawn/native/Buffer.h"
 #include "src/dawn/native/Device.h"
+#include "src/dawn/native/DynamicUploader.h"
 #include "src/dawn/native/Instance.h"
 #include "src/dawn/native/Texture.h"
 #include "src/utils/log.h"
@@ -208,6 +209,14 @@ size_t GetLazyClearCountForTesting(WGPUDevice device) {
     return FromAPI(device)->GetLazyClearCountForTesting();
 }
 
+uint64_t GetCommandBlockAllocationCountForTesting(WGPUDevice device) {
+    return FromAPI(device)->GetCommandBlockAllocationCountForTesting();
+}
+
+uint64_t GetPipelineBarrierCountForTesting(WGPUDevice device) {
+    return FromAPI(device)->GetPipelineBarrierCountForTesting();
+}
+
 bool IsTextureSubresourceInitialized(WGPUTexture texture,
                                      uint32_t baseMipLevel,
                                      uint32_t levelCount,
@@ -300,6 +309,11 @@ AllocatorMemoryInfo GetAllocatorMemoryInfo(WGPUDevice device) {
     return FromAPI(device)->GetAllocatorMemoryInfo();
 }
 
+UploadMemoryInfo GetUploadMemoryInfo(WGPUDevice device) {
+    auto deviceGuard = FromAPI(device)->GetGuard();
+    return FromAPI(device)->GetDynamicUploader()->GetUploadMemoryInfo();
+}
+
 bool ReduceMemoryUsage(WGPUDevice device) {
     auto deviceGuard = FromAPI(device)->GetGuard();
     return FromAPI(device)->ReduceMemoryUsage();
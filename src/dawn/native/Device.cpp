@@ -330,8 +330,9 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
         cacheDesc.dawnStoreCacheDataCallbackInfo = {};
     }
 
-    mBlobCache =
-        std::make_unique<BlobCache>(cacheDesc, IsToggleEnabled(Toggle::BlobCacheHashValidation));
+    mBlobCache = std::make_unique<BlobCache>(
+        cacheDesc, IsToggleEnabled(Toggle::BlobCacheHashValidation),
+        IsToggleEnabled(Toggle::AsyncBlobCache) ? BlobCache::kDefaultMemoryBudget : 0);
 
     if (descriptor->requiredLimits != nullptr) {
         UnpackLimitsIn(descriptor->requiredLimits, &mLimits);
@@ -413,6 +414,9 @@ MaybeError DeviceBase::Initialize(const UnpackedPtr<DeviceDescriptor>& descripto
     DAWN_CHECK(GetPlatform() != nullptr);
     mWorkerTaskPool = GetPlatform()->CreateWorkerTaskPool();
     mAsyncTaskManager = std::make_unique<AsyncTaskManager>(mWorkerTaskPool.get());
+    if (IsToggleEnabled(Toggle::AsyncBlobCache)) {
+        mBlobCache->SetWorkerTaskPool(mWorkerTaskPool.get());
+    }
 
     // Starting from now the backend can start doing reentrant calls so the device is marked as
     // alive.
@@ -573,6 +577,10 @@ void DeviceBase::Destroy(DestroyReason reason) {
         mAsyncTaskManager->WaitAllPendingTasks();
         mCallbackTaskManager->HandleShutDown();
 
+        // Hand the queued blob cache stores to the embedder before the device goes away, and make
+        // the later ones synchronous so that none is left for the worker task pool.
+        mBlobCache->DetachWorkerTaskPool();
+
         // Finish destroying all objects owned by the device. Note that this must be done before
         // DestroyImpl() as it may relinquish resources that will be freed by backends in the
         // DestroyImpl() call.
@@ -1830,6 +1838,21 @@ void DeviceBase::IncrementLazyClearCountForTesting() {
     ++mLazyClearCountForTesting;
 }
 
+uint64_t DeviceBase::GetCommandBlockAllocationCountForTesting() {
+    if (mMemoryBlockAllocator == nullptr) {
+        return 0;
+    }
+    return mMemoryBlockAllocator->GetHeapAllocationCount();
+}
+
+uint64_t DeviceBase::GetPipelineBarrierCountForTesting() {
+    return mPipelineBarrierCountForTesting.load();
+}
+
+void DeviceBase::IncrementPipelineBarrierCountForTesting() {
+    ++mPipelineBarrierCountForTesting;
+}
+
 void DeviceBase::EmitWarningOnce(std::string_view message) {
     if (mWarnings.insert(std::string{message}).second) {
         this->EmitLog(wgpu::LoggingType::Warning, message);
@@ -382,6 +382,9 @@ class DeviceBase : public ErrorSink,
 
     size_t GetLazyClearCountForTesting();
     void IncrementLazyClearCountForTesting();
+    uint64_t GetCommandBlockAllocationCountForTesting();
+    uint64_t GetPipelineBarrierCountForTesting();
+    void IncrementPipelineBarrierCountForTesting();
     void EmitWarningOnce(std::string_view message);
     void EmitCompilationLog(const ShaderModuleBase* module);
     void EmitLog(std::string_view message) override;
@@ -674,6 +677,7 @@ class DeviceBase : public ErrorSink,
     TogglesState mToggles;
 
     std::atomic_uint64_t mLazyClearCountForTesting = 0;
+    std::atomic_uint64_t mPipelineBarrierCountForTesting = 0;
     std::atomic_uint64_t mNextPipelineCompatibilityToken;
 
     CombinedLimits mLimits;
@@ -27,7 +27,9 @@
 
 #include "src/dawn/native/DynamicUploader.h"
 
+#include <algorithm>
 #include <atomic>
+#include <optional>
 #include <utility>
 
 #include "src/dawn/common/Math.h"
@@ -40,42 +42,53 @@
 namespace dawn::native {
 
 namespace {
-constexpr uint64_t kRingBufferSize = 4ULL * 1024 * 1024;
+// Ring buffers are created with power-of-two sizes between these two bounds.
+constexpr uint64_t kMinRingBufferSize = 4ULL * 1024 * 1024;
+constexpr uint64_t kMaxRingBufferSize = 64ULL * 1024 * 1024;
+
+// The ring buffer size is halved when the peak usage over this many serials stays below a quarter
+// of it.
+constexpr uint64_t kShrinkWindowSerialCount = 64;
+
+// The number of serials a staging buffer needs to stay unused before being freed.
+constexpr uint64_t kIdleStagingBufferSerialCount = 8;
+
+// Large staging buffers are allocated with this granularity so that they can be reused by uploads
+// of slightly different sizes.
+constexpr uint64_t kLargeStagingBufferGranularity = 1024 * 1024;
 }  // anonymous namespace
 
-DynamicUploader::DynamicUploader(DeviceBase* device) : mDevice(device) {}
+DynamicUploader::DynamicUploader(DeviceBase* device)
+    : mRingBufferSize(kMinRingBufferSize), mDevice(device) {}
+
+ResultOrError<Ref<BufferBase>> DynamicUploader::CreateStagingBuffer(uint64_t size) {
+    BufferDescriptor bufferDesc = {};
+    bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
+    bufferDesc.size = Align(size, 4);
+    bufferDesc.mappedAtCreation = true;
+    bufferDesc.label = "Dawn_DynamicUploaderStaging";
+
+    IgnoreLazyClearCountScope scope(mDevice);
+    return mDevice->CreateBuffer(&bufferDesc);
+}
 
 ResultOrError<UploadReservation> DynamicUploader::Reserve(uint64_t allocationSize,
                                                           uint64_t offsetAlignment) {
     DAWN_ASSERT(mDevice->IsLockedByCurrentThreadIfNeeded());
     uint64_t alignedAllocationSize = Align(allocationSize, 8);
+    ExecutionSerial serial = mDevice->GetQueue()->GetPendingCommandSerial();
+    mUploadedBytes += allocationSize;
 
     // Disable further sub-allocation should the request be too large.
-    if (allocationSize > kRingBufferSize) {
-        BufferDescriptor bufferDesc = {};
-        bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
-        bufferDesc.size = alignedAllocationSize;
-        bufferDesc.mappedAtCreation = true;
-        bufferDesc.label = "Dawn_DynamicUploaderStaging";
-
-        IgnoreLazyClearCountScope scope(mDevice);
-        Ref<BufferBase> stagingBuffer;
-        DAWN_TRY_ASSIGN(stagingBuffer, mDevice->CreateBuffer(&bufferDesc));
-
-        UploadReservation reservation;
-        reservation.mappedData = stagingBuffer->GetMappedRange();
-        reservation.offsetInBuffer = 0;
-        reservation.buffer = std::move(stagingBuffer);
-        return reservation;
+    if (allocationSize > mRingBufferSize) {
+        return ReserveLarge(allocationSize, alignedAllocationSize, serial);
     }
 
     // Request is small, we sub-allocate transiently in one of our ring buffers. The reservation
     // will only be valid for the pending serial.
-    ExecutionSerial serial = mDevice->GetQueue()->GetPendingCommandSerial();
-
     if (mRingBuffers.empty()) {
         mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
-            new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+            new RingBuffer{nullptr, RingBufferAllocator(mRingBufferSize)}));
     }
 
     // Note: Validation ensures size is already aligned.
@@ -93,31 +106,31 @@ ResultOrError<UploadReservation> DynamicUploader::Reserve(uint64_t allocationSiz
         }
     }
 
-    // Upon failure, append a newly created ring buffer to fulfill the
-    // request.
+    // Upon failure, the in-flight upload volume exceeds the existing ring buffers: grow the size
+    // class and append a newly created ring buffer to fulfill the request.
     if (startOffset == RingBufferAllocator::kInvalidOffset) {
+        mRingBufferSize = std::min(mRingBufferSize * 2, kMaxRingBufferSize);
         mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
-            new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+            new RingBuffer{nullptr, RingBufferAllocator(mRingBufferSize)}));
 
         targetRingBuffer = mRingBuffers.back().get();
         startOffset = targetRingBuffer->mAllocator.Allocate(alignedAllocationSize, serial);
     }
 
     DAWN_ASSERT(startOffset != RingBufferAllocator::kInvalidOffset);
+    targetRingBuffer->mLastUsageSerial = serial;
+
+    uint64_t usedSize = 0;
+    for (auto& ringBuffer : mRingBuffers) {
+        usedSize += ringBuffer->mAllocator.GetUsedSize();
+    }
+    mPeakRingBufferUsedSize = std::max(mPeakRingBufferUsedSize, usedSize);
 
     // Allocate the staging buffer backing the ringbuffer.
     // Note: the first ringbuffer will be lazily created.
     if (targetRingBuffer->mStagingBuffer == nullptr) {
-        BufferDescriptor bufferDesc = {};
-        bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
-        bufferDesc.size = Align(targetRingBuffer->mAllocator.GetSize(), 4);
-        bufferDesc.mappedAtCreation = true;
-        bufferDesc.label = "Dawn_DynamicUploaderStaging";
-
-        IgnoreLazyClearCountScope scope(mDevice);
-        Ref<BufferBase> stagingBuffer;
-        DAWN_TRY_ASSIGN(stagingBuffer, mDevice->CreateBuffer(&bufferDesc));
-        targetRingBuffer->mStagingBuffer = std::move(stagingBuffer);
+        DAWN_TRY_ASSIGN(targetRingBuffer->mStagingBuffer,
+                        CreateStagingBuffer(targetRingBuffer->mAllocator.GetSize()));
     }
 
     DAWN_ASSERT(targetRingBuffer->mStagingBuffer != nullptr);
@@ -133,6 +146,46 @@ ResultOrError<UploadReservation> DynamicUploader::Reserve(uint64_t allocationSiz
     return reservation;
 }
 
+ResultOrError<UploadReservation> DynamicUploader::ReserveLarge(uint64_t allocationSize,
+                                                               uint64_t alignedAllocationSize,
+                                                               ExecutionSerial serial) {
+    mLargeUploadCount++;
+
+    // Best-fit: find the smallest pooled buffer the GPU is done with that is large enough, but
+    // not so large that reusing it would waste most of it.
+    ExecutionSerial completedSerial = mDevice->GetQueue()->GetCompletedCommandSerial();
+    LargeStagingBuffer* target = nullptr;
+    for (LargeStagingBuffer& stagingBuffer : mLargeStagingBuffers) {
+        uint64_t size = stagingBuffer.mBuffer->GetSize();
+        if (stagingBuffer.mLastUsageSerial > completedSerial || size < alignedAllocationSize ||
+            size / 2 > alignedAllocationSize) {
+            continue;
+        }
+        if (target == nullptr || size < target->mBuffer->GetSize()) {
+            target = &stagingBuffer;
+        }
+    }
+
+    if (target != nullptr) {
+        mLargeUploadReuseCount++;
+    } else {
+        Ref<BufferBase> stagingBuffer;
+        DAWN_TRY_ASSIGN(stagingBuffer, CreateStagingBuffer(Align(alignedAllocationSize,
+                                                                 kLargeStagingBufferGranularity)));
+        mLargeStagingBuffers.push_back({std::move(stagingBuffer)});
+        target = &mLargeStagingBuffers.back();
+    }
+    target->mLastUsageSerial = serial;
+
+    UploadReservation reservation;
+    reservation.buffer = target->mBuffer;
+    reservation.mappedData =
+        reservation.buffer->GetMappedRange(0, checked_cast<size_t>(alignedAllocationSize))
+            .first(checked_cast<size_t>(allocationSize));
+    reservation.offsetInBuffer = 0;
+    return reservation;
+}
+
 MaybeError DynamicUploader::OnStagingMemoryFreePendingOnSubmit(uint64_t size) {
     UpdateMemoryPendingSubmit();
     mMemoryPendingSubmit.fetch_add(size, std::memory_order_relaxed);
@@ -165,21 +218,87 @@ MaybeError DynamicUploader::MaybeSubmitPendingCommands() {
 void DynamicUploader::Deallocate(ExecutionSerial lastCompletedSerial, bool freeAll) {
     DAWN_ASSERT(mDevice->IsLockedByCurrentThreadIfNeeded());
 
+    // Shrink the size class if the ring buffers have been mostly unused for a while, or reset it
+    // when asked to free everything.
+    if (freeAll) {
+        mRingBufferSize = kMinRingBufferSize;
+    } else if (lastCompletedSerial >=
+               mShrinkWindowStartSerial + ExecutionSerial(kShrinkWindowSerialCount)) {
+        if (mPeakRingBufferUsedSize <= mRingBufferSize / 4) {
+            mRingBufferSize = std::max(mRingBufferSize / 2, kMinRingBufferSize);
+        }
+        mPeakRingBufferUsedSize = 0;
+        mShrinkWindowStartSerial = lastCompletedSerial;
+    }
+
     // Reclaim memory within the ring buffers by ticking (or removing requests no longer
     // in-flight).
+    std::optional<size_t> keptRingBufferIndex;
+    for (size_t i = 0; i < mRingBuffers.size(); i++) {
+        mRingBuffers[i]->mAllocator.Deallocate(lastCompletedSerial);
+        if (mRingBuffers[i]->mAllocator.GetSize() == mRingBufferSize) {
+            keptRingBufferIndex = i;
+        }
+    }
+
+    // Never erase the last buffer of the current size class as to prevent re-creating it again
+    // unless explicitly asked to do so. Other empty buffers are kept around for reuse by the next
+    // uploads until they have been idle for a while, unless they are of a stale size class.
     size_t i = 0;
+    size_t ringBufferIndex = 0;
     while (i < mRingBuffers.size()) {
-        mRingBuffers[i]->mAllocator.Deallocate(lastCompletedSerial);
+        RingBuffer* ringBuffer = mRingBuffers[i].get();
+        bool isKept = ringBufferIndex == keptRingBufferIndex;
+        ringBufferIndex++;
+
+        bool shouldFree = false;
+        if (ringBuffer->mAllocator.Empty()) {
+            if (freeAll || ringBuffer->mAllocator.GetSize() != mRingBufferSize) {
+                shouldFree = true;
+            } else if (!isKept) {
+                shouldFree = lastCompletedSerial >=
+                             ringBuffer->mLastUsageSerial +
+                                 ExecutionSerial(kIdleStagingBufferSerialCount);
+            }
+        }
 
-        // Never erase the last buffer as to prevent re-creating smaller buffers
-        // again unless explicitly asked to do so. The last buffer is the largest.
-        const bool shouldFree = (i < mRingBuffers.size() - 1) || freeAll;
-        if (mRingBuffers[i]->mAllocator.Empty() && shouldFree) {
+        if (shouldFree) {
+            mFreedRingBufferWrapCount += ringBuffer->mAllocator.GetWrapCount();
             mRingBuffers.erase(mRingBuffers.begin() + sign_cast(i));
         } else {
             i++;
         }
     }
+
+    // Free the large staging buffers that have been idle for a while.
+    std::erase_if(mLargeStagingBuffers, [&](const LargeStagingBuffer& stagingBuffer) {
+        if (stagingBuffer.mLastUsageSerial > lastCompletedSerial) {
+            return false;
+        }
+        return freeAll || lastCompletedSerial >= stagingBuffer.mLastUsageSerial +
+                                                     ExecutionSerial(kIdleStagingBufferSerialCount);
+    });
+}
+
+UploadMemoryInfo DynamicUploader::GetUploadMemoryInfo() const {
+    DAWN_ASSERT(mDevice->IsLockedByCurrentThreadIfNeeded());
+
+    UploadMemoryInfo info = {};
+    info.uploadedBytes = mUploadedBytes;
+    info.ringBufferWrapCount = mFreedRingBufferWrapCount;
+    info.largeUploadCount = mLargeUploadCount;
+    info.largeUploadReuseCount = mLargeUploadReuseCount;
+    info.ringBufferSize = mRingBufferSize;
+    for (const auto& ringBuffer : mRingBuffers) {
+        info.ringBufferWrapCount += ringBuffer->mAllocator.GetWrapCount();
+        if (ringBuffer->mStagingBuffer != nullptr) {
+            info.stagingMemorySize += ringBuffer->mStagingBuffer->GetSize();
+        }
+    }
+    for (const LargeStagingBuffer& stagingBuffer : mLargeStagingBuffers) {
+        info.stagingMemorySize += stagingBuffer.mBuffer->GetSize();
+    }
+    return info;
 }
 
 void DynamicUploader::UpdateMemoryPendingSubmit() {
@@ -32,6 +32,7 @@
 #include <memory>
 #include <vector>
 
+#include "dawn/native/DawnNative.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 #include "src/dawn/common/Ref.h"
 #include "src/dawn/native/Error.h"
@@ -42,7 +43,10 @@
 #include "src/utils/span.h"
 
 // DynamicUploader is the front-end implementation used to manage multiple ring buffers for upload
-// usage.
+// usage. Ring buffers are created in size classes that grow when the in-flight upload volume
+// exhausts them and shrink when it stays low. Uploads too large for the ring buffers use a pool of
+// staging buffers that are reused once the GPU is done with them. All staging buffers stay mapped
+// for their whole lifetime.
 namespace dawn::native {
 
 class BufferBase;
@@ -79,8 +83,14 @@ class DynamicUploader : NonMovable {
 
     void Deallocate(ExecutionSerial lastCompletedSerial, bool freeAll = false);
 
+    UploadMemoryInfo GetUploadMemoryInfo() const;
+
   private:
     ResultOrError<UploadReservation> Reserve(uint64_t size, uint64_t offsetAlignment);
+    ResultOrError<UploadReservation> ReserveLarge(uint64_t allocationSize,
+                                                  uint64_t alignedAllocationSize,
+                                                  ExecutionSerial serial);
+    ResultOrError<Ref<BufferBase>> CreateStagingBuffer(uint64_t size);
 
     // Checks if a submit happened and resets memory to be freed pending submit if so.
     void UpdateMemoryPendingSubmit();
@@ -88,8 +98,25 @@ class DynamicUploader : NonMovable {
     struct RingBuffer {
         Ref<BufferBase> mStagingBuffer;
         RingBufferAllocator mAllocator;
+        ExecutionSerial mLastUsageSerial = kBeginningOfGPUTime;
     };
     std::vector<std::unique_ptr<RingBuffer>> mRingBuffers;
+    // Size of the ring buffers created next. Ring buffers of other sizes are freed when empty.
+    uint64_t mRingBufferSize;
+    // Largest amount of ring buffer memory used since the start of the shrink window.
+    uint64_t mPeakRingBufferUsedSize = 0;
+    ExecutionSerial mShrinkWindowStartSerial = kBeginningOfGPUTime;
+
+    struct LargeStagingBuffer {
+        Ref<BufferBase> mBuffer;
+        ExecutionSerial mLastUsageSerial = kBeginningOfGPUTime;
+    };
+    std::vector<LargeStagingBuffer> mLargeStagingBuffers;
+
+    uint64_t mUploadedBytes = 0;
+    uint64_t mFreedRingBufferWrapCount = 0;
+    uint64_t mLargeUploadCount = 0;
+    uint64_t mLargeUploadReuseCount = 0;
 
     // Serial used to track when a serial has been scheduled and the corresponding pending memory
     // will be freed in finite time.
@@ -75,6 +75,10 @@ uint64_t RingBufferAllocator::GetUsedSize() const {
     return mUsedSize;
 }
 
+uint64_t RingBufferAllocator::GetWrapCount() const {
+    return mWrapCount;
+}
+
 bool RingBufferAllocator::Empty() const {
     return mInflightRequests.Empty();
 }
@@ -128,6 +132,7 @@ uint64_t RingBufferAllocator::Allocate(uint64_t allocationSize,
             startOffset = 0;
             mUsedSize += requestSize;
             currentRequestSize = requestSize;
+            mWrapCount++;
         }
     } else if (alignedUsedEndOffset + allocationSize <= mUsedStartOffset) {
         // Otherwise, buffer is split where sub-alloc must be in-between.
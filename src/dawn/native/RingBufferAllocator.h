@@ -54,6 +54,8 @@ class RingBufferAllocator {
     uint64_t GetSize() const;
     bool Empty() const;
     uint64_t GetUsedSize() const;
+    // Number of allocations that wrapped around to the front of the ring buffer.
+    uint64_t GetWrapCount() const;
 
     static constexpr uint64_t kInvalidOffset = std::numeric_limits<uint64_t>::max();
 
@@ -70,6 +72,7 @@ class RingBufferAllocator {
     uint64_t mUsedStartOffset = 0;  // Head of used sub-alloc requests (in bytes).
     uint64_t mMaxBlockSize = 0;     // Max size of the ring buffer (in bytes).
     uint64_t mUsedSize = 0;         // Size of the sub-alloc requests (in bytes) of the ring buffer.
+    uint64_t mWrapCount = 0;        // Number of sub-allocs placed back at the front.
 };
 }  // namespace dawn::native
 
@@ -56,6 +56,11 @@
 
 #include "tint/tint.h"
 
+#if TINT_BUILD_IR_BINARY
+#include "src/tint/lang/core/ir/binary/decode.h"
+#include "src/tint/lang/core/ir/binary/encode.h"
+#endif
+
 namespace dawn::native {
 
 namespace {
@@ -2061,6 +2066,53 @@ Ref<TintProgram> ShaderModuleBase::GetTintProgram() {
     });
 }
 
+ResultOrError<tint::core::ir::Module> ShaderModuleBase::GetLoweredTintIR(
+    const tint::wgsl::reader::IROptions& options) {
+    DeviceBase* device = GetDevice();
+
+#if TINT_BUILD_IR_BINARY
+    // The lowered IR only depends on the shader module content and on the device (for example the
+    // enabled features and toggles), both of which are part of the key.
+    const bool useCache = device->IsToggleEnabled(Toggle::CacheLoweredTintIR);
+    CacheKey key;
+    Blob blob;
+    if (useCache) {
+        StreamIn(&key, CacheKey::Type::LoweredTintIR, device->GetCacheKey(), mHash);
+        DAWN_TRY_ASSIGN(blob, device->GetBlobCache()->Load(key));
+    }
+    if (!blob.Empty()) {
+        tint::Result<tint::core::ir::Module> decoded = tint::core::ir::binary::Decode(blob.Data());
+        // A blob that fails to decode (for example one written by a different version of Tint) is
+        // treated like a cache miss and overwritten below.
+        if (decoded == tint::Success) {
+            // The options are not serialized, so apply them like ProgramToLoweredIR does.
+            tint::core::ir::Module module = decoded.Move();
+            module.ice_callback = options.ice_callback;
+            module.dump_ir_when_validating = options.dump_ir_when_validating;
+            module.enable_validation_asserts = options.enable_validation_asserts;
+            return std::move(module);
+        }
+    }
+#endif
+
+    Ref<TintProgram> tintProgram = GetTintProgram();
+    tint::Result<tint::core::ir::Module> ir =
+        tint::wgsl::reader::ProgramToLoweredIR(tintProgram->program, options);
+    DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
+                    ir.Failure().reason);
+
+#if TINT_BUILD_IR_BINARY
+    if (useCache) {
+        auto encoded = tint::core::ir::binary::EncodeToBinary(ir.Get());
+        if (encoded == tint::Success && !encoded->IsEmpty()) {
+            device->GetBlobCache()->Store(key, encoded->AsSpan());
+        }
+    }
+#endif
+
+    return ir.Move();
+}
+
 Ref<TintProgram> ShaderModuleBase::GetNullableTintProgramForTesting() const {
     return mCompiledState.tintData.Use([&](auto tintData) { return tintData->tintProgram; });
 }
@@ -414,6 +414,13 @@ class ShaderModuleBase : public RefCountedWithExternalCount<ApiObjectBase>,
     // Get tintProgram, (re)create it if necessary.
     Ref<TintProgram> GetTintProgram();
 
+    // Get the module lowered to Tint core IR. With the CacheLoweredTintIR toggle (and Tint built
+    // with the IR binary format) the lowered IR is stored in the BlobCache, so that later calls,
+    // including in other processes, decode it instead of recreating the tintProgram and lowering
+    // it again.
+    ResultOrError<tint::core::ir::Module> GetLoweredTintIR(
+        const tint::wgsl::reader::IROptions& options);
+
     Future APIGetCompilationInfo(const WGPUCompilationInfoCallbackInfo& callbackInfo);
 
     const OwnedCompilationMessages* GetCompilationMessages() const;
@@ -195,6 +195,16 @@ class SubresourceStorage {
     template <typename U, typename F>
     void Merge(const SubresourceStorage<U>& other, F&& mergeFunc);
 
+    // Given a predicate that's a function or function-like object that can be called with an
+    // argument of type (const T& data) and returns bool, returns whether it is true for the data
+    // of every subresource in `range`. The predicate is called once per compressed sub-range so
+    // queries on a fully compressed aspect are O(1) and on compressed layers are O(layers).
+    // Returns on the first false result. For example:
+    //
+    //   bool allInitialized = subresources.All(range, [](const bool& data) { return data; });
+    template <typename F>
+    bool All(const SubresourceRange& range, F&& predicate) const;
+
     // Other operations to consider:
     //
     //  - UpdateTo(Range, T) that updates the range to a constant value.
@@ -440,6 +450,46 @@ R SubresourceStorage<T>::Iterate(F&& iterateFunc) const {
     }
 }
 
+template <typename T>
+template <typename F>
+bool SubresourceStorage<T>::All(const SubresourceRange& range, F&& predicate) const {
+    DAWN_ASSERT(range.baseArrayLayer + range.layerCount <= mArrayLayerCount);
+    DAWN_ASSERT(range.baseMipLevel + range.levelCount <= mMipLevelCount);
+
+    for (Aspect aspect : IterateEnumMask(range.aspects)) {
+        uint32_t aspectIndex = GetAspectIndex(aspect);
+        DAWN_ASSERT(aspectIndex < GetAspectCount(mAspects));
+
+        // Fastest path, the aspect is compressed!
+        if (mAspectCompressed[aspectIndex]) {
+            if (!predicate(DataInline(aspectIndex))) {
+                return false;
+            }
+            continue;
+        }
+
+        uint32_t layerEnd = range.baseArrayLayer + range.layerCount;
+        for (uint32_t layer = range.baseArrayLayer; layer < layerEnd; layer++) {
+            // Fast path, the array layer is compressed.
+            if (LayerCompressed(aspectIndex, layer)) {
+                if (!predicate(Data(aspectIndex, layer))) {
+                    return false;
+                }
+                continue;
+            }
+
+            uint32_t levelEnd = range.baseMipLevel + range.levelCount;
+            for (uint32_t level = range.baseMipLevel; level < levelEnd; level++) {
+                if (!predicate(Data(aspectIndex, layer, level))) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 template <typename T>
 const T& SubresourceStorage<T>::Get(Aspect aspect, uint32_t arrayLayer, uint32_t mipLevel) const {
     uint32_t aspectIndex = GetAspectIndex(aspect);
@@ -1081,11 +1081,8 @@ TextureBase::TextureBase(DeviceBase* device, const UnpackedPtr<TextureDescriptor
       mSampleCount(descriptor->sampleCount),
       mUsage(descriptor->usage),
       mInternalUsage(mUsage),
-      mFormatEnumForReflection(descriptor->format) {
-    uint32_t subresourceCount =
-        mMipLevelCount * GetArrayLayers() * GetAspectCount(mFormat->aspects);
-    mIsSubresourceContentInitializedAtIndex = std::vector<bool>(subresourceCount, false);
-
+      mFormatEnumForReflection(descriptor->format),
+      mIsSubresourceContentInitialized(mFormat->aspects, GetArrayLayers(), mMipLevelCount, false) {
     for (wgpu::TextureFormat viewFormat : descriptor->viewFormats) {
         if (viewFormat == descriptor->format) {
             // Skip our own format, so the backends don't allocate the texture for
@@ -1118,7 +1115,8 @@ TextureBase::TextureBase(DeviceBase* device,
       mMipLevelCount(descriptor->mipLevelCount),
       mSampleCount(descriptor->sampleCount),
       mUsage(descriptor->usage),
-      mFormatEnumForReflection(descriptor->format) {
+      mFormatEnumForReflection(descriptor->format),
+      mIsSubresourceContentInitialized(Aspect::None, 1, 1, false) {
     auto textureBindingViewDimension = wgpu::TextureViewDimension::Undefined;
     for (const wgpu::ChainedStruct* chain = descriptor->nextInChain; chain != nullptr;
          chain = chain->nextInChain) {
@@ -1316,7 +1314,7 @@ uint32_t TextureBase::GetSampleCount() const {
 }
 uint32_t TextureBase::GetSubresourceCount() const {
     DAWN_CHECK(!IsError());
-    return static_cast<uint32_t>(mIsSubresourceContentInitializedAtIndex.size());
+    return mMipLevelCount * GetArrayLayers() * GetAspectCount(mFormat->aspects);
 }
 wgpu::TextureUsage TextureBase::GetUsage() const {
     DAWN_CHECK(!IsError());
@@ -1378,36 +1376,15 @@ uint32_t TextureBase::GetSubresourceIndex(uint32_t mipLevel,
 
 bool TextureBase::IsSubresourceContentInitialized(const SubresourceRange& range) const {
     DAWN_CHECK(!IsError());
-    for (Aspect aspect : IterateEnumMask(range.aspects)) {
-        for (uint32_t arrayLayer = range.baseArrayLayer;
-             arrayLayer < range.baseArrayLayer + range.layerCount; ++arrayLayer) {
-            for (uint32_t mipLevel = range.baseMipLevel;
-                 mipLevel < range.baseMipLevel + range.levelCount; ++mipLevel) {
-                uint32_t subresourceIndex = GetSubresourceIndex(mipLevel, arrayLayer, aspect);
-                DAWN_ASSERT(subresourceIndex < mIsSubresourceContentInitializedAtIndex.size());
-                if (!mIsSubresourceContentInitializedAtIndex[subresourceIndex]) {
-                    return false;
-                }
-            }
-        }
-    }
-    return true;
+    return mIsSubresourceContentInitialized.All(
+        range, [](const bool& isInitialized) { return isInitialized; });
 }
 
 void TextureBase::SetIsSubresourceContentInitialized(bool isInitialized,
                                                      const SubresourceRange& range) {
     DAWN_CHECK(!IsError());
-    for (Aspect aspect : IterateEnumMask(range.aspects)) {
-        for (uint32_t arrayLayer = range.baseArrayLayer;
-             arrayLayer < range.baseArrayLayer + range.layerCount; ++arrayLayer) {
-            for (uint32_t mipLevel = range.baseMipLevel;
-                 mipLevel < range.baseMipLevel + range.levelCount; ++mipLevel) {
-                uint32_t subresourceIndex = GetSubresourceIndex(mipLevel, arrayLayer, aspect);
-                DAWN_ASSERT(subresourceIndex < mIsSubresourceContentInitializedAtIndex.size());
-                mIsSubresourceContentInitializedAtIndex[subresourceIndex] = isInitialized;
-            }
-        }
-    }
+    mIsSubresourceContentInitialized.Update(
+        range, [&](const SubresourceRange&, bool* data) { *data = isInitialized; });
 
     // If the texture is being marked as uninitialized, notify all bound resource tables so that
     // they can perform lazy initialization when used next.
@@ -30,7 +30,6 @@
 
 #include <memory>
 #include <string>
-#include <vector>
 
 #include "absl/container/flat_hash_set.h"
 #include "partition_alloc/pointers/raw_ref.h"
@@ -49,6 +48,7 @@
 #include "src/dawn/native/ObjectBase.h"
 #include "src/dawn/native/SharedTextureMemory.h"
 #include "src/dawn/native/Subresource.h"
+#include "src/dawn/native/SubresourceStorage.h"
 #include "src/dawn/native/dawn_platform.h"
 
 namespace dawn::native {
@@ -315,8 +315,9 @@ class TextureBase : public RefCountedWithExternalCount<SharedResource> {
 
     absl::flat_hash_set<WeakRef<ResourceTableBase>> mResourceTableUses;
 
-    // TODO(crbug.com/dawn/845): Use a more optimized data structure to save space
-    std::vector<bool> mIsSubresourceContentInitializedAtIndex;
+    // Compressed per-subresource initialization state: a texture that is fully (un)initialized
+    // stores a single value per aspect.
+    SubresourceStorage<bool> mIsSubresourceContentInitialized;
 
     // Owner GUID for memory dump tracking, non-zero GUID will be reported via
     // MemoryDump::AddOwnerGUID, and 0 indicates no external ownership for this texture.
@@ -916,6 +916,34 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Workaround a driver bug on some Intel GPUs on macOS where dynamic component stores on "
       "boolean vectors fail.",
       "https://crbug.com/540789158", ToggleStage::Device}},
+    {Toggle::NullBackendExecuteCommands,
+     {"null_backend_execute_commands",
+      "Have the Null backend execute buffer and texture copies, buffer clears and writes recorded "
+      "in command buffers on the CPU instead of dropping them, so that their results can be read "
+      "back. Render and compute passes are still not executed.",
+      "", ToggleStage::Device}},
+    {Toggle::AsyncBlobCache,
+     {"async_blob_cache",
+      "Keep recently stored and loaded blobs in an in-memory LRU cache in front of the blob cache "
+      "callbacks, and pass stores to the callbacks asynchronously in batches on the worker task "
+      "pool.",
+      "", ToggleStage::Device}},
+    {Toggle::CacheLoweredTintIR,
+     {"cache_lowered_tint_ir",
+      "Store shader modules lowered to Tint IR in the blob cache using the IR binary format, so "
+      "that compiling them for new pipelines doesn't need to parse and lower the shader again. "
+      "Has no effect when Tint is built without IR binary support.",
+      "", ToggleStage::Device}},
+    {Toggle::VulkanUseTimelineSemaphore,
+     {"vulkan_use_timeline_semaphore",
+      "Track the completion of queue submits with a single VK_KHR_timeline_semaphore whose value "
+      "is the submit serial, instead of one VkFence per submit.",
+      "", ToggleStage::Device}},
+    {Toggle::VulkanUseSynchronization2,
+     {"vulkan_use_synchronization2",
+      "Record the barriers of synchronization scopes with VK_KHR_synchronization2, using per-resource "
+      "stage and access masks and a single vkCmdPipelineBarrier2 per scope.",
+      "", ToggleStage::Device}},
 
     // Comment to separate the }} so it is clearer what to copy-paste to add a toggle.
 }};
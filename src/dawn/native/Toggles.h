@@ -223,6 +223,11 @@ enum class Toggle {
     DisableTransientAttachment,
     AutoMapBackendBuffer,
     MetalPolyfillBoolVecDynamicStore,
+    NullBackendExecuteCommands,
+    AsyncBlobCache,
+    CacheLoweredTintIR,
+    VulkanUseTimelineSemaphore,
+    VulkanUseSynchronization2,
 
     EnumCount,
     InvalidEnum = EnumCount,
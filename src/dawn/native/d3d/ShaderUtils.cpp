@@ -219,33 +219,29 @@ MaybeError TranslateToHLSL(d3d::HlslCompilationRequest r,
 
     TRACE_EVENT(DAWN_TRACE_CATEGORY(), "tint::hlsl::writer::Generate");
 
-    // Convert the AST program to an IR module.
-    tint::Result<tint::core::ir::Module> ir;
+    // Convert the AST program to an IR module, or load it from the BlobCache.
+    tint::core::ir::Module ir;
     {
         SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(tracePlatform.UnsafeGetValue(),
                                            "ShaderModuleProgramToIR");
 
         // Requires Tint Program here right before actual using.
         auto shaderModule = r.inputProgram.UnsafeGetValue();
-        auto inputProgram = shaderModule->GetTintProgram();
         auto device = shaderModule->GetDevice();
-        const tint::Program* tintInputProgram = &(inputProgram->program);
 
         tint::wgsl::reader::IROptions irOptions{
             .dump_ir_when_validating = device->IsToggleEnabled(Toggle::DumpTintIR),
             .enable_validation_asserts =
                 device->IsToggleEnabled(Toggle::EnableTintIRValidationAsserts),
         };
-        ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram, irOptions);
-        DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
-                        ir.Failure().reason);
+        DAWN_TRY_ASSIGN(ir, shaderModule->GetLoweredTintIR(irOptions));
     }
 
     tint::Result<tint::hlsl::writer::Output> result;
     {
         SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(tracePlatform.UnsafeGetValue(),
                                            "ShaderModuleGenerateHLSL");
-        result = tint::hlsl::writer::Generate(ir.Get(), r.tintOptions);
+        result = tint::hlsl::writer::Generate(ir, r.tintOptions);
         DAWN_INVALID_IF(result != tint::Success, "An error occurred while generating HLSL:\n%s",
                         result.Failure().reason);
     }
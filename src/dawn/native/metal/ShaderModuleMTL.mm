@@ -388,11 +388,9 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
             TRACE_EVENT(DAWN_TRACE_CATEGORY(), "tint::msl::writer::Generate");
             // Requires Tint Program here right before actual using.
             auto shaderModule = r.inputProgram.UnsafeGetValue();
-            auto inputProgram = shaderModule->GetTintProgram();
             auto device = shaderModule->GetDevice();
-            const tint::Program* tintInputProgram = &(inputProgram->program);
-            // Convert the AST program to an IR module.
-            tint::Result<tint::core::ir::Module> ir;
+            // Convert the AST program to an IR module, or load it from the BlobCache.
+            tint::core::ir::Module ir;
             {
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
                                                    "ShaderModuleProgramToIR");
@@ -402,10 +400,7 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
                     .enable_validation_asserts =
                         device->IsToggleEnabled(Toggle::EnableTintIRValidationAsserts),
                 };
-                ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram, irOptions);
-                DAWN_INVALID_IF(ir != tint::Success,
-                                "An error occurred while generating Tint IR\n%s",
-                                ir.Failure().reason);
+                DAWN_TRY_ASSIGN(ir, shaderModule->GetLoweredTintIR(irOptions));
             }
 
             // Generate MSL.
@@ -413,7 +408,7 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
             {
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
                                                    "ShaderModuleGenerateMSL");
-                result = tint::msl::writer::Generate(ir.Get(), r.tintOptions);
+                result = tint::msl::writer::Generate(ir, r.tintOptions);
                 DAWN_INVALID_IF(result != tint::Success,
                                 "An error occurred while generating MSL:\n%s",
                                 result.Failure().reason);
@@ -27,6 +27,7 @@
 
 #include "src/dawn/native/null/DeviceNull.h"
 
+#include <algorithm>
 #include <limits>
 #include <unordered_map>
 #include <utility>
@@ -34,7 +35,9 @@
 #include "partition_alloc/pointers/raw_ptr.h"
 #include "src/dawn/native/BackendConnection.h"
 #include "src/dawn/native/ChainUtils.h"
+#include "src/dawn/native/CommandValidation.h"
 #include "src/dawn/native/Commands.h"
+#include "src/dawn/native/EnumMaskIterator.h"
 #include "src/dawn/native/ErrorData.h"
 #include "src/dawn/native/Instance.h"
 #include "src/dawn/native/Surface.h"
@@ -163,6 +166,31 @@ BackendConnection* Connect(InstanceBase* instance) {
     return new Backend(instance);
 }
 
+struct CopyFromStagingToTextureOperation : PendingOperation {
+    void Execute() override {
+        const TypedTexelBlockInfo& blockInfo = GetBlockInfo(destination);
+        Texture* texture = ToBackend(destination.texture.Get());
+        SubresourceRange range = GetSubresourcesAffectedByCopy(destination, copySize);
+        if (IsCompleteSubresourceCopiedTo(texture, copySize, destination.mipLevel,
+                                          destination.aspect)) {
+            texture->SetIsSubresourceContentInitialized(true, range);
+        } else {
+            texture->EnsureSubresourceContentInitialized(range);
+        }
+
+        Span<const std::byte> data =
+            staging->GetMappedRange(checked_cast<size_t>(layout.offset),
+                                    checked_cast<size_t>(staging->GetSize() - layout.offset));
+        texture->WriteFromLinearData(data, layout.bytesPerRow, layout.rowsPerImage, destination,
+                                     blockInfo.ToBlock(copySize));
+    }
+
+    Ref<BufferBase> staging;
+    TexelCopyBufferLayout layout;
+    TextureCopy destination;
+    TexelExtent3D copySize;
+};
+
 struct CopyFromStagingToBufferOperation : PendingOperation {
     void Execute() override {
         destination->CopyFromStaging(staging.Get(), sourceOffset, destinationOffset, size);
@@ -308,6 +336,18 @@ MaybeError Device::CopyFromStagingToTextureImpl(BufferBase* source,
                                                 const TexelCopyBufferLayout& src,
                                                 const TextureCopy& dst,
                                                 const Extent3D& copySizePixels) {
+    if (!IsToggleEnabled(Toggle::NullBackendExecuteCommands)) {
+        return {};
+    }
+
+    auto operation = std::make_unique<CopyFromStagingToTextureOperation>();
+    operation->staging = source;
+    operation->layout = src;
+    operation->destination = dst;
+    operation->copySize = copySizePixels;
+
+    AddPendingOperation(std::move(operation));
+
     return {};
 }
 
@@ -370,9 +410,15 @@ BindGroupLayout::BindGroupLayout(DeviceBase* device,
 
 Buffer::Buffer(Device* device, const UnpackedPtr<BufferDescriptor>& descriptor)
     : BufferBase(device, descriptor) {
-    // SAFETY: Frontend is responsible for initializing mapped memory.
-    mBackingData =
-        DAWN_UNSAFE_BUFFERS(HeapArray<std::byte>::Uninit(checked_cast<size_t>(GetSize())));
+    if (device->IsToggleEnabled(Toggle::NullBackendExecuteCommands)) {
+        // Commands read the backing data directly so it must start zeroed like it would with
+        // lazy clears on other backends.
+        mBackingData = HeapArray<std::byte>(checked_cast<size_t>(GetSize()));
+    } else {
+        // SAFETY: Frontend is responsible for initializing mapped memory.
+        mBackingData =
+            DAWN_UNSAFE_BUFFERS(HeapArray<std::byte>::Uninit(checked_cast<size_t>(GetSize())));
+    }
     mAllocatedSize = GetSize();
 }
 
@@ -402,6 +448,10 @@ void Buffer::DoWriteBuffer(uint64_t bufferOffset, Span<const std::byte> data) {
     std::ranges::copy(data, mBackingData.subspan(checked_cast<size_t>(bufferOffset)).begin());
 }
 
+Span<std::byte> Buffer::GetData() {
+    return mBackingData;
+}
+
 MaybeError Buffer::MapAsyncImpl(wgpu::MapMode mode, size_t offset, size_t size) {
     GetDevice()->GetQueue()->IncrementLastSubmittedCommandSerial();
     return {};
@@ -434,6 +484,161 @@ void Buffer::DestroyImpl(DestroyReason reason) {
 CommandBuffer::CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor)
     : CommandBufferBase(encoder, descriptor) {}
 
+MaybeError CommandBuffer::Execute() {
+    Command type;
+    while (mCommands.NextCommandId(&type)) {
+        switch (type) {
+            case Command::CopyBufferToBuffer: {
+                CopyBufferToBufferCmd* copy = mCommands.NextCommand<CopyBufferToBufferCmd>();
+                if (copy->size == 0) {
+                    // Skip no-op copies.
+                    break;
+                }
+
+                size_t size = checked_cast<size_t>(copy->size);
+                ToBackend(copy->destination)
+                    ->GetData()
+                    .subspan(checked_cast<size_t>(copy->destinationOffset), size)
+                    .CopyFrom(ToBackend(copy->source)
+                                  ->GetData()
+                                  .subspan(checked_cast<size_t>(copy->sourceOffset), size));
+                break;
+            }
+
+            case Command::CopyBufferToTexture: {
+                CopyBufferToTextureCmd* copy = mCommands.NextCommand<CopyBufferToTextureCmd>();
+                if (copy->copySize.IsEmpty()) {
+                    // Skip no-op copies.
+                    break;
+                }
+
+                auto& src = copy->source;
+                auto& dst = copy->destination;
+                const TypedTexelBlockInfo& blockInfo = GetBlockInfo(dst);
+                Texture* texture = ToBackend(dst.texture.Get());
+
+                SubresourceRange range = GetSubresourcesAffectedByCopy(dst, copy->copySize);
+                if (IsCompleteSubresourceCopiedTo(texture, copy->copySize, dst.mipLevel,
+                                                  dst.aspect)) {
+                    texture->SetIsSubresourceContentInitialized(true, range);
+                } else {
+                    texture->EnsureSubresourceContentInitialized(range);
+                }
+
+                texture->WriteFromLinearData(
+                    ToBackend(src.buffer)->GetData().subspan(checked_cast<size_t>(src.offset)),
+                    blockInfo.ToBytes(src.blocksPerRow), static_cast<uint64_t>(src.rowsPerImage),
+                    dst, blockInfo.ToBlock(copy->copySize));
+                break;
+            }
+
+            case Command::CopyTextureToBuffer: {
+                CopyTextureToBufferCmd* copy = mCommands.NextCommand<CopyTextureToBufferCmd>();
+                if (copy->copySize.IsEmpty()) {
+                    // Skip no-op copies.
+                    break;
+                }
+
+                auto& src = copy->source;
+                auto& dst = copy->destination;
+                const TypedTexelBlockInfo& blockInfo = GetBlockInfo(src);
+                Texture* texture = ToBackend(src.texture.Get());
+
+                texture->EnsureSubresourceContentInitialized(
+                    GetSubresourcesAffectedByCopy(src, copy->copySize));
+
+                texture->ReadToLinearData(
+                    ToBackend(dst.buffer)->GetData().subspan(checked_cast<size_t>(dst.offset)),
+                    blockInfo.ToBytes(dst.blocksPerRow), static_cast<uint64_t>(dst.rowsPerImage),
+                    src, blockInfo.ToBlock(copy->copySize));
+                break;
+            }
+
+            case Command::CopyTextureToTexture: {
+                CopyTextureToTextureCmd* copy = mCommands.NextCommand<CopyTextureToTextureCmd>();
+                if (copy->copySize.IsEmpty()) {
+                    // Skip no-op copies.
+                    break;
+                }
+
+                auto& src = copy->source;
+                auto& dst = copy->destination;
+                const TypedTexelBlockInfo& blockInfo = GetBlockInfo(src);
+                BlockExtent3D copySize = blockInfo.ToBlock(copy->copySize);
+                Texture* srcTexture = ToBackend(src.texture.Get());
+                Texture* dstTexture = ToBackend(dst.texture.Get());
+
+                srcTexture->EnsureSubresourceContentInitialized(
+                    GetSubresourcesAffectedByCopy(src, copy->copySize));
+                SubresourceRange dstRange = GetSubresourcesAffectedByCopy(dst, copy->copySize);
+                if (IsCompleteSubresourceCopiedTo(dstTexture, copy->copySize, dst.mipLevel,
+                                                  dst.aspect)) {
+                    dstTexture->SetIsSubresourceContentInitialized(true, dstRange);
+                } else {
+                    dstTexture->EnsureSubresourceContentInitialized(dstRange);
+                }
+
+                // Go through a tightly packed temporary so that the two textures don't need to
+                // agree on a layout.
+                uint64_t bytesPerRow = blockInfo.ToBytes(copySize.width);
+                uint64_t rowsPerImage = static_cast<uint64_t>(copySize.height);
+                uint64_t imageCount = static_cast<uint64_t>(copySize.depthOrArrayLayers);
+                auto temporary = HeapArray<std::byte>(
+                    checked_cast<size_t>(bytesPerRow * rowsPerImage * imageCount));
+                srcTexture->ReadToLinearData(temporary, bytesPerRow, rowsPerImage, src, copySize);
+                dstTexture->WriteFromLinearData(temporary, bytesPerRow, rowsPerImage, dst,
+                                                copySize);
+                break;
+            }
+
+            case Command::ClearBuffer: {
+                ClearBufferCmd* cmd = mCommands.NextCommand<ClearBufferCmd>();
+                if (cmd->size == 0) {
+                    // Skip no-op fills.
+                    break;
+                }
+
+                std::ranges::fill(ToBackend(cmd->buffer)
+                                      ->GetData()
+                                      .subspan(checked_cast<size_t>(cmd->offset),
+                                               checked_cast<size_t>(cmd->size)),
+                                  std::byte{0});
+                break;
+            }
+
+            case Command::WriteBuffer: {
+                WriteBufferCmd* write = mCommands.NextCommand<WriteBufferCmd>();
+                Span<const std::byte> data = mCommands.NextData<std::byte>(write->size);
+                if (data.empty()) {
+                    break;
+                }
+
+                ToBackend(write->buffer)->DoWriteBuffer(write->offset, data);
+                break;
+            }
+
+            case Command::ResolveQuerySet: {
+                ResolveQuerySetCmd* cmd = mCommands.NextCommand<ResolveQuerySetCmd>();
+                // Queries are never written by the Null backend so resolve them as zeroes.
+                std::ranges::fill(
+                    ToBackend(cmd->destination)
+                        ->GetData()
+                        .subspan(checked_cast<size_t>(cmd->destinationOffset),
+                                 static_cast<size_t>(uint32_t(cmd->queryCount)) * sizeof(uint64_t)),
+                    std::byte{0});
+                break;
+            }
+
+            default:
+                // Render and compute passes are not executed, only their commands are consumed.
+                SkipCommand(&mCommands, type);
+                break;
+        }
+    }
+
+    return {};
+}
+
 // QuerySet
 
 QuerySet::QuerySet(Device* device, const QuerySetDescriptor* descriptor)
@@ -445,10 +650,15 @@ Queue::Queue(Device* device, const QueueDescriptor* descriptor) : QueueBase(devi
 
 Queue::~Queue() {}
 
-MaybeError Queue::SubmitImpl(Span<CommandBufferBase* const>) {
+MaybeError Queue::SubmitImpl(Span<CommandBufferBase* const> commands) {
     Device* device = ToBackend(GetDevice());
 
     DAWN_TRY(device->SubmitPendingOperations());
+    if (device->IsToggleEnabled(Toggle::NullBackendExecuteCommands)) {
+        for (CommandBufferBase* commandBuffer : commands) {
+            DAWN_TRY(ToBackend(commandBuffer)->Execute());
+        }
+    }
     IncrementLastSubmittedCommandSerial();
 
     return {};
@@ -501,14 +711,12 @@ ResultOrError<Extent3D> ComputePipeline::InitializeImpl() {
         .enable_validation_asserts = device->IsToggleEnabled(Toggle::EnableTintIRValidationAsserts),
     };
 
-    // Convert the AST program to an IR module.
-    auto ir = tint::wgsl::reader::ProgramToLoweredIR(computeStage.module->GetTintProgram()->program,
-                                                     irOptions);
-    DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
-                    ir.Failure().reason);
+    // Convert the AST program to an IR module, or load it from the BlobCache.
+    tint::core::ir::Module ir;
+    DAWN_TRY_ASSIGN(ir, computeStage.module->GetLoweredTintIR(irOptions));
 
     tint::Result<tint::null::writer::Output> tintResult =
-        tint::null::writer::Generate(ir.Get(), tintOptions);
+        tint::null::writer::Generate(ir, tintOptions);
 
     DAWN_INVALID_IF(tintResult != tint::Success, "An error occurred while running Null writer\n%s",
                     tintResult.Failure().reason);
@@ -608,6 +816,128 @@ bool Device::CanTextureLoadResolveTargetInTheSameRenderpass() const {
 Texture::Texture(DeviceBase* device, const UnpackedPtr<TextureDescriptor>& descriptor)
     : TextureBase(device, descriptor) {}
 
+const Texture::MipLevelLayout& Texture::GetMipLevelLayout(Aspect aspect, uint32_t mipLevel) const {
+    return mMipLevelLayouts[GetAspectIndex(aspect) * GetNumMipLevels() + mipLevel];
+}
+
+void Texture::EnsureBackingData() {
+    if (!mMipLevelLayouts.empty()) {
+        return;
+    }
+
+    uint64_t size = 0;
+    mMipLevelLayouts.resize(kMaxPlanesPerFormat * GetNumMipLevels());
+    for (Aspect aspect : IterateEnumMask(GetFormat().aspects)) {
+        const TexelBlockInfo& blockInfo = GetFormat().GetAspectInfo(aspect).block;
+        for (uint32_t level = 0; level < GetNumMipLevels(); ++level) {
+            Extent3D levelSize = GetMipLevelSubresourcePhysicalSize(level, aspect);
+            MipLevelLayout& layout =
+                mMipLevelLayouts[GetAspectIndex(aspect) * GetNumMipLevels() + level];
+            layout.offset = size;
+            layout.bytesPerRow =
+                uint64_t((levelSize.width + blockInfo.width - 1) / blockInfo.width) *
+                blockInfo.byteSize;
+            layout.bytesPerImage =
+                layout.bytesPerRow * ((levelSize.height + blockInfo.height - 1) / blockInfo.height);
+            layout.imageCount = levelSize.depthOrArrayLayers;
+            size += layout.bytesPerImage * layout.imageCount;
+        }
+    }
+    mBackingData = HeapArray<std::byte>(checked_cast<size_t>(size));
+}
+
+Span<std::byte> Texture::GetBlockRowData(const TextureCopy& textureCopy,
+                                         uint64_t x,
+                                         uint64_t y,
+                                         uint64_t z,
+                                         uint64_t byteCount) {
+    EnsureBackingData();
+
+    const MipLevelLayout& layout = GetMipLevelLayout(textureCopy.aspect, textureCopy.mipLevel);
+    DAWN_ASSERT(z < layout.imageCount);
+    const uint32_t byteSize = GetBlockInfo(textureCopy).byteSize;
+    return mBackingData.subspan(
+        checked_cast<size_t>(layout.offset + z * layout.bytesPerImage + y * layout.bytesPerRow +
+                             x * byteSize),
+        checked_cast<size_t>(byteCount));
+}
+
+void Texture::WriteFromLinearData(Span<const std::byte> data,
+                                  uint64_t bytesPerRow,
+                                  uint64_t rowsPerImage,
+                                  const TextureCopy& textureCopy,
+                                  const BlockExtent3D& copySize) {
+    const TypedTexelBlockInfo& blockInfo = GetBlockInfo(textureCopy);
+    BlockOrigin3D origin = blockInfo.ToBlock(textureCopy.origin);
+    uint64_t rowSize = blockInfo.ToBytes(copySize.width);
+
+    for (uint64_t z = 0; z < static_cast<uint64_t>(copySize.depthOrArrayLayers); ++z) {
+        for (uint64_t y = 0; y < static_cast<uint64_t>(copySize.height); ++y) {
+            GetBlockRowData(textureCopy, static_cast<uint64_t>(origin.x),
+                            static_cast<uint64_t>(origin.y) + y,
+                            static_cast<uint64_t>(origin.z) + z, rowSize)
+                .CopyFrom(data.subspan(
+                    checked_cast<size_t>((z * rowsPerImage + y) * bytesPerRow),
+                    checked_cast<size_t>(rowSize)));
+        }
+    }
+}
+
+void Texture::ReadToLinearData(Span<std::byte> data,
+                               uint64_t bytesPerRow,
+                               uint64_t rowsPerImage,
+                               const TextureCopy& textureCopy,
+                               const BlockExtent3D& copySize) {
+    const TypedTexelBlockInfo& blockInfo = GetBlockInfo(textureCopy);
+    BlockOrigin3D origin = blockInfo.ToBlock(textureCopy.origin);
+    uint64_t rowSize = blockInfo.ToBytes(copySize.width);
+
+    for (uint64_t z = 0; z < static_cast<uint64_t>(copySize.depthOrArrayLayers); ++z) {
+        for (uint64_t y = 0; y < static_cast<uint64_t>(copySize.height); ++y) {
+            data.subspan(checked_cast<size_t>((z * rowsPerImage + y) * bytesPerRow),
+                         checked_cast<size_t>(rowSize))
+                .CopyFrom(GetBlockRowData(textureCopy, static_cast<uint64_t>(origin.x),
+                                          static_cast<uint64_t>(origin.y) + y,
+                                          static_cast<uint64_t>(origin.z) + z, rowSize));
+        }
+    }
+}
 
+void Texture::EnsureSubresourceContentInitialized(const SubresourceRange& range) {
+    if (!GetDevice()->IsToggleEnabled(Toggle::LazyClearResourceOnFirstUse)) {
+        return;
+    }
+    if (IsSubresourceContentInitialized(range)) {
+        return;
+    }
+
+    EnsureBackingData();
+    for (Aspect aspect : IterateEnumMask(range.aspects)) {
+        for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount;
+             ++level) {
+            for (uint32_t layer = range.baseArrayLayer;
+                 layer < range.baseArrayLayer + range.layerCount; ++layer) {
+                if (IsSubresourceContentInitialized(
+                        SubresourceRange::MakeSingle(aspect, layer, level))) {
+                    continue;
+                }
+
+                // Zero the images of the subresource, which is all the depth slices of the mip
+                // level for 3D textures.
+                const MipLevelLayout& layout = GetMipLevelLayout(aspect, level);
+                bool is3D = GetDimension() == wgpu::TextureDimension::e3D;
+                uint64_t firstImage = is3D ? 0 : layer;
+                uint64_t imageCount = is3D ? layout.imageCount : 1;
+                std::ranges::fill(
+                    mBackingData.subspan(
+                        checked_cast<size_t>(layout.offset + firstImage * layout.bytesPerImage),
+                        checked_cast<size_t>(imageCount * layout.bytesPerImage)),
+                    std::byte{0});
+            }
+        }
+    }
+    SetIsSubresourceContentInitialized(true, range);
+    GetDevice()->IncrementLazyClearCountForTesting();
+}
 
 }  // namespace dawn::native::null
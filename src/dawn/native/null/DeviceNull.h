@@ -270,6 +270,9 @@ class Buffer final : public BufferBase {
 
     void DoWriteBuffer(uint64_t bufferOffset, Span<const std::byte> data);
 
+    // Used to execute commands on the CPU when Toggle::NullBackendExecuteCommands is enabled.
+    Span<std::byte> GetData();
+
   private:
     MaybeError MapAsyncImpl(wgpu::MapMode mode, size_t offset, size_t size) override;
     MaybeError FinalizeMapImpl(BufferState newState) override;
@@ -285,6 +288,10 @@ class Buffer final : public BufferBase {
 class CommandBuffer final : public CommandBufferBase {
   public:
     CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
+
+    // Executes the copies, clears and writes on the CPU. Only called when
+    // Toggle::NullBackendExecuteCommands is enabled.
+    MaybeError Execute();
 };
 
 class QuerySet final : public QuerySetBase {
@@ -360,6 +367,47 @@ class SwapChain final : public SwapChainBase {
 class Texture : public TextureBase {
   public:
     Texture(DeviceBase* device, const UnpackedPtr<TextureDescriptor>& descriptor);
+
+    // The functions below are used to execute commands on the CPU when
+    // Toggle::NullBackendExecuteCommands is enabled. The backing data is allocated lazily and
+    // stores each aspect and mip level as tightly packed rows of texel blocks, with one image per
+    // array layer or depth slice.
+
+    // Copies |copySize| blocks between |data|, laid out with |bytesPerRow| and |rowsPerImage|, and
+    // the region of the texture described by |textureCopy|.
+    void WriteFromLinearData(Span<const std::byte> data,
+                             uint64_t bytesPerRow,
+                             uint64_t rowsPerImage,
+                             const TextureCopy& textureCopy,
+                             const BlockExtent3D& copySize);
+    void ReadToLinearData(Span<std::byte> data,
+                          uint64_t bytesPerRow,
+                          uint64_t rowsPerImage,
+                          const TextureCopy& textureCopy,
+                          const BlockExtent3D& copySize);
+
+    void EnsureSubresourceContentInitialized(const SubresourceRange& range);
+
+  private:
+    struct MipLevelLayout {
+        uint64_t offset = 0;
+        uint64_t bytesPerRow = 0;
+        uint64_t bytesPerImage = 0;
+        uint32_t imageCount = 0;
+    };
+
+    void EnsureBackingData();
+    const MipLevelLayout& GetMipLevelLayout(Aspect aspect, uint32_t mipLevel) const;
+    // Returns the data of the block row |y| of image |z| starting at block |x|.
+    Span<std::byte> GetBlockRowData(const TextureCopy& textureCopy,
+                                    uint64_t x,
+                                    uint64_t y,
+                                    uint64_t z,
+                                    uint64_t byteCount);
+
+    // Indexed by GetAspectIndex(aspect) * GetNumMipLevels() + mipLevel.
+    std::vector<MipLevelLayout> mMipLevelLayouts;
+    HeapArray<std::byte> mBackingData;
 };
 
 }  // namespace dawn::native::null
@@ -85,13 +85,11 @@ ResultOrError<Extent3D> ComputePipeline::InitializeImpl() {
         .enable_validation_asserts =
             GetDevice()->IsToggleEnabled(Toggle::EnableTintIRValidationAsserts),
     };
-    auto ir = tint::wgsl::reader::ProgramToLoweredIR(computeStage.module->GetTintProgram()->program,
-                                                     irOptions);
-    DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
-                    ir.Failure().reason);
+    tint::core::ir::Module ir;
+    DAWN_TRY_ASSIGN(ir, computeStage.module->GetLoweredTintIR(irOptions));
 
     tint::Result<tint::null::writer::Output> tintResult =
-        tint::null::writer::Generate(ir.Get(), tintOptions);
+        tint::null::writer::Generate(ir, tintOptions);
 
     DAWN_INVALID_IF(tintResult != tint::Success, "An error occurred while running Null writer\n%s",
                     tintResult.Failure().reason);
@@ -504,11 +504,9 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
         [](GLSLCompilationRequest r) -> ResultOrError<GLSLCompilation> {
             // Requires Tint Program here right before actual using.
             auto shaderModule = r.inputProgram.UnsafeGetValue();
-            auto inputProgram = shaderModule->GetTintProgram();
             auto device = shaderModule->GetDevice();
-            const tint::Program* tintInputProgram = &(inputProgram->program);
-            // Convert the AST program to an IR module.
-            tint::Result<tint::core::ir::Module> ir;
+            // Convert the AST program to an IR module, or load it from the BlobCache.
+            tint::core::ir::Module ir;
             {
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
                                                    "ShaderModuleProgramToIR");
@@ -517,10 +515,7 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
                     .enable_validation_asserts =
                         device->IsToggleEnabled(Toggle::EnableTintIRValidationAsserts),
                 };
-                ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram, irOptions);
-                DAWN_INVALID_IF(ir != tint::Success,
-                                "An error occurred while generating Tint IR\n%s",
-                                ir.Failure().reason);
+                DAWN_TRY_ASSIGN(ir, shaderModule->GetLoweredTintIR(irOptions));
             }
 
             tint::Result<tint::glsl::writer::Output> result;
@@ -528,7 +523,7 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
                                                    "ShaderModuleGenerateGLSL");
                 // Generate GLSL from Tint IR.
-                result = tint::glsl::writer::Generate(ir.Get(), r.tintOptions);
+                result = tint::glsl::writer::Generate(ir, r.tintOptions);
                 DAWN_INVALID_IF(result != tint::Success,
                                 "An error occurred while generating GLSL:\n%s",
                                 result.Failure().reason);
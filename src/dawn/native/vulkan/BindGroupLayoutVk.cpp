@@ -352,6 +352,14 @@ void BindGroupLayout::DeallocateDescriptorSet(DescriptorSetAllocation* descripto
 
 void BindGroupLayout::ReduceMemoryUsage() {
     mBindGroupAllocator->DeleteEmptySlabs();
+
+    // Return the unused descriptor sets to the pools shared with other layouts so that the pools
+    // can be trimmed once empty.
+    mSpecializations.Use([&](auto specializations) {
+        for (auto& [_, specialized] : *specializations) {
+            specialized.allocator->ReleaseRecycledSets();
+        }
+    });
 }
 
 ResultOrError<std::unique_ptr<OwnedDescriptorSet>> BindGroupLayout::GetSpecializedSetFor(
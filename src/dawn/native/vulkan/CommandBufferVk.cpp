@@ -427,6 +427,8 @@ class ImmediateTracker : public T {
 
 // Records the necessary barriers for a synchronization scope using the resource usage
 // data pre-computed in the frontend. Also performs lazy initialization if required.
+// When VK_KHR_synchronization2 is used, the barriers are only added to the pending barriers of
+// `recordingContext` and the caller must emit them before the commands of the scope.
 MaybeError PrepareResourcesForSyncScope(Device* device,
                                         CommandRecordingContext* recordingContext,
                                         const SyncScopeResourceUsage& scope) {
@@ -439,6 +441,10 @@ MaybeError PrepareResourcesForSyncScope(Device* device,
         DAWN_TRY(ToBackend(table)->ApplyPendingUpdates(recordingContext, writables));
     }
 
+    // With synchronization2 each barrier carries its own stage masks, so the barriers of all
+    // resources are batched without widening the dependencies of any of them.
+    const bool useSynchronization2 = device->IsToggleEnabled(Toggle::VulkanUseSynchronization2);
+
     // Separate barriers with vertex stages in destination stages from all other barriers.
     // This avoids creating unnecessary fragment->vertex dependencies when merging barriers.
     // Eg. merging a compute->vertex barrier and a fragment->fragment barrier would create
@@ -479,7 +485,9 @@ MaybeError PrepareResourcesForSyncScope(Device* device,
         BufferBarrier barrier =
             buffer->TrackUsageAndGetResourceBarrier(usage, scope.bufferSyncInfos[i].shaderStages);
 
-        if (barrier.dstStages & kVertexStages) {
+        if (useSynchronization2) {
+            recordingContext->AddPendingBufferBarrier(barrier);
+        } else if (barrier.dstStages & kVertexStages) {
             vertexBufferBarrier.Merge(barrier);
         } else {
             nonVertexBufferBarrier.Merge(barrier);
@@ -516,7 +524,10 @@ MaybeError PrepareResourcesForSyncScope(Device* device,
         texture->TransitionUsageForPass(recordingContext, scope.textureSyncInfos[i], &imageBarriers,
                                         &srcStages, &dstStages);
 
-        if (!imageBarriers.empty()) {
+        if (useSynchronization2) {
+            recordingContext->AddPendingImageBarriers(imageBarriers, srcStages, dstStages);
+            imageBarriers.clear();
+        } else if (!imageBarriers.empty()) {
             MergeImageBarriers(
                 (dstStages & kVertexStages) ? &vertexImageBarriers : &nonVertexImageBarriers,
                 srcStages, dstStages, imageBarriers);
@@ -530,6 +541,7 @@ MaybeError PrepareResourcesForSyncScope(Device* device,
                                           barriers.dstStages, 0, 0, nullptr, 0, nullptr,
                                           checked_cast<uint32_t>(barriers.imageBarriers.size()),
                                           barriers.imageBarriers.data());
+            device->IncrementPipelineBarrierCountForTesting();
         }
     }
     recordingContext->EmitBufferBarrierIfNecessary(device, vertexBufferBarrier);
@@ -1143,6 +1155,7 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
             ResetUsedQuerySetsOnRenderPass(device, recordingContext->commandBuffer,
                                            usages.querySets[i], usages.queryAvailabilities[i]);
         }
+        recordingContext->EmitPendingBarriers(device);
 
         if (device->IsToggleEnabled(Toggle::VulkanAddWorkToEmptyResolvePass)) {
             DAWN_TRY(device->PrepareEmptyPassQuerySet(recordingContext));
@@ -1598,6 +1611,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
                 DAWN_TRY(PrepareResourcesForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
                 currentDispatch++;
+                recordingContext->EmitPendingBarriers(device);
 
                 DAWN_TRY(state.SyncAndRun([&](const VulkanFunctions& vk, VkCommandBuffer commands) {
                     vk.CmdDispatch(commands, dispatch->x, dispatch->y, dispatch->z);
@@ -1612,6 +1626,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
                 DAWN_TRY(PrepareResourcesForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
                 currentDispatch++;
+                recordingContext->EmitPendingBarriers(device);
 
                 DAWN_TRY(state.SyncAndRun([&](const VulkanFunctions& vk, VkCommandBuffer commands) {
                     vk.CmdDispatchIndirect(commands, indirectBuffer,
@@ -45,6 +45,8 @@ void CommandRecordingContext::EmitBufferBarrierIfNecessary(Device* device,
         return;
     }
 
+    EmitPendingBarriers(device);
+
     VkMemoryBarrier vkBarrier;
     vkBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
     vkBarrier.pNext = nullptr;
@@ -53,6 +55,78 @@ void CommandRecordingContext::EmitBufferBarrierIfNecessary(Device* device,
 
     device->fn.CmdPipelineBarrier(commandBuffer, barrier.srcStages, barrier.dstStages, 0, 1,
                                   &vkBarrier, 0, nullptr, 0, nullptr);
+    device->IncrementPipelineBarrierCountForTesting();
+}
+
+void CommandRecordingContext::AddPendingBufferBarrier(const BufferBarrier& barrier) {
+    if (barrier.IsEmpty()) {
+        return;
+    }
+
+    // The legacy stage and access flags have the same values as their synchronization2
+    // equivalents.
+    for (VkMemoryBarrier2KHR& pending : pendingMemoryBarriers) {
+        if (pending.srcStageMask == barrier.srcStages &&
+            pending.dstStageMask == barrier.dstStages) {
+            pending.srcAccessMask |= barrier.srcAccessMask;
+            pending.dstAccessMask |= barrier.dstAccessMask;
+            return;
+        }
+    }
+
+    VkMemoryBarrier2KHR vkBarrier;
+    vkBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+    vkBarrier.pNext = nullptr;
+    vkBarrier.srcStageMask = barrier.srcStages;
+    vkBarrier.srcAccessMask = barrier.srcAccessMask;
+    vkBarrier.dstStageMask = barrier.dstStages;
+    vkBarrier.dstAccessMask = barrier.dstAccessMask;
+    pendingMemoryBarriers.push_back(vkBarrier);
+}
+
+void CommandRecordingContext::AddPendingImageBarriers(
+    const std::vector<VkImageMemoryBarrier>& barriers,
+    VkPipelineStageFlags srcStages,
+    VkPipelineStageFlags dstStages) {
+    for (const VkImageMemoryBarrier& barrier : barriers) {
+        VkImageMemoryBarrier2KHR vkBarrier;
+        vkBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+        vkBarrier.pNext = nullptr;
+        vkBarrier.srcStageMask = srcStages;
+        vkBarrier.srcAccessMask = barrier.srcAccessMask;
+        vkBarrier.dstStageMask = dstStages;
+        vkBarrier.dstAccessMask = barrier.dstAccessMask;
+        vkBarrier.oldLayout = barrier.oldLayout;
+        vkBarrier.newLayout = barrier.newLayout;
+        vkBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+        vkBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+        vkBarrier.image = barrier.image;
+        vkBarrier.subresourceRange = barrier.subresourceRange;
+        pendingImageBarriers.push_back(vkBarrier);
+    }
+}
+
+void CommandRecordingContext::EmitPendingBarriers(Device* device) {
+    if (pendingMemoryBarriers.empty() && pendingImageBarriers.empty()) {
+        return;
+    }
+
+    VkDependencyInfoKHR dependencyInfo;
+    dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+    dependencyInfo.pNext = nullptr;
+    dependencyInfo.dependencyFlags = 0;
+    dependencyInfo.memoryBarrierCount = checked_cast<uint32_t>(pendingMemoryBarriers.size());
+    dependencyInfo.pMemoryBarriers = pendingMemoryBarriers.data();
+    dependencyInfo.bufferMemoryBarrierCount = 0;
+    dependencyInfo.pBufferMemoryBarriers = nullptr;
+    dependencyInfo.imageMemoryBarrierCount = checked_cast<uint32_t>(pendingImageBarriers.size());
+    dependencyInfo.pImageMemoryBarriers = pendingImageBarriers.data();
+
+    device->fn.CmdPipelineBarrier2KHR(commandBuffer, &dependencyInfo);
+    device->IncrementPipelineBarrierCountForTesting();
+
+    pendingMemoryBarriers.clear();
+    pendingImageBarriers.clear();
 }
 
 }  // namespace dawn::native::vulkan
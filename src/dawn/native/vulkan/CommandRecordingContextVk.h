@@ -93,7 +93,23 @@ struct CommandRecordingContext {
     // is transitioned back to map usage(s) at the end of the submit.
     void CheckBufferNeedsEagerTransition(Buffer* buffer, wgpu::BufferUsage usage);
 
+    // Records `barrier` immediately, after any pending barriers.
     void EmitBufferBarrierIfNecessary(Device* device, const BufferBarrier& barrier);
+
+    // When VK_KHR_synchronization2 is used, the barriers of synchronization scopes are accumulated
+    // here with per-resource stage masks instead of being recorded immediately. They are recorded
+    // by a single vkCmdPipelineBarrier2 in EmitPendingBarriers, which must be called before any
+    // command that depends on them. Barriers recorded immediately emit the pending ones first so
+    // that the order of transitions is preserved.
+    std::vector<VkMemoryBarrier2KHR> pendingMemoryBarriers;
+    std::vector<VkImageMemoryBarrier2KHR> pendingImageBarriers;
+
+    // Buffer barriers are global memory barriers, so barriers with the same stages are merged.
+    void AddPendingBufferBarrier(const BufferBarrier& barrier);
+    void AddPendingImageBarriers(const std::vector<VkImageMemoryBarrier>& barriers,
+                                 VkPipelineStageFlags srcStages,
+                                 VkPipelineStageFlags dstStages);
+    void EmitPendingBarriers(Device* device);
 };
 
 }  // namespace dawn::native::vulkan
@@ -35,8 +35,8 @@ namespace dawn::native::vulkan {
 // Contains a descriptor set along with data necessary to track its allocation.
 struct DescriptorSetAllocation {
     VkDescriptorSet set = VK_NULL_HANDLE;
+    // The index of the pool in the DescriptorPoolAllocator the set was allocated from.
     uint32_t poolIndex;
-    uint16_t setIndex;
 };
 
 }  // namespace dawn::native::vulkan
@@ -44,21 +44,33 @@ namespace dawn::native::vulkan {
 // increase up to a larger constant.
 static constexpr uint32_t kMaxDescriptorsPerPool = 512;
 
+// The number of serials a pool needs to stay empty before Trim() destroys it.
+static constexpr uint64_t kIdlePoolTrimSerialCount = 8;
+
+// DescriptorPoolAllocator
+
 // static
-Ref<DescriptorSetAllocator> DescriptorSetAllocator::Create(
-    Device* device,
-    absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType) {
-    return AcquireRef(new DescriptorSetAllocator(device, descriptorCountPerType));
+DescriptorPoolAllocator::DescriptorCounts DescriptorPoolAllocator::GetDescriptorCounts(
+    const absl::flat_hash_map<VkDescriptorType, uint32_t>& descriptorCountPerType) {
+    DescriptorCounts counts(descriptorCountPerType.begin(), descriptorCountPerType.end());
+    std::sort(counts.begin(), counts.end());
+    return counts;
 }
 
-DescriptorSetAllocator::DescriptorSetAllocator(
+// static
+Ref<DescriptorPoolAllocator> DescriptorPoolAllocator::Create(
     Device* device,
-    absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType)
+    const DescriptorCounts& descriptorCounts) {
+    return AcquireRef(new DescriptorPoolAllocator(device, descriptorCounts));
+}
+
+DescriptorPoolAllocator::DescriptorPoolAllocator(Device* device,
+                                                 const DescriptorCounts& descriptorCounts)
     : mDevice(device) {
     // Compute the total number of descriptors for this layout.
     uint32_t totalDescriptorCount = 0;
-    mPoolSizes.reserve(descriptorCountPerType.size());
-    for (const auto& [type, count] : descriptorCountPerType) {
+    mPoolSizes.reserve(descriptorCounts.size());
+    for (const auto& [type, count] : descriptorCounts) {
         DAWN_CHECK(count > 0);
         totalDescriptorCount += count;
         mPoolSizes.push_back(VkDescriptorPoolSize{type, count});
@@ -70,8 +82,7 @@ DescriptorSetAllocator::DescriptorSetAllocator(
     // Compute the total number of descriptors sets that fits given the max but always make sure
     // that at least one descriptor set can be made (bindings with visibility none can force giant
     // sets to be made).
-    mMaxSets = checked_cast<SetIndex>(std::max(kMaxDescriptorsPerPool / totalDescriptorCount, 1u));
-    DAWN_CHECK(mMaxSets > 0);
+    mMaxSets = std::max(kMaxDescriptorsPerPool / totalDescriptorCount, 1u);
 
     // Grow the number of descriptors in the pool to fit the computed |mMaxSets|.
     for (auto& poolSize : mPoolSizes) {
@@ -79,94 +90,107 @@ DescriptorSetAllocator::DescriptorSetAllocator(
     }
 }
 
-DescriptorSetAllocator::~DescriptorSetAllocator() {
+DescriptorPoolAllocator::~DescriptorPoolAllocator() {
     for (auto& pool : mDescriptorPools) {
-        DAWN_ASSERT(pool.freeSetIndices.size() == mMaxSets);
-        if (pool.vkPool != VK_NULL_HANDLE) {
-            mDevice->GetFencedDeleter()->DeleteWhenUnused(pool.vkPool);
+        if (pool.vkPool == VK_NULL_HANDLE || pool.leaked) {
+            continue;
         }
+        DAWN_ASSERT(pool.allocatedSetCount == 0);
+        mDevice->GetFencedDeleter()->DeleteWhenUnused(pool.vkPool);
     }
 }
 
-ResultOrError<DescriptorSetAllocation> DescriptorSetAllocator::Allocate(
+ResultOrError<DescriptorSetAllocation> DescriptorPoolAllocator::AllocateSet(
     VkDescriptorSetLayout dsLayout) {
     Mutex::AutoLock lock(&mMutex);
 
-    if (mAvailableDescriptorPoolIndices.empty()) {
-        DAWN_TRY(AllocateDescriptorPool(dsLayout));
+    // Try the pools with space left first, most recently created or freed first. Pools that fail
+    // because of fragmentation are removed from the available pools by AllocateSetFromPool().
+    while (!mAvailablePoolIndices.empty()) {
+        PoolIndex poolIndex = mAvailablePoolIndices.back();
+        std::optional<VkDescriptorSet> set;
+        DAWN_TRY_ASSIGN(set, AllocateSetFromPool(poolIndex, dsLayout));
+        if (set.has_value()) {
+            return DescriptorSetAllocation{*set, poolIndex};
+        }
     }
 
-    DAWN_ASSERT(!mAvailableDescriptorPoolIndices.empty());
+    PoolIndex poolIndex;
+    DAWN_TRY_ASSIGN(poolIndex, CreateDescriptorPool());
 
-    const PoolIndex poolIndex = mAvailableDescriptorPoolIndices.back();
-    DescriptorPool* pool = &mDescriptorPools[poolIndex];
-
-    DAWN_ASSERT(!pool->freeSetIndices.empty());
-
-    SetIndex setIndex = pool->freeSetIndices.back();
-    pool->freeSetIndices.pop_back();
-
-    if (pool->freeSetIndices.empty()) {
-        mAvailableDescriptorPoolIndices.pop_back();
+    std::optional<VkDescriptorSet> set;
+    DAWN_TRY_ASSIGN(set, AllocateSetFromPool(poolIndex, dsLayout));
+    if (!set.has_value()) {
+        return DAWN_INTERNAL_ERROR("Failed to allocate a descriptor set from a new pool.");
     }
-
-    return DescriptorSetAllocation{pool->sets[setIndex], poolIndex, setIndex};
+    return DescriptorSetAllocation{*set, poolIndex};
 }
 
-void DescriptorSetAllocator::Deallocate(DescriptorSetAllocation* allocationInfo) {
-    bool enqueueDeferredDeallocation = false;
+void DescriptorPoolAllocator::FreeSets(std::span<const DescriptorSetAllocation> allocations) {
+    Mutex::AutoLock lock(&mMutex);
 
-    {
-        Mutex::AutoLock lock(&mMutex);
+    for (const DescriptorSetAllocation& allocation : allocations) {
+        DAWN_ASSERT(allocation.poolIndex < mDescriptorPools.size());
+        DescriptorPool& pool = mDescriptorPools[allocation.poolIndex];
+        DAWN_ASSERT(pool.vkPool != VK_NULL_HANDLE);
+        DAWN_ASSERT(pool.allocatedSetCount > 0);
 
-        DAWN_ASSERT(allocationInfo != nullptr);
-        DAWN_ASSERT(allocationInfo->set != VK_NULL_HANDLE);
+        mDevice->fn.FreeDescriptorSets(mDevice->GetVkDevice(), pool.vkPool, 1,
+                                       AsVkArray(&allocation.set));
+        pool.allocatedSetCount--;
+        pool.exhausted = false;
 
-        // We can't reuse the descriptor set right away because the Vulkan spec says in the
-        // documentation for vkCmdBindDescriptorSets that the set may be consumed any time between
-        // host execution (on "bindful" GPU that inline the descriptors in the command stream) of
-        // the command and the end of the draw/dispatch (for "bindless" GPUs where shaders read
-        // directly from the VkDescriptorPool).
-        const ExecutionSerial serial = mDevice->GetQueue()->GetPendingCommandSerial();
-        mPendingDeallocations.Enqueue({allocationInfo->poolIndex, allocationInfo->setIndex},
-                                      serial);
+        if (!pool.available && !pool.leaked) {
+            pool.available = true;
+            mAvailablePoolIndices.push_back(allocation.poolIndex);
+        }
+    }
+}
 
-        if (mLastDeallocationSerial != serial) {
-            enqueueDeferredDeallocation = true;
-            mLastDeallocationSerial = serial;
+void DescriptorPoolAllocator::Trim(ExecutionSerial completedSerial) {
+    Mutex::AutoLock lock(&mMutex);
+
+    bool trimmedAny = false;
+    for (DescriptorPool& pool : mDescriptorPools) {
+        if (pool.vkPool == VK_NULL_HANDLE || pool.leaked || pool.allocatedSetCount > 0) {
+            continue;
+        }
+        if (!pool.idleSince.has_value()) {
+            pool.idleSince = completedSerial;
+            continue;
+        }
+        if (completedSerial < *pool.idleSince + ExecutionSerial(kIdlePoolTrimSerialCount)) {
+            continue;
         }
 
-        // Clear the content of the allocation so that use after frees are more visible.
-        *allocationInfo = {};
+        mDevice->GetFencedDeleter()->DeleteWhenUnused(pool.vkPool);
+        pool = {};
+        trimmedAny = true;
     }
 
-    if (enqueueDeferredDeallocation) {
-        // Release lock before calling EnqueueDeferredDeallocation() to avoid lock acquisition
-        // order inversion with lock used there.
-        mDevice->EnqueueDeferredDeallocation(this);
+    if (trimmedAny) {
+        std::erase_if(mAvailablePoolIndices, [&](PoolIndex poolIndex) {
+            return !mDescriptorPools[poolIndex].available;
+        });
     }
 }
 
-void DescriptorSetAllocator::FinishDeallocation(ExecutionSerial completedSerial) {
+size_t DescriptorPoolAllocator::GetPoolCountForTesting() {
     Mutex::AutoLock lock(&mMutex);
-
-    for (const Deallocation& dealloc : mPendingDeallocations.IterateUpTo(completedSerial)) {
-        DAWN_ASSERT(dealloc.poolIndex < mDescriptorPools.size());
-
-        auto& freeSetIndices = mDescriptorPools[dealloc.poolIndex].freeSetIndices;
-        if (freeSetIndices.empty()) {
-            mAvailableDescriptorPoolIndices.emplace_back(dealloc.poolIndex);
+    size_t count = 0;
+    for (const DescriptorPool& pool : mDescriptorPools) {
+        if (pool.vkPool != VK_NULL_HANDLE) {
+            count++;
         }
-        freeSetIndices.emplace_back(dealloc.setIndex);
     }
-    mPendingDeallocations.ClearUpTo(completedSerial);
+    return count;
 }
 
-MaybeError DescriptorSetAllocator::AllocateDescriptorPool(VkDescriptorSetLayout dsLayout) {
+ResultOrError<DescriptorPoolAllocator::PoolIndex> DescriptorPoolAllocator::CreateDescriptorPool() {
     VkDescriptorPoolCreateInfo createInfo;
     createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     createInfo.pNext = nullptr;
-    createInfo.flags = 0;
+    createInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
     createInfo.maxSets = mMaxSets;
     createInfo.poolSizeCount = checked_cast<uint32_t>(mPoolSizes.size());
     createInfo.pPoolSizes = mPoolSizes.data();
@@ -176,20 +200,50 @@ MaybeError DescriptorSetAllocator::AllocateDescriptorPool(VkDescriptorSetLayout
                                                              nullptr, &*descriptorPool),
                             "CreateDescriptorPool"));
 
-    std::vector<VkDescriptorSetLayout> layouts(mMaxSets, dsLayout);
+    // Reuse the slot of a trimmed pool if there is one.
+    auto it = std::find_if(mDescriptorPools.begin(), mDescriptorPools.end(),
+                           [](const DescriptorPool& pool) { return pool.vkPool == VK_NULL_HANDLE; });
+    PoolIndex poolIndex = checked_cast<PoolIndex>(it - mDescriptorPools.begin());
+    if (it == mDescriptorPools.end()) {
+        mDescriptorPools.emplace_back();
+    }
+
+    DescriptorPool& pool = mDescriptorPools[poolIndex];
+    pool.vkPool = descriptorPool;
+    pool.available = true;
+    mAvailablePoolIndices.push_back(poolIndex);
+
+    return poolIndex;
+}
+
+ResultOrError<std::optional<VkDescriptorSet>> DescriptorPoolAllocator::AllocateSetFromPool(
+    PoolIndex poolIndex,
+    VkDescriptorSetLayout dsLayout) {
+    DescriptorPool& pool = mDescriptorPools[poolIndex];
+    DAWN_ASSERT(pool.available && !pool.exhausted);
+    DAWN_ASSERT(pool.allocatedSetCount < mMaxSets);
 
     VkDescriptorSetAllocateInfo allocateInfo;
     allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     allocateInfo.pNext = nullptr;
-    allocateInfo.descriptorPool = descriptorPool;
-    allocateInfo.descriptorSetCount = mMaxSets;
-    allocateInfo.pSetLayouts = AsVkArray(layouts.data());
+    allocateInfo.descriptorPool = pool.vkPool;
+    allocateInfo.descriptorSetCount = 1;
+    allocateInfo.pSetLayouts = &*dsLayout;
 
-    std::vector<VkDescriptorSet> sets(mMaxSets);
+    VkDescriptorSet set;
     VkResult vkResult = VkResult::WrapUnsafe(
-        INJECT_ERROR_OR_RUN(mDevice->fn.AllocateDescriptorSets(
-                                mDevice->GetVkDevice(), &allocateInfo, AsVkArray(sets.data())),
+        INJECT_ERROR_OR_RUN(mDevice->fn.AllocateDescriptorSets(mDevice->GetVkDevice(),
+                                                               &allocateInfo, &*set),
                             VK_FAKE_ERROR_FOR_TESTING));
+
+    // Freed sets can leave the pool too fragmented for the layout even though it isn't full. Fall
+    // back to other pools until sets of this pool are freed.
+    if (vkResult == VK_ERROR_OUT_OF_POOL_MEMORY || vkResult == VK_ERROR_FRAGMENTED_POOL) {
+        pool.exhausted = true;
+        MarkPoolUnavailable(poolIndex);
+        return std::optional<VkDescriptorSet>{};
+    }
+
     MaybeError result = CheckVkSuccessImpl(vkResult, "AllocateDescriptorSets");
     if (result.IsError()) {
         // TODO(crbug.com/549311485): On Imagination (PowerVR) drivers, when AllocateDescriptorSets
@@ -199,25 +253,117 @@ MaybeError DescriptorSetAllocator::AllocateDescriptorPool(VkDescriptorSetLayout
         bool isCorruptedImaginationPool =
             gpu_info::IsImgTec(mDevice->GetPhysicalDevice()->GetVendorId()) &&
             (vkResult == VK_ERROR_OUT_OF_HOST_MEMORY || vkResult == VK_ERROR_OUT_OF_DEVICE_MEMORY);
-        if (!isCorruptedImaginationPool) {
-            // On an error we can destroy the pool immediately because no command references it.
-            mDevice->fn.DestroyDescriptorPool(mDevice->GetVkDevice(), descriptorPool, nullptr);
+        if (isCorruptedImaginationPool) {
+            pool.leaked = true;
+            MarkPoolUnavailable(poolIndex);
         }
     }
     DAWN_TRY(std::move(result));
 
-    std::vector<SetIndex> freeSetIndices;
-    freeSetIndices.reserve(mMaxSets);
+    pool.allocatedSetCount++;
+    pool.idleSince.reset();
+    if (pool.allocatedSetCount == mMaxSets) {
+        MarkPoolUnavailable(poolIndex);
+    }
+
+    return std::optional<VkDescriptorSet>{set};
+}
 
-    for (SetIndex i = 0; i < mMaxSets; ++i) {
-        freeSetIndices.push_back(i);
+void DescriptorPoolAllocator::MarkPoolUnavailable(PoolIndex poolIndex) {
+    DescriptorPool& pool = mDescriptorPools[poolIndex];
+    if (!pool.available) {
+        return;
     }
+    pool.available = false;
+    auto it = std::find(mAvailablePoolIndices.begin(), mAvailablePoolIndices.end(), poolIndex);
+    DAWN_ASSERT(it != mAvailablePoolIndices.end());
+    mAvailablePoolIndices.erase(it);
+}
+
+// DescriptorSetAllocator
+
+// static
+Ref<DescriptorSetAllocator> DescriptorSetAllocator::Create(
+    Device* device,
+    absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType) {
+    return AcquireRef(new DescriptorSetAllocator(
+        device, device->GetOrCreateDescriptorPoolAllocator(descriptorCountPerType)));
+}
+
+DescriptorSetAllocator::DescriptorSetAllocator(Device* device,
+                                               Ref<DescriptorPoolAllocator> poolAllocator)
+    : mPoolAllocator(std::move(poolAllocator)), mDevice(device) {}
+
+DescriptorSetAllocator::~DescriptorSetAllocator() {
+    DAWN_ASSERT(mPendingDeallocations.Empty());
+    mPoolAllocator->FreeSets(mRecycledSets);
+}
+
+ResultOrError<DescriptorSetAllocation> DescriptorSetAllocator::Allocate(
+    VkDescriptorSetLayout dsLayout) {
+    Mutex::AutoLock lock(&mMutex);
 
-    mAvailableDescriptorPoolIndices.push_back(checked_cast<PoolIndex>(mDescriptorPools.size()));
-    mDescriptorPools.emplace_back(
-        DescriptorPool{descriptorPool, std::move(sets), std::move(freeSetIndices)});
+    // Sets can only be reused with the layout they were allocated with.
+    DAWN_ASSERT(mLayout == VK_NULL_HANDLE || mLayout == dsLayout);
+    mLayout = dsLayout;
+
+    if (!mRecycledSets.empty()) {
+        DescriptorSetAllocation allocation = mRecycledSets.back();
+        mRecycledSets.pop_back();
+        return allocation;
+    }
+
+    return mPoolAllocator->AllocateSet(dsLayout);
+}
+
+void DescriptorSetAllocator::Deallocate(DescriptorSetAllocation* allocationInfo) {
+    bool enqueueDeferredDeallocation = false;
+
+    {
+        Mutex::AutoLock lock(&mMutex);
+
+        DAWN_ASSERT(allocationInfo != nullptr);
+        DAWN_ASSERT(allocationInfo->set != VK_NULL_HANDLE);
+
+        // We can't reuse the descriptor set right away because the Vulkan spec says in the
+        // documentation for vkCmdBindDescriptorSets that the set may be consumed any time between
+        // host execution (on "bindful" GPU that inline the descriptors in the command stream) of
+        // the command and the end of the draw/dispatch (for "bindless" GPUs where shaders read
+        // directly from the VkDescriptorPool).
+        const ExecutionSerial serial = mDevice->GetQueue()->GetPendingCommandSerial();
+        mPendingDeallocations.Enqueue(*allocationInfo, serial);
+
+        if (mLastDeallocationSerial != serial) {
+            enqueueDeferredDeallocation = true;
+            mLastDeallocationSerial = serial;
+        }
+
+        // Clear the content of the allocation so that use after frees are more visible.
+        *allocationInfo = {};
+    }
+
+    if (enqueueDeferredDeallocation) {
+        // Release lock before calling EnqueueDeferredDeallocation() to avoid lock acquisition
+        // order inversion with lock used there.
+        mDevice->EnqueueDeferredDeallocation(this);
+    }
+}
+
+void DescriptorSetAllocator::FinishDeallocation(ExecutionSerial completedSerial) {
+    Mutex::AutoLock lock(&mMutex);
+
+    for (const DescriptorSetAllocation& allocation :
+         mPendingDeallocations.IterateUpTo(completedSerial)) {
+        mRecycledSets.push_back(allocation);
+    }
+    mPendingDeallocations.ClearUpTo(completedSerial);
+}
+
+void DescriptorSetAllocator::ReleaseRecycledSets() {
+    Mutex::AutoLock lock(&mMutex);
 
-    return {};
+    mPoolAllocator->FreeSets(mRecycledSets);
+    mRecycledSets.clear();
 }
 
 }  // namespace dawn::native::vulkan
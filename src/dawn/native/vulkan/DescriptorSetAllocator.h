@@ -28,7 +28,9 @@
 #ifndef SRC_DAWN_NATIVE_VULKAN_DESCRIPTORSETALLOCATOR_H_
 #define SRC_DAWN_NATIVE_VULKAN_DESCRIPTORSETALLOCATOR_H_
 
-#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
@@ -47,63 +49,106 @@ class Device;
 
 // Vulkan requires that descriptor sets are sub-allocated from pre-created pools of descriptors.
 // Creating one pool per descriptor set is inefficient as each pool might be a different GPU
-// allocation (causing syscalls etc). This class handles allocating larger pools and reusing
-// sub-allocations when descriptor sets are no longer in use.
+// allocation (causing syscalls etc), and creating pools per BindGroupLayout leaves applications
+// with many layouts holding many mostly empty pools.
 //
-// Pools are allocated to be a multiple of the size required by a BindGroupLayout (multidimensional,
-// one per-type of descriptor) and all the descriptor sets for a layout created immediately. This is
-// necessary because the Vulkan spec doesn't require drivers to implement anything for
-// VkDescriptorPool but a simple bump allocator (with the ability to roll back one allocation).
-// Instead we allocate all the descriptors sets and overwrite over time.
-// TODO(https://crbug.com/439522242): We could reuse allocators between BindGroupLayouts with the
-// same amount of descriptors if we added logic to be resilient to vkAllocateDescriptorSet failures
-// and some form of GCing / repointing of the dawn::native::vulkan::BindGroupLayout.
+// DescriptorPoolAllocator owns the VkDescriptorPools for one set of descriptor counts per type
+// and is shared by all the layouts with the same counts (see
+// Device::GetOrCreateDescriptorPoolAllocator). Pools are sized for a multiple of these counts and
+// created with VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT so that descriptor sets of
+// different VkDescriptorSetLayouts can be allocated and freed individually. Because freeing can
+// fragment a pool, allocations that fail with VK_ERROR_OUT_OF_POOL_MEMORY or
+// VK_ERROR_FRAGMENTED_POOL fall back to another pool. Pools that stay empty are destroyed by
+// Trim().
+class DescriptorPoolAllocator : public RefCounted {
+    using PoolIndex = uint32_t;
+
+  public:
+    // The descriptor counts per type sorted by type, used to find compatible allocators.
+    using DescriptorCounts = std::vector<std::pair<VkDescriptorType, uint32_t>>;
+    static DescriptorCounts GetDescriptorCounts(
+        const absl::flat_hash_map<VkDescriptorType, uint32_t>& descriptorCountPerType);
+
+    static Ref<DescriptorPoolAllocator> Create(Device* device,
+                                               const DescriptorCounts& descriptorCounts);
+
+    ResultOrError<DescriptorSetAllocation> AllocateSet(VkDescriptorSetLayout dsLayout);
+    // The sets must no longer be used by the GPU.
+    void FreeSets(std::span<const DescriptorSetAllocation> allocations);
+
+    // Destroys the pools that have had no sets allocated for a few serials.
+    void Trim(ExecutionSerial completedSerial);
+
+    size_t GetPoolCountForTesting();
+
+  private:
+    DescriptorPoolAllocator(Device* device, const DescriptorCounts& descriptorCounts);
+    ~DescriptorPoolAllocator() override;
+
+    ResultOrError<PoolIndex> CreateDescriptorPool();
+    // Returns std::nullopt if the pool doesn't have enough memory left for the set.
+    ResultOrError<std::optional<VkDescriptorSet>> AllocateSetFromPool(
+        PoolIndex poolIndex,
+        VkDescriptorSetLayout dsLayout);
+    void MarkPoolUnavailable(PoolIndex poolIndex);
+
+    std::vector<VkDescriptorPoolSize> mPoolSizes;
+    uint32_t mMaxSets;
+
+    struct DescriptorPool {
+        // VK_NULL_HANDLE if the pool was trimmed, in which case the slot can be reused.
+        VkDescriptorPool vkPool = VK_NULL_HANDLE;
+        uint32_t allocatedSetCount = 0;
+        // Whether the pool is in mAvailablePoolIndices.
+        bool available = false;
+        // Set when an allocation failed with the pool not full, because of fragmentation.
+        // Cleared when sets are freed.
+        bool exhausted = false;
+        // Pools hit by the Imagination driver bug below must never be destroyed.
+        bool leaked = false;
+        // The first completed serial at which Trim() saw the pool empty.
+        std::optional<ExecutionSerial> idleSince;
+    };
+    std::vector<DescriptorPool> mDescriptorPools;
+    std::vector<PoolIndex> mAvailablePoolIndices;
+
+    // Used to guard all public member functions.
+    Mutex mMutex;
+
+    const raw_ptr<Device> mDevice;
+};
+
+// Allocates the descriptor sets for a single VkDescriptorSetLayout out of the shared
+// DescriptorPoolAllocator for its descriptor counts. Descriptor sets that are no longer in use are
+// kept to be reused by the layout, since a set can only be used with the layout it was allocated
+// for, until ReleaseRecycledSets() returns them to the pools.
 //
 // It is RefCounted because when descriptor set is destroyed, the allocator is added to a
 // notification queue on the device to get called back when the queue serial is completed. As such
 // it has multiple owners: the BindGroupLayout it corresponds to, and sometimes the device as well.
 class DescriptorSetAllocator : public RefCounted {
-    using PoolIndex = uint32_t;
-    using SetIndex = uint16_t;
-
   public:
-    // TODO(crbug.com/439522242): Note that allocators cannot be shared across layouts with matching
-    // descriptor counts if their VkDescriptorSetLayouts differ (e.g. immutable
-    // samplers argument change with default and YCbCr samplers), because sets are sub-allocated
-    // from pools using the layout passed to the first Allocate() call. Consider adding a
-    // descriptor set layout parameter if reusing allocators.
     static Ref<DescriptorSetAllocator> Create(
         Device* device,
         absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType);
 
+    // Must always be called with the same `dsLayout`.
     ResultOrError<DescriptorSetAllocation> Allocate(VkDescriptorSetLayout dsLayout);
     void Deallocate(DescriptorSetAllocation* allocationInfo);
     void FinishDeallocation(ExecutionSerial completedSerial);
 
+    // Returns the descriptor sets that are no longer in use to the shared pools.
+    void ReleaseRecycledSets();
+
   private:
-    DescriptorSetAllocator(Device* device,
-                           absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType);
+    DescriptorSetAllocator(Device* device, Ref<DescriptorPoolAllocator> poolAllocator);
     ~DescriptorSetAllocator() override;
 
-    MaybeError AllocateDescriptorPool(VkDescriptorSetLayout dsLayout);
+    Ref<DescriptorPoolAllocator> mPoolAllocator;
+    VkDescriptorSetLayout mLayout = VK_NULL_HANDLE;
 
-    std::vector<VkDescriptorPoolSize> mPoolSizes;
-    SetIndex mMaxSets;
-
-    struct DescriptorPool {
-        VkDescriptorPool vkPool;
-        std::vector<VkDescriptorSet> sets;
-        std::vector<SetIndex> freeSetIndices;
-    };
-
-    std::vector<PoolIndex> mAvailableDescriptorPoolIndices;
-    std::vector<DescriptorPool> mDescriptorPools;
-
-    struct Deallocation {
-        PoolIndex poolIndex;
-        SetIndex setIndex;
-    };
-    SerialQueue<ExecutionSerial, Deallocation> mPendingDeallocations;
+    std::vector<DescriptorSetAllocation> mRecycledSets;
+    SerialQueue<ExecutionSerial, DescriptorSetAllocation> mPendingDeallocations;
     ExecutionSerial mLastDeallocationSerial = ExecutionSerial(0u);
 
     // Used to guard all public member functions.
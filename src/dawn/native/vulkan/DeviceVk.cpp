@@ -380,6 +380,12 @@ MaybeError Device::TickImpl() {
         pending->ClearUpTo(completedSerial);
     });
 
+    mDescriptorPoolAllocators.Use([&](auto allocators) {
+        for (auto& [_, allocator] : *allocators) {
+            allocator->Trim(completedSerial);
+        }
+    });
+
     GetResourceMemoryAllocator()->Tick(completedSerial);
 
     DAWN_TRY(queue->SubmitPendingCommands());
@@ -441,6 +447,29 @@ void Device::EnqueueDeferredDeallocation(DescriptorSetAllocator* allocator) {
                                                       GetQueue()->GetPendingCommandSerial());
 }
 
+Ref<DescriptorPoolAllocator> Device::GetOrCreateDescriptorPoolAllocator(
+    const absl::flat_hash_map<VkDescriptorType, uint32_t>& descriptorCountPerType) {
+    DescriptorPoolAllocator::DescriptorCounts descriptorCounts =
+        DescriptorPoolAllocator::GetDescriptorCounts(descriptorCountPerType);
+    return mDescriptorPoolAllocators.Use([&](auto allocators) {
+        auto [it, inserted] = allocators->try_emplace(descriptorCounts);
+        if (inserted) {
+            it->second = DescriptorPoolAllocator::Create(this, descriptorCounts);
+        }
+        return it->second;
+    });
+}
+
+size_t Device::GetDescriptorPoolCountForTesting() {
+    return mDescriptorPoolAllocators.Use([&](auto allocators) {
+        size_t count = 0;
+        for (auto& [_, allocator] : *allocators) {
+            count += allocator->GetPoolCountForTesting();
+        }
+        return count;
+    });
+}
+
 void Device::CacheStaticSampler(const Ref<Sampler>& s) {
     mStaticSamplerCache.insert(s);
 }
@@ -582,6 +611,18 @@ ResultOrError<VulkanDeviceKnobs> Device::CreateDevice(VkPhysicalDevice vkPhysica
         usedKnobs.features.samplerAnisotropy = VK_TRUE;
     }
 
+    if (IsToggleEnabled(Toggle::VulkanUseTimelineSemaphore)) {
+        DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::TimelineSemaphore));
+        usedKnobs.timelineSemaphoreFeatures = mDeviceInfo.timelineSemaphoreFeatures;
+        featuresChain.Add(&usedKnobs.timelineSemaphoreFeatures);
+    }
+
+    if (IsToggleEnabled(Toggle::VulkanUseSynchronization2)) {
+        DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::Synchronization2));
+        usedKnobs.synchronization2Features = mDeviceInfo.synchronization2Features;
+        featuresChain.Add(&usedKnobs.synchronization2Features);
+    }
+
     if (IsToggleEnabled(Toggle::UseVulkanMemoryModel)) {
         DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::VulkanMemoryModel));
         usedKnobs.vulkanMemoryModelFeatures = mDeviceInfo.vulkanMemoryModelFeatures;
@@ -1112,6 +1153,9 @@ void Device::DestroyImpl(DestroyReason reason) {
         pending->ClearUpTo(kMaxExecutionSerial);
     });
 
+    // DescriptorSetAllocators still alive keep a reference to their DescriptorPoolAllocator.
+    mDescriptorPoolAllocators->clear();
+
     // mResourceMemoryAllocator may not be created if the device creation fails before its creation.
     // For example, as mResourceMemoryAllocator is created with a queue, it won't be created when
     // an error happens when creating the queue.
@@ -101,6 +101,11 @@ class Device final : public DeviceBase {
 
     void EnqueueDeferredDeallocation(DescriptorSetAllocator* allocator);
 
+    // Returns the DescriptorPoolAllocator shared by all the layouts with these descriptor counts.
+    Ref<DescriptorPoolAllocator> GetOrCreateDescriptorPoolAllocator(
+        const absl::flat_hash_map<VkDescriptorType, uint32_t>& descriptorCountPerType);
+    size_t GetDescriptorPoolCountForTesting();
+
     void CacheStaticSampler(const Ref<Sampler>& s);
 
     // Dawn Native API
@@ -236,6 +241,9 @@ class Device final : public DeviceBase {
     // Entries can be appended without holding the device mutex.
     MutexProtected<SerialQueue<ExecutionSerial, Ref<DescriptorSetAllocator>>>
         mDescriptorAllocatorsPendingDeallocation;
+    MutexProtected<
+        absl::flat_hash_map<DescriptorPoolAllocator::DescriptorCounts, Ref<DescriptorPoolAllocator>>>
+        mDescriptorPoolAllocators;
     Ref<FencedDeleter> mDeleter;
     std::unique_ptr<MutexProtected<ResourceMemoryAllocator>> mResourceMemoryAllocator;
     std::unique_ptr<FramebufferCache> mFramebufferCache;
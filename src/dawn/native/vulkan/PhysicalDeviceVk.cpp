@@ -1371,6 +1371,20 @@ void PhysicalDevice::SetupBackendDeviceToggles(dawn::platform::Platform* platfor
     } else {
         deviceToggles->Default(Toggle::VulkanUseRasterizationOrderAttachmentAccess, true);
     }
+
+    if (!GetDeviceInfo().HasExt(DeviceExt::TimelineSemaphore) ||
+        GetDeviceInfo().timelineSemaphoreFeatures.timelineSemaphore == VK_FALSE) {
+        deviceToggles->ForceSet(Toggle::VulkanUseTimelineSemaphore, false);
+    } else {
+        deviceToggles->Default(Toggle::VulkanUseTimelineSemaphore, false);
+    }
+
+    if (!GetDeviceInfo().HasExt(DeviceExt::Synchronization2) ||
+        GetDeviceInfo().synchronization2Features.synchronization2 == VK_FALSE) {
+        deviceToggles->ForceSet(Toggle::VulkanUseSynchronization2, false);
+    } else {
+        deviceToggles->Default(Toggle::VulkanUseSynchronization2, false);
+    }
 }
 
 ResultOrError<Ref<DeviceBase>> PhysicalDevice::CreateDeviceImpl(
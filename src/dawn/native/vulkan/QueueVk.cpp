@@ -27,9 +27,11 @@
 
 #include "src/dawn/native/vulkan/QueueVk.h"
 
+#include <algorithm>
 #include <limits>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "absl/cleanup/cleanup.h"
 #include "dawn/platform/DawnPlatform.h"
@@ -96,6 +98,23 @@ MaybeError Queue::Initialize() {
 
     DAWN_TRY(PrepareRecordingContext());
 
+    if (device->IsToggleEnabled(Toggle::VulkanUseTimelineSemaphore)) {
+        VkSemaphoreTypeCreateInfo typeCreateInfo;
+        typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeCreateInfo.pNext = nullptr;
+        typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeCreateInfo.initialValue = static_cast<uint64_t>(GetLastSubmittedCommandSerial());
+
+        VkSemaphoreCreateInfo createInfo;
+        createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext = &typeCreateInfo;
+        createInfo.flags = 0;
+
+        DAWN_TRY(CheckVkSuccess(device->fn.CreateSemaphore(device->GetVkDevice(), &createInfo,
+                                                           nullptr, &*mTimelineSemaphore),
+                                "vkCreateSemaphore"));
+    }
+
     SetLabelImpl();
     return {};
 }
@@ -130,6 +149,24 @@ VkQueue Queue::GetVkQueue() const {
 }
 
 ResultOrError<ExecutionSerial> Queue::CheckAndUpdateCompletedSerials() {
+    if (mTimelineSemaphore == VK_NULL_HANDLE) {
+        return CheckAndUpdateCompletedSerialsWithFences();
+    }
+
+    Device* device = ToBackend(GetDevice());
+    uint64_t counterValue = 0;
+    VkResult result = VkResult::WrapUnsafe(
+        INJECT_ERROR_OR_RUN(device->fn.GetSemaphoreCounterValueKHR(
+                                device->GetVkDevice(), mTimelineSemaphore, &counterValue),
+                            VK_ERROR_DEVICE_LOST));
+    DAWN_TRY(CheckVkSuccess(::VkResult(result), "vkGetSemaphoreCounterValueKHR"));
+
+    // The GPU can signal the semaphore before SubmitPendingCommandsImpl records the serial as
+    // submitted, never report it as completed before that.
+    return std::min(ExecutionSerial(counterValue), GetLastSubmittedCommandSerial());
+}
+
+ResultOrError<ExecutionSerial> Queue::CheckAndUpdateCompletedSerialsWithFences() {
     // TODO(crbug.com/40643114): Revisit whether this lock is needed for this backend.
     auto deviceGuard = GetDevice()->GetGuard();
 
@@ -222,6 +259,7 @@ MaybeError Queue::SplitRecordingContext(CommandRecordingContext* recordingContex
     DAWN_ASSERT(recordingContext->used);
     Device* device = ToBackend(GetDevice());
 
+    recordingContext->EmitPendingBarriers(device);
     DAWN_TRY(CheckVkSuccess(device->fn.EndCommandBuffer(recordingContext->commandBuffer),
                             "vkEndCommandBuffer"));
 
@@ -320,6 +358,7 @@ MaybeError Queue::SubmitPendingCommandsImpl() {
         DAWN_TRY(texture->OnBeforeSubmit(&mRecordingContext));
     }
 
+    mRecordingContext.EmitPendingBarriers(device);
     DAWN_TRY(CheckVkSuccess(device->fn.EndCommandBuffer(mRecordingContext.commandBuffer),
                             "vkEndCommandBuffer"));
 
@@ -339,8 +378,31 @@ MaybeError Queue::SubmitPendingCommandsImpl() {
         checked_cast<uint32_t>(mRecordingContext.signalSemaphores.size());
     submitInfo.pSignalSemaphores = AsVkArray(mRecordingContext.signalSemaphores.data());
 
+    // With a timeline semaphore, the submit additionally signals it with its serial. The values
+    // for the binary semaphores in the list are ignored.
+    std::vector<VkSemaphore> signalSemaphores;
+    std::vector<uint64_t> signalValues;
+    VkTimelineSemaphoreSubmitInfo timelineSubmitInfo;
     VkFence fence = VK_NULL_HANDLE;
-    DAWN_TRY_ASSIGN(fence, GetUnusedFence());
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        signalSemaphores = mRecordingContext.signalSemaphores;
+        signalSemaphores.push_back(mTimelineSemaphore);
+        signalValues.resize(signalSemaphores.size(), 0);
+        signalValues.back() = static_cast<uint64_t>(GetLastSubmittedCommandSerial()) + 1;
+
+        timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineSubmitInfo.pNext = nullptr;
+        timelineSubmitInfo.waitSemaphoreValueCount = 0;
+        timelineSubmitInfo.pWaitSemaphoreValues = nullptr;
+        timelineSubmitInfo.signalSemaphoreValueCount = checked_cast<uint32_t>(signalValues.size());
+        timelineSubmitInfo.pSignalSemaphoreValues = signalValues.data();
+
+        submitInfo.pNext = &timelineSubmitInfo;
+        submitInfo.signalSemaphoreCount = checked_cast<uint32_t>(signalSemaphores.size());
+        submitInfo.pSignalSemaphores = AsVkArray(signalSemaphores.data());
+    } else {
+        DAWN_TRY_ASSIGN(fence, GetUnusedFence());
+    }
 
     platform::metrics::DawnHistogramTimer timer(device->GetPlatform());
     {
@@ -351,7 +413,9 @@ MaybeError Queue::SubmitPendingCommandsImpl() {
                 // If submitting to the queue fails, move the fence back into the unused fence
                 // list, as if it were never acquired. Not doing so would leak the fence since
                 // it would be neither in the unused list nor in the in-flight list.
-                mUnusedFences->push_back(fence);
+                if (fence != VK_NULL_HANDLE) {
+                    mUnusedFences->push_back(fence);
+                }
             });
     }
     timer.RecordMicroseconds("Vulkan.VkQueueSubmitUS");
@@ -361,10 +425,14 @@ MaybeError Queue::SubmitPendingCommandsImpl() {
     for (VkSemaphore semaphore : mRecordingContext.waitSemaphores) {
         device->GetFencedDeleter()->DeleteWhenUnused(semaphore);
     }
-    mFencesInFlight.Use([&](auto fencesInFlight) {
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
         IncrementLastSubmittedCommandSerial();
-        fencesInFlight->emplace_back(fence, GetLastSubmittedCommandSerial());
-    });
+    } else {
+        mFencesInFlight.Use([&](auto fencesInFlight) {
+            IncrementLastSubmittedCommandSerial();
+            fencesInFlight->emplace_back(fence, GetLastSubmittedCommandSerial());
+        });
+    }
 
     for (auto texture : mRecordingContext.specialSyncTextures) {
         DAWN_TRY(texture->OnAfterSubmit());
@@ -475,11 +543,61 @@ void Queue::DestroyImpl(DestroyReason reason) {
         unusedFences->clear();
     });
 
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        device->fn.DestroySemaphore(vkDevice, mTimelineSemaphore, nullptr);
+        mTimelineSemaphore = VK_NULL_HANDLE;
+    }
+
     QueueBase::DestroyImpl(reason);
 }
 
 ResultOrError<ExecutionSerial> Queue::WaitForQueueSerialImpl(ExecutionSerial waitSerial,
                                                              Nanoseconds timeout) {
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        return WaitForQueueSerialWithTimelineSemaphore(waitSerial, timeout);
+    }
+    return WaitForQueueSerialWithFences(waitSerial, timeout);
+}
+
+ResultOrError<ExecutionSerial> Queue::WaitForQueueSerialWithTimelineSemaphore(
+    ExecutionSerial waitSerial,
+    Nanoseconds timeout) {
+    // Match the fence path, which treats serials without a fence in flight as completed, instead
+    // of waiting for a value that no submit will signal.
+    if (waitSerial > GetLastSubmittedCommandSerial()) {
+        return waitSerial;
+    }
+
+    Device* device = ToBackend(GetDevice());
+    uint64_t waitValue = static_cast<uint64_t>(waitSerial);
+
+    VkSemaphoreWaitInfo waitInfo;
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.pNext = nullptr;
+    waitInfo.flags = 0;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = AsVkArray(&mTimelineSemaphore);
+    waitInfo.pValues = &waitValue;
+
+    while (1) {
+        VkResult waitResult = VkResult::WrapUnsafe(INJECT_ERROR_OR_RUN(
+            device->fn.WaitSemaphoresKHR(device->GetVkDevice(), &waitInfo,
+                                         static_cast<uint64_t>(timeout)),
+            VK_ERROR_DEVICE_LOST));
+        if (waitResult == VK_TIMEOUT) {
+            // Like with fences, retry on spurious timeouts when the timeout is infinite.
+            if (static_cast<uint64_t>(timeout) == std::numeric_limits<uint64_t>::max()) {
+                continue;
+            }
+            return kWaitSerialTimeout;
+        }
+        DAWN_TRY(CheckVkSuccess(::VkResult(waitResult), "vkWaitSemaphoresKHR"));
+        return waitSerial;
+    }
+}
+
+ResultOrError<ExecutionSerial> Queue::WaitForQueueSerialWithFences(ExecutionSerial waitSerial,
+                                                                   Nanoseconds timeout) {
     Device* device = ToBackend(GetDevice());
     VkDevice vkDevice = device->GetVkDevice();
     // If the client has passed a finite timeout, the function will eventually return due to
@@ -77,6 +77,13 @@ class Queue final : public QueueBase {
 
     ResultOrError<VkFence> GetUnusedFence();
 
+    ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerialsWithFences();
+    ResultOrError<ExecutionSerial> WaitForQueueSerialWithFences(ExecutionSerial waitSerial,
+                                                                Nanoseconds timeout);
+    ResultOrError<ExecutionSerial> WaitForQueueSerialWithTimelineSemaphore(
+        ExecutionSerial waitSerial,
+        Nanoseconds timeout);
+
     // We track which operations are in flight on the GPU with an increasing serial.
     // This works only because we have a single queue. Each submit to a queue is associated
     // to a serial and a fence, such that when the fence is "ready" we know the operations
@@ -85,6 +92,11 @@ class Queue final : public QueueBase {
     // Fences in the unused list aren't reset yet.
     MutexProtected<std::vector<VkFence>> mUnusedFences;
 
+    // When the VulkanUseTimelineSemaphore toggle is enabled, the fences above are unused and each
+    // submit instead signals this timeline semaphore with its serial, so that its counter value
+    // is the last completed serial.
+    VkSemaphore mTimelineSemaphore = VK_NULL_HANDLE;
+
     MaybeError PrepareRecordingContext();
     ResultOrError<CommandPoolAndBuffer> BeginVkCommandBuffer();
 
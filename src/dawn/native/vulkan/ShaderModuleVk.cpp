@@ -399,12 +399,10 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
 
             // Requires Tint Program here right before actual using.
             auto shaderModule = r.inputProgram.UnsafeGetValue();
-            auto inputProgram = shaderModule->GetTintProgram();
             auto device = shaderModule->GetDevice();
-            const tint::Program* tintInputProgram = &(inputProgram->program);
 
-            // Convert the AST program to an IR module.
-            tint::Result<tint::core::ir::Module> ir;
+            // Convert the AST program to an IR module, or load it from the BlobCache.
+            tint::core::ir::Module ir;
             {
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
                                                    "ShaderModuleProgramToIR");
@@ -413,10 +411,7 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
                     .enable_validation_asserts =
                         device->IsToggleEnabled(Toggle::EnableTintIRValidationAsserts),
                 };
-                ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram, irOptions);
-                DAWN_INVALID_IF(ir != tint::Success,
-                                "An error occurred while generating Tint IR\n%s",
-                                ir.Failure().reason);
+                DAWN_TRY_ASSIGN(ir, shaderModule->GetLoweredTintIR(irOptions));
             }
 
             tint::Result<tint::spirv::writer::Output> tintResult;
@@ -424,7 +419,7 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
                                                    "ShaderModuleGenerateSPIRV");
                 // Generate SPIR-V from Tint IR.
-                tintResult = tint::spirv::writer::Generate(ir.Get(), r.tintOptions);
+                tintResult = tint::spirv::writer::Generate(ir, r.tintOptions);
                 DAWN_INVALID_IF(tintResult != tint::Success,
                                 "An error occurred while generating SPIR-V\n%s",
                                 tintResult.Failure().reason);
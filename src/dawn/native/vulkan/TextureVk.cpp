@@ -1096,10 +1096,12 @@ void Texture::TransitionUsageNow(CommandRecordingContext* recordingContext,
 
     if (!barriers.empty()) {
         DAWN_ASSERT(srcStages != 0 && dstStages != 0);
-        ToBackend(GetDevice())
-            ->fn.CmdPipelineBarrier(recordingContext->commandBuffer, srcStages, dstStages, 0, 0,
-                                    nullptr, 0, nullptr, checked_cast<uint32_t>(barriers.size()),
-                                    barriers.data());
+        Device* device = ToBackend(GetDevice());
+        recordingContext->EmitPendingBarriers(device);
+        device->fn.CmdPipelineBarrier(recordingContext->commandBuffer, srcStages, dstStages, 0, 0,
+                                      nullptr, 0, nullptr, checked_cast<uint32_t>(barriers.size()),
+                                      barriers.data());
+        device->IncrementPipelineBarrierCountForTesting();
     }
 }
 
@@ -1688,8 +1690,10 @@ void ImportedTextureBase::TransitionEagerlyForExport(CommandRecordingContext* re
     // importing queue.
     dstStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
 
+    recordingContext->EmitPendingBarriers(device);
     device->fn.CmdPipelineBarrier(recordingContext->commandBuffer, srcStages, dstStages, 0, 0,
                                   nullptr, 0, nullptr, 1, &barrier);
+    device->IncrementPipelineBarrierCountForTesting();
 }
 
 bool ImportedTextureBase::CanReuseWithoutBarrier(wgpu::TextureUsage lastUsage,
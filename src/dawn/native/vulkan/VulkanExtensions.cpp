@@ -131,6 +131,7 @@ static constexpr std::array<DeviceExtInfo, kDeviceExtCount> sDeviceExtInfos{{
     {DeviceExt::DescriptorIndexing, "VK_EXT_descriptor_indexing"},
     {DeviceExt::CreateRenderPass2, "VK_KHR_create_renderpass2"},
     {DeviceExt::DepthStencilResolve, "VK_KHR_depth_stencil_resolve"},
+    {DeviceExt::TimelineSemaphore, "VK_KHR_timeline_semaphore"},
 
     // Promoted in 1.3
     {DeviceExt::ShaderIntegerDotProduct, "VK_KHR_shader_integer_dot_product"},
@@ -140,6 +141,7 @@ static constexpr std::array<DeviceExtInfo, kDeviceExtCount> sDeviceExtInfos{{
     {DeviceExt::SubgroupSizeControl, "VK_EXT_subgroup_size_control"},
     {DeviceExt::DynamicRendering, "VK_KHR_dynamic_rendering"},
     {DeviceExt::ExtendedDynamicState, "VK_EXT_extended_dynamic_state"},
+    {DeviceExt::Synchronization2, "VK_KHR_synchronization2"},
 
     // Promoted in 1.4
     {DeviceExt::PipelineRobustness, "VK_EXT_pipeline_robustness"},
@@ -228,6 +230,7 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
             case DeviceExt::ShaderFloatControls:
             case DeviceExt::DescriptorIndexing:
             case DeviceExt::CreateRenderPass2:
+            case DeviceExt::TimelineSemaphore:
             case DeviceExt::ExternalMemoryFD:
             case DeviceExt::ExternalMemoryZirconHandle:
             case DeviceExt::ExternalMemoryHost:
@@ -236,6 +239,7 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
             case DeviceExt::QueueFamilyForeign:
             case DeviceExt::PhysicalDeviceDrm:
             case DeviceExt::ExtendedDynamicState:
+            case DeviceExt::Synchronization2:
             case DeviceExt::MaximalReconvergence:
             case DeviceExt::SubgroupUniformControlFlow:
                 hasDependencies = true;
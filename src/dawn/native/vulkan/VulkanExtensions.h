@@ -90,6 +90,7 @@ enum class DeviceExt : uint32_t {
     DescriptorIndexing,
     CreateRenderPass2,
     DepthStencilResolve,
+    TimelineSemaphore,
 
     // Promoted to 1.3
     ShaderIntegerDotProduct,
@@ -99,6 +100,7 @@ enum class DeviceExt : uint32_t {
     SubgroupSizeControl,
     DynamicRendering,
     ExtendedDynamicState,
+    Synchronization2,
 
     // Promoted to 1.4
     PipelineRobustness,
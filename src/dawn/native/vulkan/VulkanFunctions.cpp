@@ -411,6 +411,11 @@ MaybeError VulkanFunctions::LoadDeviceProcs(VkInstance instance,
         GET_DEVICE_PROC(CreateRenderPass2KHR);
     }
 
+    if (deviceInfo.HasExt(DeviceExt::TimelineSemaphore)) {
+        GET_DEVICE_PROC(GetSemaphoreCounterValueKHR);
+        GET_DEVICE_PROC(WaitSemaphoresKHR);
+    }
+
     // Promoted in 1.3
     if (deviceInfo.HasExt(DeviceExt::DynamicRendering)) {
         GET_DEVICE_PROC(CmdBeginRenderingKHR);
@@ -428,6 +433,10 @@ MaybeError VulkanFunctions::LoadDeviceProcs(VkInstance instance,
         GET_DEVICE_PROC(CmdSetStencilTestEnableEXT);
     }
 
+    if (deviceInfo.HasExt(DeviceExt::Synchronization2)) {
+        GET_DEVICE_PROC(CmdPipelineBarrier2KHR);
+    }
+
     // Not promoted to core in any version
     if (deviceInfo.HasExt(DeviceExt::ExternalMemoryFD)) {
         GET_DEVICE_PROC(GetMemoryFdKHR);
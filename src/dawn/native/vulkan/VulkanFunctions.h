@@ -362,6 +362,10 @@ struct VulkanFunctions {
     // VK_KHR_create_renderpass2
     VkFn<PFN_vkCreateRenderPass2KHR> CreateRenderPass2KHR = nullptr;
 
+    // VK_KHR_timeline_semaphore
+    VkFn<PFN_vkGetSemaphoreCounterValueKHR> GetSemaphoreCounterValueKHR = nullptr;
+    VkFn<PFN_vkWaitSemaphoresKHR> WaitSemaphoresKHR = nullptr;
+
     // Promoted in 1.3
 
     // VK_KHR_dynamic_rendering
@@ -378,6 +382,9 @@ struct VulkanFunctions {
     VkFn<PFN_vkCmdSetStencilOpEXT> CmdSetStencilOpEXT = nullptr;
     VkFn<PFN_vkCmdSetStencilTestEnableEXT> CmdSetStencilTestEnableEXT = nullptr;
 
+    // VK_KHR_synchronization2
+    VkFn<PFN_vkCmdPipelineBarrier2KHR> CmdPipelineBarrier2KHR = nullptr;
+
     // Not promoted to core in any version
 
     // VK_KHR_external_memory_fd
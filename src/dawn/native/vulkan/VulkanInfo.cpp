@@ -351,6 +351,11 @@ ResultOrError<VulkanDeviceInfo> GatherDeviceInfo(const PhysicalDevice& device) {
                             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT);
     }
 
+    if (info.extensions[DeviceExt::TimelineSemaphore]) {
+        featuresChain.Add(&info.timelineSemaphoreFeatures,
+                          VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR);
+    }
+
     if (info.extensions[DeviceExt::VulkanMemoryModel]) {
         featuresChain.Add(&info.vulkanMemoryModelFeatures,
                           VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES);
@@ -393,6 +398,11 @@ ResultOrError<VulkanDeviceInfo> GatherDeviceInfo(const PhysicalDevice& device) {
                           VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
     }
 
+    if (info.extensions[DeviceExt::Synchronization2]) {
+        featuresChain.Add(&info.synchronization2Features,
+                          VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR);
+    }
+
     if (info.extensions[DeviceExt::PhysicalDeviceDrm]) {
         propertiesChain.Add(&info.drmProperties,
                             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT);
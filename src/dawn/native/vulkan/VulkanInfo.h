@@ -85,6 +85,8 @@ struct VulkanDeviceKnobs {
     VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR shaderMaximalReconvergenceFeatures;
     VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR
         shaderSubgroupUniformControlFlowFeatures;
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
+    VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features;
 
     bool HasExt(DeviceExt ext) const;
     DeviceExtSet extensions;
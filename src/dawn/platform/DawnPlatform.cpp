@@ -88,7 +88,7 @@ dawn::platform::CachingInterface* Platform::GetCachingInterface() {
 }
 
 std::unique_ptr<dawn::platform::WorkerTaskPool> Platform::CreateWorkerTaskPool() {
-    return WorkerTaskPool::CreateDawnDefault(AsyncWorkerThreadPool::kDefaultTaskHandlingJobCount);
+    return WorkerTaskPool::CreateDawnDefault(AsyncWorkerThreadPool::DefaultTaskHandlingJobCount());
 }
 
 std::unique_ptr<dawn::platform::WorkerTaskPool> WorkerTaskPool::CreateDawnDefault(
@@ -96,6 +96,13 @@ std::unique_ptr<dawn::platform::WorkerTaskPool> WorkerTaskPool::CreateDawnDefaul
     return std::make_unique<AsyncWorkerThreadPool>(maxThreadCount);
 }
 
+std::unique_ptr<WaitableEvent> WorkerTaskPool::PostWorkerTaskWithPriority(
+    PostWorkerTaskCallback callback,
+    void* userdata,
+    TaskPriority priority) {
+    return PostWorkerTask(callback, userdata);
+}
+
 std::unique_ptr<dawn::platform::JobHandle> WorkerTaskPool::PostWorkerJob(PostWorkerJobCallback cb,
                                                                          void* userdata) {
     DAWN_UNREACHABLE();
@@ -27,8 +27,10 @@
 
 #include "src/dawn/platform/WorkerThread.h"
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
+#include <optional>
 #include <utility>
 
 #include "src/utils/assert.h"
@@ -57,6 +59,10 @@ class AsyncJobHandle final : public JobHandle, private dawn::Ref<AsyncJobHandleI
   private:
     dawn::Ref<AsyncJobHandleImpl> mImpl;
 };
+
+// The pool and queue index of the current thread if it is a task handling thread.
+thread_local const AsyncWorkerThreadPool* tCurrentPool = nullptr;
+thread_local uint32_t tCurrentQueueIndex = 0;
 }  // anonymous namespace
 
 // AsyncTaskHandleImpl
@@ -111,9 +117,19 @@ void AsyncJobHandleImpl::JobThreadLoop(PostWorkerJobCallback cb, void* userdata)
 
 // AsyncWorkerThreadPool
 
+// static
+uint32_t AsyncWorkerThreadPool::DefaultTaskHandlingJobCount() {
+    return std::max(kMinTaskHandlingJobCount, std::thread::hardware_concurrency());
+}
+
 AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t maxThreadCount)
     : mMaxTaskThreads(maxThreadCount) {
+    DAWN_ASSERT(mMaxTaskThreads > 0);
     mJobHandles->reserve(mMaxTaskThreads);
+    mTaskQueues.reserve(mMaxTaskThreads);
+    for (uint32_t i = 0; i < mMaxTaskThreads; i++) {
+        mTaskQueues.push_back(std::make_unique<MutexProtected<TaskQueues>>());
+    }
 }
 
 AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
@@ -131,11 +147,33 @@ AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
 std::unique_ptr<WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
     PostWorkerTaskCallback callback,
     void* userdata) {
+    return PostWorkerTaskWithPriority(callback, userdata, TaskPriority::UserVisible);
+}
+
+std::unique_ptr<WaitableEvent> AsyncWorkerThreadPool::PostWorkerTaskWithPriority(
+    PostWorkerTaskCallback callback,
+    void* userdata,
+    TaskPriority priority) {
     Ref<AsyncTaskHandleImpl> handle = AcquireRef(new AsyncTaskHandleImpl(callback, userdata));
+
+    // Tasks posted from a task handling thread stay on it, the others are spread over the threads.
+    uint32_t queueIndex = tCurrentPool == this
+                              ? tCurrentQueueIndex
+                              : mNextQueueIndex.fetch_add(1, std::memory_order_relaxed) %
+                                    mMaxTaskThreads;
+    size_t priorityIndex = static_cast<size_t>(priority);
+    DAWN_ASSERT(priorityIndex < kTaskPriorityCount);
+    uint64_t numQueuedTasks;
+    mTaskQueues[queueIndex]->Use([&](auto queues) {
+        // Count the task before it becomes visible to the other threads, otherwise a thread could
+        // pop it and decrement the counters before they are incremented.
+        mQueuedTasks[priorityIndex]++;
+        numQueuedTasks = ++mNumQueuedTasks;
+        (*queues)[priorityIndex].push_back({handle, std::chrono::steady_clock::now()});
+    });
+
     Ref<AsyncJobHandleImpl> job;
     mTaskTracking.Use<NotifyType::One>([&](auto taskTracking) {
-        taskTracking->tasks.emplace(handle);
-
         // Ensure that there are threads to process the task. This is inlined because it's a bit
         // cumbersome to pass the condition variable guard to a helper.
         if (taskTracking->numJobs == mMaxTaskThreads) {
@@ -144,7 +182,7 @@ std::unique_ptr<WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
 
         // If we currently have more tasks than jobs start a new job up to the pool limit.
         // TODO(crbug.com/430452846): Better heuristic for this?
-        if (taskTracking->numJobs < taskTracking->tasks.size()) {
+        if (taskTracking->numJobs < numQueuedTasks) {
             job = AcquireRef(new AsyncJobHandleImpl(
                 [](void* self) {
                     return static_cast<AsyncWorkerThreadPool*>(self)->TaskHandlingJobLoop();
@@ -168,21 +206,87 @@ std::unique_ptr<JobHandle> AsyncWorkerThreadPool::PostWorkerJob(PostWorkerJobCal
     return std::make_unique<AsyncJobHandle>(job);
 }
 
+AsyncWorkerThreadPool::Counters AsyncWorkerThreadPool::GetCounters() const {
+    Counters counters;
+    for (size_t i = 0; i < kTaskPriorityCount; i++) {
+        counters.queuedTasks[i] = mQueuedTasks[i];
+    }
+    counters.completedTasks = mCompletedTasks;
+    counters.stolenTasks = mStolenTasks;
+    counters.totalWaitTime = Nanoseconds(mTotalWaitTimeNs.load());
+    counters.maxWaitTime = Nanoseconds(mMaxWaitTimeNs.load());
+    return counters;
+}
+
+Ref<AsyncTaskHandleImpl> AsyncWorkerThreadPool::PopTask(uint32_t queueIndex) {
+    for (size_t priorityIndex = 0; priorityIndex < kTaskPriorityCount; priorityIndex++) {
+        if (mQueuedTasks[priorityIndex] == 0) {
+            continue;
+        }
+
+        // Look at the thread's own queue first, then at the other threads' ones in turn.
+        for (uint32_t i = 0; i < mMaxTaskThreads; i++) {
+            uint32_t index = (queueIndex + i) % mMaxTaskThreads;
+            std::optional<QueuedTask> task;
+            mTaskQueues[index]->Use([&](auto queues) {
+                std::deque<QueuedTask>& queue = (*queues)[priorityIndex];
+                if (queue.empty()) {
+                    return;
+                }
+                if (index == queueIndex) {
+                    task = std::move(queue.front());
+                    queue.pop_front();
+                } else {
+                    task = std::move(queue.back());
+                    queue.pop_back();
+                }
+            });
+            if (!task) {
+                continue;
+            }
+
+            mQueuedTasks[priorityIndex]--;
+            mNumQueuedTasks--;
+            if (index != queueIndex) {
+                mStolenTasks++;
+            }
+
+            uint64_t waitTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::steady_clock::now() - task->postTime)
+                                      .count();
+            mTotalWaitTimeNs += waitTimeNs;
+            uint64_t maxWaitTimeNs = mMaxWaitTimeNs;
+            while (waitTimeNs > maxWaitTimeNs &&
+                   !mMaxWaitTimeNs.compare_exchange_weak(maxWaitTimeNs, waitTimeNs)) {
+            }
+            return std::move(task->handle);
+        }
+    }
+    return nullptr;
+}
+
 JobStatus AsyncWorkerThreadPool::TaskHandlingJobLoop() {
     // By default, wait for 100ms between yielding.
     static constexpr Nanoseconds kWaitDuration = Nanoseconds(100000000u);
 
-    Ref<AsyncTaskHandleImpl> task = nullptr;
-    mTaskTracking.Use<NotifyType::None>([&](auto taskTracking) {
-        if (taskTracking.WaitFor(kWaitDuration, [](auto& x) { return !(x.tasks.empty()); })) {
-            task = taskTracking->tasks.front();
-            taskTracking->tasks.pop();
-        }
-    });
+    // Each task handling job runs on its own thread, give it a queue the first time it loops.
+    if (tCurrentPool != this) {
+        tCurrentPool = this;
+        tCurrentQueueIndex = mNextThreadQueueIndex++ % mMaxTaskThreads;
+    }
 
+    Ref<AsyncTaskHandleImpl> task = PopTask(tCurrentQueueIndex);
     if (task) {
+        // Count the task before completing it so that the counters are up to date when its waiters
+        // wake up.
+        mCompletedTasks++;
         task->Complete();
+        return JobStatus::Continue;
     }
+
+    mTaskTracking.Use<NotifyType::None>([&](auto taskTracking) {
+        taskTracking.WaitFor(kWaitDuration, [&](auto&) { return mNumQueuedTasks != 0; });
+    });
     return JobStatus::Continue;
 }
 
@@ -28,10 +28,13 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -39,6 +42,7 @@
 #include "partition_alloc/pointers/raw_ptr.h"
 #include "src/dawn/common/MutexProtected.h"
 #include "src/dawn/common/RefCounted.h"
+#include "src/dawn/common/Time.h"
 #include "src/utils/non_copyable.h"
 
 namespace dawn::platform {
@@ -84,34 +88,79 @@ class AsyncJobHandleImpl : public RefCounted, public NonCopyable {
     std::thread mThread;
 };
 
+// The task handling threads each have their own queues of tasks, one per TaskPriority. Tasks posted
+// from a task handling thread go to its own queues, and the others are spread over the threads in
+// turn. Threads start their own oldest task of the highest priority pending anywhere, and steal the
+// newest task of that priority from another thread's queue when theirs is empty.
 class AsyncWorkerThreadPool : public WorkerTaskPool, public NonCopyable {
   public:
-    static constexpr uint32_t kDefaultTaskHandlingJobCount = 2;
+    // One task handling thread per core, with a minimum of kMinTaskHandlingJobCount.
+    static constexpr uint32_t kMinTaskHandlingJobCount = 2;
+    static uint32_t DefaultTaskHandlingJobCount();
 
-    explicit AsyncWorkerThreadPool(uint32_t maxThreadCount = kDefaultTaskHandlingJobCount);
+    static constexpr size_t kTaskPriorityCount = 2;
+
+    explicit AsyncWorkerThreadPool(uint32_t maxThreadCount = DefaultTaskHandlingJobCount());
     ~AsyncWorkerThreadPool() override;
 
     std::unique_ptr<WaitableEvent> PostWorkerTask(PostWorkerTaskCallback callback,
                                                   void* userdata) override;
+    std::unique_ptr<WaitableEvent> PostWorkerTaskWithPriority(PostWorkerTaskCallback callback,
+                                                              void* userdata,
+                                                              TaskPriority priority) override;
     std::unique_ptr<JobHandle> PostWorkerJob(PostWorkerJobCallback cb, void* userdata) override;
 
+    struct Counters {
+        // The number of tasks waiting to be started, for each TaskPriority.
+        std::array<uint64_t, kTaskPriorityCount> queuedTasks = {};
+        uint64_t completedTasks = 0;
+        // The number of tasks started by another thread than the one they were queued on.
+        uint64_t stolenTasks = 0;
+        // The total and maximum time tasks waited in the queues before being started.
+        Nanoseconds totalWaitTime = Nanoseconds(0u);
+        Nanoseconds maxWaitTime = Nanoseconds(0u);
+    };
+    Counters GetCounters() const;
+
   private:
+    struct QueuedTask {
+        dawn::Ref<AsyncTaskHandleImpl> handle;
+        std::chrono::steady_clock::time_point postTime;
+    };
+    using TaskQueues = std::array<std::deque<QueuedTask>, kTaskPriorityCount>;
+
     struct TaskTracking {
         uint32_t numJobs = 0;
-        std::queue<dawn::Ref<AsyncTaskHandleImpl>> tasks;
     };
 
     // The task handling thread pool is implemented via jobs where each job is synonymous to a
     // thread.
     JobStatus TaskHandlingJobLoop();
 
+    // Pops the next task to run on the thread handling `queueIndex`, or returns nullptr if none is
+    // pending.
+    dawn::Ref<AsyncTaskHandleImpl> PopTask(uint32_t queueIndex);
+
     const uint32_t mMaxTaskThreads;
 
     // Threads used to handle potentially long-running worker jobs.
     MutexProtected<std::vector<dawn::Ref<AsyncJobHandleImpl>>> mJobHandles;
 
-    // Threads used to handle worker tasks, and the pending tasks they are working on.
+    // Threads used to handle worker tasks. Idle threads wait on its condition variable for
+    // `mNumQueuedTasks` to become non-zero.
     MutexCondVarProtected<TaskTracking> mTaskTracking;
+
+    // The pending tasks of each task handling thread.
+    std::vector<std::unique_ptr<MutexProtected<TaskQueues>>> mTaskQueues;
+    std::atomic<uint32_t> mNextQueueIndex = 0;
+    std::atomic<uint32_t> mNextThreadQueueIndex = 0;
+
+    std::atomic<uint64_t> mNumQueuedTasks = 0;
+    std::array<std::atomic<uint64_t>, kTaskPriorityCount> mQueuedTasks = {};
+    std::atomic<uint64_t> mCompletedTasks = 0;
+    std::atomic<uint64_t> mStolenTasks = 0;
+    std::atomic<uint64_t> mTotalWaitTimeNs = 0;
+    std::atomic<uint64_t> mMaxWaitTimeNs = 0;
 };
 
 }  // namespace dawn::platform
@@ -0,0 +1,323 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "src/dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "src/dawn/utils/ComboRenderBundleEncoderDescriptor.h"
+#include "src/dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "src/dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr uint32_t kDrawsPerPass = 100;
+constexpr uint64_t kUniformSize = 256;
+
+// Benchmarks for the frontend encoding, validation and submission paths in Dawn. They run on the
+// null backend so they only measure the CPU cost of the frontend.
+class CommandEncoding : public NullDeviceBenchmarkFixture {
+  protected:
+    CommandEncoding() {
+        // Needed for the benchmarks that encode and submit from multiple threads.
+        requiredFeatures.push_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
+    }
+
+    // Objects used by the render benchmarks. Each benchmark thread creates its own.
+    struct RenderObjects {
+        utils::BasicRenderPass renderPass;
+        wgpu::RenderPipeline pipeline;
+        wgpu::BindGroupLayout bgl;
+        wgpu::Buffer vertexBuffer;
+        wgpu::Buffer indexBuffer;
+    };
+
+    // Creates a pipeline with a single bind group of `bufferCount` uniform buffers, that may have
+    // dynamic offsets.
+    RenderObjects CreateRenderObjects(uint32_t bufferCount, bool hasDynamicOffset) {
+        RenderObjects objects;
+        objects.renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+
+        std::vector<wgpu::BindGroupLayoutEntry> entries(bufferCount);
+        std::string uniforms;
+        std::string sum = "vec4f(0.0)";
+        for (uint32_t i = 0; i < bufferCount; ++i) {
+            entries[i].binding = i;
+            entries[i].visibility = wgpu::ShaderStage::Vertex;
+            entries[i].buffer.type = wgpu::BufferBindingType::Uniform;
+            entries[i].buffer.hasDynamicOffset = hasDynamicOffset;
+            uniforms += "@group(0) @binding(" + std::to_string(i) + ") var<uniform> u" +
+                        std::to_string(i) + " : vec4f;\n";
+            sum += " + u" + std::to_string(i);
+        }
+        wgpu::BindGroupLayoutDescriptor bglDesc = {};
+        bglDesc.entryCount = entries.size();
+        bglDesc.entries = entries.data();
+        objects.bgl = device.CreateBindGroupLayout(&bglDesc);
+
+        utils::ComboRenderPipelineDescriptor pipelineDesc;
+        pipelineDesc.layout = utils::MakePipelineLayout(device, {objects.bgl});
+        pipelineDesc.vertex.module = utils::CreateShaderModule(device, uniforms + R"(
+            @vertex fn main(@location(0) pos : vec4f) -> @builtin(position) vec4f {
+                return pos + )" + sum + R"(;
+            })");
+        pipelineDesc.vertex.bufferCount = 1;
+        pipelineDesc.cBuffers[0].arrayStride = 4 * sizeof(float);
+        pipelineDesc.cBuffers[0].attributeCount = 1;
+        pipelineDesc.cAttributes[0].format = wgpu::VertexFormat::Float32x4;
+        pipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+            @fragment fn main() -> @location(0) vec4f {
+                return vec4f(0.0, 1.0, 0.0, 1.0);
+            })");
+        pipelineDesc.cTargets[0].format = objects.renderPass.colorFormat;
+        objects.pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+        std::array<float, 12> vertices = {};
+        objects.vertexBuffer = utils::CreateBufferFromData(
+            device, vertices.data(), sizeof(vertices), wgpu::BufferUsage::Vertex);
+        std::array<uint32_t, 3> indices = {0, 1, 2};
+        objects.indexBuffer = utils::CreateBufferFromData(
+            device, indices.data(), sizeof(indices), wgpu::BufferUsage::Index);
+        return objects;
+    }
+
+    wgpu::Buffer CreateUniformBuffer(uint64_t size) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.size = size;
+        descriptor.usage = wgpu::BufferUsage::Uniform;
+        return device.CreateBuffer(&descriptor);
+    }
+
+  private:
+    wgpu::DeviceDescriptor GetDeviceDescriptor() const override {
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.requiredFeatures = requiredFeatures.data();
+        deviceDesc.requiredFeatureCount = requiredFeatures.size();
+        return deviceDesc;
+    }
+
+    std::vector<wgpu::FeatureName> requiredFeatures;
+};
+
+// Encodes a render pass with kDrawsPerPass draws, cycling through range(0) different bind groups.
+BENCHMARK_DEFINE_F(CommandEncoding, RenderPassBindGroupChurn)
+(benchmark::State& state) {
+    RenderObjects objects = CreateRenderObjects(1, false);
+
+    std::vector<wgpu::BindGroup> bindGroups;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        bindGroups.push_back(
+            utils::MakeBindGroup(device, objects.bgl, {{0, CreateUniformBuffer(kUniformSize)}}));
+    }
+
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&objects.renderPass.renderPassInfo);
+        pass.SetPipeline(objects.pipeline);
+        pass.SetVertexBuffer(0, objects.vertexBuffer);
+        for (uint32_t i = 0; i < kDrawsPerPass; ++i) {
+            pass.SetBindGroup(0, bindGroups[i % bindGroups.size()]);
+            pass.Draw(3);
+        }
+        pass.End();
+        benchmark::DoNotOptimize(encoder.Finish());
+    }
+    state.SetItemsProcessed(state.iterations() * kDrawsPerPass);
+}
+BENCHMARK_REGISTER_F(CommandEncoding, RenderPassBindGroupChurn)->Arg(1)->Arg(16)->Arg(256);
+
+// Encodes a render pass with kDrawsPerPass draws that each set a bind group of range(0) uniform
+// buffers with different dynamic offsets.
+BENCHMARK_DEFINE_F(CommandEncoding, SetBindGroupDynamicOffsets)
+(benchmark::State& state) {
+    const uint32_t bufferCount = state.range(0);
+    RenderObjects objects = CreateRenderObjects(bufferCount, true);
+
+    wgpu::Buffer buffer = CreateUniformBuffer(kUniformSize * kDrawsPerPass);
+    std::vector<wgpu::BindGroupEntry> entries(bufferCount);
+    for (uint32_t i = 0; i < bufferCount; ++i) {
+        entries[i].binding = i;
+        entries[i].buffer = buffer;
+        entries[i].size = kUniformSize;
+    }
+    wgpu::BindGroupDescriptor bindGroupDesc = {};
+    bindGroupDesc.layout = objects.bgl;
+    bindGroupDesc.entryCount = entries.size();
+    bindGroupDesc.entries = entries.data();
+    wgpu::BindGroup bindGroup = device.CreateBindGroup(&bindGroupDesc);
+
+    std::vector<uint32_t> offsets(bufferCount);
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&objects.renderPass.renderPassInfo);
+        pass.SetPipeline(objects.pipeline);
+        pass.SetVertexBuffer(0, objects.vertexBuffer);
+        for (uint32_t i = 0; i < kDrawsPerPass; ++i) {
+            for (uint32_t j = 0; j < bufferCount; ++j) {
+                offsets[j] = ((i + j) % kDrawsPerPass) * kUniformSize;
+            }
+            pass.SetBindGroup(0, bindGroup, offsets.size(), offsets.data());
+            pass.Draw(3);
+        }
+        pass.End();
+        benchmark::DoNotOptimize(encoder.Finish());
+    }
+    state.SetItemsProcessed(state.iterations() * kDrawsPerPass);
+}
+BENCHMARK_REGISTER_F(CommandEncoding, SetBindGroupDynamicOffsets)->Arg(1)->Arg(4);
+
+// Encodes a render pass executing range(0) render bundles of kDrawsPerPass draws each.
+BENCHMARK_DEFINE_F(CommandEncoding, ExecuteRenderBundles)
+(benchmark::State& state) {
+    RenderObjects objects = CreateRenderObjects(1, false);
+    wgpu::BindGroup bindGroup =
+        utils::MakeBindGroup(device, objects.bgl, {{0, CreateUniformBuffer(kUniformSize)}});
+
+    utils::ComboRenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatCount = 1;
+    bundleDesc.cColorFormats[0] = objects.renderPass.colorFormat;
+
+    std::vector<wgpu::RenderBundle> bundles;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        wgpu::RenderBundleEncoder bundleEncoder = device.CreateRenderBundleEncoder(&bundleDesc);
+        bundleEncoder.SetPipeline(objects.pipeline);
+        bundleEncoder.SetVertexBuffer(0, objects.vertexBuffer);
+        bundleEncoder.SetBindGroup(0, bindGroup);
+        for (uint32_t j = 0; j < kDrawsPerPass; ++j) {
+            bundleEncoder.Draw(3);
+        }
+        bundles.push_back(bundleEncoder.Finish());
+    }
+
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&objects.renderPass.renderPassInfo);
+        pass.ExecuteBundles(bundles.size(), bundles.data());
+        pass.End();
+        benchmark::DoNotOptimize(encoder.Finish());
+    }
+    state.SetItemsProcessed(state.iterations() * bundles.size() * kDrawsPerPass);
+}
+BENCHMARK_REGISTER_F(CommandEncoding, ExecuteRenderBundles)->Arg(1)->Arg(16);
+
+// Encodes and submits a render pass with kDrawsPerPass indexed indirect draws, which builds the
+// indirect draw metadata used for GPU validation of the indirect parameters.
+BENCHMARK_DEFINE_F(CommandEncoding, DrawIndexedIndirect)
+(benchmark::State& state) {
+    RenderObjects objects = CreateRenderObjects(1, false);
+    wgpu::BindGroup bindGroup =
+        utils::MakeBindGroup(device, objects.bgl, {{0, CreateUniformBuffer(kUniformSize)}});
+
+    // Use range(0) distinct indirect offsets to vary how much metadata gets deduplicated.
+    constexpr uint64_t kIndirectStride = 5 * sizeof(uint32_t);
+    std::vector<uint32_t> indirectData(5 * state.range(0), 0);
+    wgpu::Buffer indirectBuffer = utils::CreateBufferFromData(
+        device, indirectData.data(), indirectData.size() * sizeof(uint32_t),
+        wgpu::BufferUsage::Indirect);
+
+    wgpu::Queue queue = device.GetQueue();
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&objects.renderPass.renderPassInfo);
+        pass.SetPipeline(objects.pipeline);
+        pass.SetVertexBuffer(0, objects.vertexBuffer);
+        pass.SetIndexBuffer(objects.indexBuffer, wgpu::IndexFormat::Uint32);
+        pass.SetBindGroup(0, bindGroup);
+        for (uint32_t i = 0; i < kDrawsPerPass; ++i) {
+            pass.DrawIndexedIndirect(indirectBuffer, (i % state.range(0)) * kIndirectStride);
+        }
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+    device.Tick();
+    state.SetItemsProcessed(state.iterations() * kDrawsPerPass);
+}
+BENCHMARK_REGISTER_F(CommandEncoding, DrawIndexedIndirect)->Arg(1)->Arg(100);
+
+// Writes range(0) bytes to a buffer with Queue::WriteBuffer.
+BENCHMARK_DEFINE_F(CommandEncoding, QueueWriteBuffer)
+(benchmark::State& state) {
+    const uint64_t size = state.range(0);
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = size;
+    descriptor.usage = wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+    std::vector<uint8_t> data(size, 0);
+
+    wgpu::Queue queue = device.GetQueue();
+    for (auto _ : state) {
+        queue.WriteBuffer(buffer, 0, data.data(), size);
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK_REGISTER_F(CommandEncoding, QueueWriteBuffer)
+    ->Arg(256)
+    ->Arg(64 * 1024)
+    ->Arg(4 * 1024 * 1024)
+    ->Threads(1)
+    ->Threads(4);
+
+// Encodes a compute pass with a single dispatch, then finishes and submits it, from multiple
+// threads at once.
+BENCHMARK_DEFINE_F(CommandEncoding, FinishAndSubmit)
+(benchmark::State& state) {
+    wgpu::ComputePipelineDescriptor computeDesc = {};
+    computeDesc.compute.module = utils::CreateShaderModule(device, R"(
+        @group(0) @binding(0) var<storage, read_write> data : u32;
+        @compute @workgroup_size(1) fn main() { data = 0u; }
+    )");
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&computeDesc);
+
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = 4;
+    bufferDesc.usage = wgpu::BufferUsage::Storage;
+    wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0),
+                                                     {{0, device.CreateBuffer(&bufferDesc)}});
+
+    wgpu::Queue queue = device.GetQueue();
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        pass.SetPipeline(pipeline);
+        pass.SetBindGroup(0, bindGroup);
+        pass.DispatchWorkgroups(1);
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+    device.Tick();
+}
+BENCHMARK_REGISTER_F(CommandEncoding, FinishAndSubmit)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace
+}  // namespace dawn
@@ -426,6 +426,7 @@ DAWN_INSTANTIATE_TEST(ComputeStorageBufferBarrierTests,
                       OpenGLBackend(),
                       OpenGLESBackend(),
                       VulkanBackend(),
+                      VulkanBackend({"vulkan_use_synchronization2"}),
                       WebGPUBackend());
 
 }  // anonymous namespace
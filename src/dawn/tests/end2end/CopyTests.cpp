@@ -2165,8 +2165,9 @@ TEST_P(CopyTests_T2B, Texture3DMipUnaligned) {
 
 DAWN_INSTANTIATE_TEST_P(CopyTests_T2B,
                         {D3D11Backend(), D3D11Backend({"d3d11_disable_map_on_default_buffers"}),
-                         D3D12Backend(), MetalBackend(), OpenGLBackend(), OpenGLESBackend(),
-                         OpenGLESBackend({"gl_defer"}), VulkanBackend(),
+                         D3D12Backend(), MetalBackend(),
+                         NullBackend({"null_backend_execute_commands"}), OpenGLBackend(),
+                         OpenGLESBackend(), OpenGLESBackend({"gl_defer"}), VulkanBackend(),
                          VulkanBackend({"use_blit_for_snorm_texture_to_buffer_copy",
                                         "use_blit_for_bgra8unorm_texture_to_buffer_copy"}),
                          WebGPUBackend()},
@@ -3073,8 +3074,10 @@ TEST_P(CopyTests_B2T, Texture1DFull) {
 
 DAWN_INSTANTIATE_TEST_P(CopyTests_B2T,
                         {D3D11Backend(), D3D11Backend({"d3d11_disable_cpu_buffers"}),
-                         D3D12Backend(), MetalBackend(), OpenGLBackend(), OpenGLESBackend(),
-                         OpenGLESBackend({"gl_defer"}), VulkanBackend(), WebGPUBackend()},
+                         D3D12Backend(), MetalBackend(),
+                         NullBackend({"null_backend_execute_commands"}), OpenGLBackend(),
+                         OpenGLESBackend(), OpenGLESBackend({"gl_defer"}), VulkanBackend(),
+                         WebGPUBackend()},
                         {
                             wgpu::TextureFormat::R8Unorm,
                             wgpu::TextureFormat::RG8Unorm,
@@ -3642,8 +3645,8 @@ DAWN_INSTANTIATE_TEST_P(
                    "mip_level"}),
      D3D12Backend(
          {"d3d12_use_temp_buffer_in_texture_to_texture_copy_between_different_dimensions"}),
-     MetalBackend(), OpenGLBackend(), OpenGLESBackend(), OpenGLESBackend({"gl_defer"}),
-     VulkanBackend(), WebGPUBackend()},
+     MetalBackend(), NullBackend({"null_backend_execute_commands"}), OpenGLBackend(),
+     OpenGLESBackend(), OpenGLESBackend({"gl_defer"}), VulkanBackend(), WebGPUBackend()},
     {wgpu::TextureFormat::RGBA8Unorm, wgpu::TextureFormat::RGB9E5Ufloat});
 
 // Test copying between textures that have srgb compatible texture formats;
@@ -3784,6 +3787,7 @@ DAWN_INSTANTIATE_TEST(CopyTests_B2B,
                       D3D11Backend(),
                       D3D12Backend(),
                       MetalBackend(),
+                      NullBackend({"null_backend_execute_commands"}),
                       OpenGLBackend(),
                       OpenGLESBackend(),
                       OpenGLESBackend({"gl_defer"}),
@@ -3815,6 +3819,7 @@ DAWN_INSTANTIATE_TEST(ClearBufferTests,
                       D3D11Backend(),
                       D3D12Backend(),
                       MetalBackend(),
+                      NullBackend({"null_backend_execute_commands"}),
                       OpenGLBackend(),
                       OpenGLESBackend(),
                       OpenGLESBackend({"gl_defer"}),
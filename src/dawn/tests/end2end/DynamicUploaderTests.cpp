@@ -0,0 +1,118 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "src/dawn/tests/DawnTest.h"
+
+namespace dawn {
+namespace {
+
+constexpr uint64_t kMiB = 1024 * 1024;
+
+class DynamicUploaderTests : public DawnTest {
+  protected:
+    void SetUp() override {
+        DawnTest::SetUp();
+        // Native GetUploadMemoryInfo method is unsupported on wire.
+        DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+    }
+
+    native::UploadMemoryInfo GetUploadMemoryInfo() {
+        return native::GetUploadMemoryInfo(device.Get());
+    }
+
+    wgpu::Buffer CreateDstBuffer(uint64_t size) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.size = size;
+        descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+        return device.CreateBuffer(&descriptor);
+    }
+};
+
+// Test that uploads larger than the ring buffers reuse the pooled staging buffer once the GPU is
+// done with it instead of creating a new one.
+TEST_P(DynamicUploaderTests, LargeUploadsReuseStagingBuffer) {
+    constexpr uint64_t kSize = 8 * kMiB;
+    wgpu::Buffer buffer = CreateDstBuffer(kSize);
+    std::vector<uint32_t> data(kSize / sizeof(uint32_t));
+
+    native::UploadMemoryInfo before = GetUploadMemoryInfo();
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        std::fill(data.begin(), data.end(), i + 1);
+        queue.WriteBuffer(buffer, 0, data.data(), kSize);
+        EXPECT_BUFFER_U32_RANGE_EQ(data.data(), buffer, 0, data.size());
+        WaitForAllOperations();
+    }
+
+    native::UploadMemoryInfo after = GetUploadMemoryInfo();
+    EXPECT_EQ(after.largeUploadCount - before.largeUploadCount, 2u);
+    EXPECT_EQ(after.largeUploadReuseCount - before.largeUploadReuseCount, 1u);
+    EXPECT_GE(after.uploadedBytes - before.uploadedBytes, 2 * kSize);
+}
+
+// Test that the ring buffer size grows when the in-flight uploads don't fit in the ring buffers,
+// and that ReduceMemoryUsage frees the staging memory and resets the size.
+TEST_P(DynamicUploaderTests, RingBufferGrowsWithUploadVolume) {
+    constexpr uint64_t kSize = 3 * kMiB;
+    constexpr uint32_t kUploadCount = 3;
+    wgpu::Buffer buffer = CreateDstBuffer(kSize * kUploadCount);
+    std::vector<uint32_t> data(kSize / sizeof(uint32_t));
+
+    native::UploadMemoryInfo before = GetUploadMemoryInfo();
+
+    // All the uploads are pending on the same submit so they can't share a single ring buffer.
+    for (uint32_t i = 0; i < kUploadCount; ++i) {
+        std::fill(data.begin(), data.end(), i + 1);
+        queue.WriteBuffer(buffer, i * kSize, data.data(), kSize);
+    }
+    for (uint32_t i = 0; i < kUploadCount; ++i) {
+        std::fill(data.begin(), data.end(), i + 1);
+        EXPECT_BUFFER_U32_RANGE_EQ(data.data(), buffer, i * kSize, data.size());
+    }
+    WaitForAllOperations();
+
+    native::UploadMemoryInfo after = GetUploadMemoryInfo();
+    EXPECT_EQ(after.largeUploadCount, before.largeUploadCount);
+    EXPECT_GT(after.ringBufferSize, before.ringBufferSize);
+    EXPECT_GT(after.stagingMemorySize, 0u);
+
+    while (native::ReduceMemoryUsage(device.Get())) {
+        WaitForAllOperations();
+    }
+    native::UploadMemoryInfo reduced = GetUploadMemoryInfo();
+    EXPECT_EQ(reduced.stagingMemorySize, 0u);
+    EXPECT_LE(reduced.ringBufferSize, before.ringBufferSize);
+}
+
+DAWN_INSTANTIATE_TEST(DynamicUploaderTests, D3D12Backend(), VulkanBackend());
+
+}  // anonymous namespace
+}  // namespace dawn
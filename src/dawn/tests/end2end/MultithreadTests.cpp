@@ -1517,6 +1517,76 @@ TEST_P(MultithreadEncodingTests, ComputePassEncodersInParallel) {
     }
 }
 
+// Test that finishing encoders in parallel works when some of them fail validation in Finish(). The
+// validation of Finish() happens without the device lock so the errors must still be reported to
+// the error scope of the thread that finished the encoder.
+TEST_P(MultithreadEncodingTests, FinishWithValidationErrorsInParallel) {
+    DAWN_TEST_UNSUPPORTED_IF(HasToggleEnabled("skip_validation"));
+
+    constexpr uint32_t kNumThreads = 10;
+    constexpr uint32_t kExpected = 0xFFFFFFFFu;
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+            @group(0) @binding(0) var<storage, read_write> output : u32;
+
+            @compute @workgroup_size(1, 1, 1)
+            fn main() {
+                output = 0xFFFFFFFFu;
+            })");
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.compute.module = module;
+    auto pipeline = device.CreateComputePipeline(&csDesc);
+
+    wgpu::Buffer dstBuffer =
+        CreateBuffer(sizeof(uint32_t), wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc |
+                                           wgpu::BufferUsage::CopyDst);
+    wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0),
+                                                     {
+                                                         {0, dstBuffer, 0, sizeof(uint32_t)},
+                                                     });
+
+    std::vector<wgpu::CommandBuffer> commandBuffers(kNumThreads);
+
+    utils::RunInParallel(kNumThreads, [&](uint32_t index) {
+        // Odd threads leave a debug group open which fails the validation in Finish().
+        const bool expectError = index % 2 == 1;
+
+        device.PushErrorScope(wgpu::ErrorFilter::Validation);
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        if (expectError) {
+            encoder.PushDebugGroup("unbalanced");
+        }
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        pass.SetPipeline(pipeline);
+        pass.SetBindGroup(0, bindGroup);
+        pass.DispatchWorkgroups(1, 1, 1);
+        pass.End();
+        commandBuffers[index] = encoder.Finish();
+
+        std::atomic<bool> done(false);
+        device.PopErrorScope(wgpu::CallbackMode::AllowProcessEvents,
+                             [&](wgpu::PopErrorScopeStatus status, wgpu::ErrorType type,
+                                 wgpu::StringView) {
+                                 EXPECT_EQ(status, wgpu::PopErrorScopeStatus::Success);
+                                 EXPECT_EQ(type, expectError ? wgpu::ErrorType::Validation
+                                                             : wgpu::ErrorType::NoError);
+                                 done = true;
+                             });
+        instance.ProcessEvents();
+        EXPECT_TRUE(done.load());
+    });
+
+    // Verify that the valid command buffers executed correctly.
+    for (uint32_t i = 0; i < kNumThreads; i += 2) {
+        constexpr uint32_t kSentinelData = 0;
+        queue.WriteBuffer(dstBuffer, 0, &kSentinelData, sizeof(kSentinelData));
+        queue.Submit(1, &commandBuffers[i]);
+
+        EXPECT_BUFFER_U32_EQ(kExpected, dstBuffer, 0);
+    }
+}
+
 class MultithreadTextureCopyTests : public MultithreadTests {
   protected:
     void SetUp() override {
@@ -106,6 +106,7 @@ DAWN_INSTANTIATE_TEST(QueueTimelineTests,
                       OpenGLBackend(),
                       OpenGLESBackend(),
                       VulkanBackend(),
+                      VulkanBackend({"vulkan_use_timeline_semaphore"}),
                       WebGPUBackend());
 
 }  // anonymous namespace
@@ -230,6 +230,7 @@ DAWN_INSTANTIATE_TEST(TextureSubresourceTest,
                       OpenGLBackend(),
                       OpenGLESBackend(),
                       VulkanBackend(),
+                      VulkanBackend({"vulkan_use_synchronization2"}),
                       WebGPUBackend());
 
 }  // anonymous namespace
@@ -266,8 +266,12 @@ class TextureZeroInitTest : public DawnTest {
         wgpu::TextureFormat::RGBA8Snorm;
 };
 
+// The tests that only copy to, copy from and write to textures. They also run on the Null backend,
+// which executes copies and writes but does not render or dispatch.
+class TextureZeroInitCopyTest : public TextureZeroInitTest {};
+
 // This tests that the code path of CopyTextureToBuffer clears correctly to Zero after first usage
-TEST_P(TextureZeroInitTest, CopyTextureToBufferSource) {
+TEST_P(TextureZeroInitCopyTest, CopyTextureToBufferSource) {
     wgpu::TextureDescriptor descriptor = CreateTextureDescriptor(
         1, 1, wgpu::TextureUsage::RenderAttachment | wgpu::TextureUsage::CopySrc, kColorFormat);
     wgpu::Texture texture = device.CreateTexture(&descriptor);
@@ -282,7 +286,7 @@ TEST_P(TextureZeroInitTest, CopyTextureToBufferSource) {
 
 // This tests that the code path of CopyTextureToBuffer with multiple texture array layers clears
 // correctly to Zero after first usage
-TEST_P(TextureZeroInitTest, CopyMultipleTextureArrayLayersToBufferSource) {
+TEST_P(TextureZeroInitCopyTest, CopyMultipleTextureArrayLayersToBufferSource) {
     // TODO(crbug.com/500793610): Fails on Windows 11/AMD RX 5500 XT w/ D3D11.
     DAWN_SUPPRESS_TEST_IF(IsWindows11() && IsAMD() && IsD3D11());
 
@@ -420,7 +424,7 @@ TEST_P(TextureZeroInitTest, RenderingArrayLayerClearsToZero) {
 }
 
 // This tests CopyBufferToTexture fully overwrites copy so lazy init is not needed.
-TEST_P(TextureZeroInitTest, CopyBufferToTexture) {
+TEST_P(TextureZeroInitCopyTest, CopyBufferToTexture) {
     // TODO(crbug.com/40238674): Fails on Pixel 10.
     DAWN_SUPPRESS_TEST_IF(IsImgTec());
     wgpu::TextureDescriptor descriptor =
@@ -455,7 +459,7 @@ TEST_P(TextureZeroInitTest, CopyBufferToTexture) {
 
 // Test for a copy only to a subset of the subresource, lazy init is necessary to clear the other
 // half.
-TEST_P(TextureZeroInitTest, CopyBufferToTextureHalf) {
+TEST_P(TextureZeroInitCopyTest, CopyBufferToTextureHalf) {
     // TODO(348653642): D3D11 emulates B2T with a render pass, and render pass' lazy clear
     // is not currently counted properly. So GetLazyClearCountForTesting() would not return the
     // expected value.
@@ -497,7 +501,7 @@ TEST_P(TextureZeroInitTest, CopyBufferToTextureHalf) {
 
 // This tests CopyBufferToTexture fully overwrites a range of subresources, so lazy initialization
 // is needed for neither the subresources involved in the copy nor the other subresources.
-TEST_P(TextureZeroInitTest, CopyBufferToTextureMultipleArrayLayers) {
+TEST_P(TextureZeroInitCopyTest, CopyBufferToTextureMultipleArrayLayers) {
     wgpu::TextureDescriptor descriptor = CreateTextureDescriptor(
         1, 6, wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::CopySrc, kColorFormat);
     wgpu::Texture texture = device.CreateTexture(&descriptor);
@@ -535,7 +539,7 @@ TEST_P(TextureZeroInitTest, CopyBufferToTextureMultipleArrayLayers) {
 }
 
 // This tests CopyTextureToTexture fully overwrites copy so lazy init is not needed.
-TEST_P(TextureZeroInitTest, CopyTextureToTexture) {
+TEST_P(TextureZeroInitCopyTest, CopyTextureToTexture) {
     wgpu::TextureDescriptor srcDescriptor = CreateTextureDescriptor(
         1, 1, wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopySrc, kColorFormat);
     wgpu::Texture srcTexture = device.CreateTexture(&srcDescriptor);
@@ -572,7 +576,7 @@ TEST_P(TextureZeroInitTest, CopyTextureToTexture) {
 
 // This Tests the CopyTextureToTexture's copy only to a subset of the subresource, lazy init is
 // necessary to clear the other half.
-TEST_P(TextureZeroInitTest, CopyTextureToTextureHalf) {
+TEST_P(TextureZeroInitCopyTest, CopyTextureToTextureHalf) {
     wgpu::TextureDescriptor srcDescriptor =
         CreateTextureDescriptor(1, 1,
                                 wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopySrc |
@@ -1519,7 +1523,7 @@ TEST_P(TextureZeroInitTest, ComputePassSampledTextureClear) {
 }
 
 // This tests that the code path of CopyTextureToBuffer clears correctly for non-renderable textures
-TEST_P(TextureZeroInitTest, NonRenderableTextureClear) {
+TEST_P(TextureZeroInitCopyTest, NonRenderableTextureClear) {
     // TODO(dawn:1877): Snorm copy failing ANGLE Swiftshader, need further investigation.
     DAWN_SUPPRESS_TEST_IF(IsANGLESwiftShader());
 
@@ -1553,7 +1557,7 @@ TEST_P(TextureZeroInitTest, NonRenderableTextureClear) {
 }
 
 // This tests that the code path of CopyTextureToBuffer clears correctly for non-renderable textures
-TEST_P(TextureZeroInitTest, NonRenderableTextureClearUnalignedSize) {
+TEST_P(TextureZeroInitCopyTest, NonRenderableTextureClearUnalignedSize) {
     // TODO(dawn:1877): Snorm copy failing ANGLE Swiftshader, need further investigation.
     DAWN_SUPPRESS_TEST_IF(IsANGLESwiftShader());
 
@@ -1590,7 +1594,7 @@ TEST_P(TextureZeroInitTest, NonRenderableTextureClearUnalignedSize) {
 
 // This tests that the code path of CopyTextureToBuffer clears correctly for non-renderable textures
 // with more than 1 array layers
-TEST_P(TextureZeroInitTest, NonRenderableTextureClearWithMultiArrayLayers) {
+TEST_P(TextureZeroInitCopyTest, NonRenderableTextureClearWithMultiArrayLayers) {
     // TODO(dawn:1877): Snorm copy failing ANGLE Swiftshader, need further investigation.
     DAWN_SUPPRESS_TEST_IF(IsANGLESwiftShader());
 
@@ -1948,7 +1952,7 @@ TEST_P(TextureZeroInitTest, PreservesInitializedArrayLayer) {
 
 // This is a regression test for crbug.com/dawn/451 where the lazy texture
 // init path on D3D12 had a divide-by-zero exception in the copy split logic.
-TEST_P(TextureZeroInitTest, CopyTextureToBufferNonRenderableUnaligned) {
+TEST_P(TextureZeroInitCopyTest, CopyTextureToBufferNonRenderableUnaligned) {
     // TODO(dawn:1877): Snorm copy failing ANGLE Swiftshader, need further investigation.
     DAWN_SUPPRESS_TEST_IF(IsANGLESwiftShader());
 
@@ -1988,7 +1992,7 @@ TEST_P(TextureZeroInitTest, CopyTextureToBufferNonRenderableUnaligned) {
 }
 
 // In this test WriteTexture fully overwrites a texture
-TEST_P(TextureZeroInitTest, WriteWholeTexture) {
+TEST_P(TextureZeroInitCopyTest, WriteWholeTexture) {
     wgpu::TextureDescriptor descriptor = CreateTextureDescriptor(
         1, 1, wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::CopySrc, kColorFormat);
     wgpu::Texture texture = device.CreateTexture(&descriptor);
@@ -2021,7 +2025,7 @@ TEST_P(TextureZeroInitTest, WriteWholeTexture) {
 
 // Test WriteTexture to a subset of the texture, lazy init is necessary to clear the other
 // half.
-TEST_P(TextureZeroInitTest, WriteTextureHalf) {
+TEST_P(TextureZeroInitCopyTest, WriteTextureHalf) {
     wgpu::TextureDescriptor descriptor =
         CreateTextureDescriptor(4, 1,
                                 wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::TextureBinding |
@@ -2060,7 +2064,7 @@ TEST_P(TextureZeroInitTest, WriteTextureHalf) {
 
 // In this test WriteTexture fully overwrites a range of subresources, so lazy initialization
 // is needed for neither the subresources involved in the write nor the other subresources.
-TEST_P(TextureZeroInitTest, WriteWholeTextureArray) {
+TEST_P(TextureZeroInitCopyTest, WriteWholeTextureArray) {
     wgpu::TextureDescriptor descriptor = CreateTextureDescriptor(
         1, 6, wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::CopySrc, kColorFormat);
     wgpu::Texture texture = device.CreateTexture(&descriptor);
@@ -2100,7 +2104,7 @@ TEST_P(TextureZeroInitTest, WriteWholeTextureArray) {
 
 // Test WriteTexture to a subset of the subresource, lazy init is necessary to clear the other
 // half.
-TEST_P(TextureZeroInitTest, WriteTextureArrayHalf) {
+TEST_P(TextureZeroInitCopyTest, WriteTextureArrayHalf) {
     wgpu::TextureDescriptor descriptor =
         CreateTextureDescriptor(4, 6,
                                 wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::TextureBinding |
@@ -2144,7 +2148,7 @@ TEST_P(TextureZeroInitTest, WriteTextureArrayHalf) {
 }
 
 // In this test WriteTexture fully overwrites a texture at mip level.
-TEST_P(TextureZeroInitTest, WriteWholeTextureAtMipLevel) {
+TEST_P(TextureZeroInitCopyTest, WriteWholeTextureAtMipLevel) {
     wgpu::TextureDescriptor descriptor = CreateTextureDescriptor(
         4, 1, wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::CopySrc, kColorFormat);
     wgpu::Texture texture = device.CreateTexture(&descriptor);
@@ -2180,7 +2184,7 @@ TEST_P(TextureZeroInitTest, WriteWholeTextureAtMipLevel) {
 
 // Test WriteTexture to a subset of the texture at mip level, lazy init is necessary to clear the
 // other half.
-TEST_P(TextureZeroInitTest, WriteTextureHalfAtMipLevel) {
+TEST_P(TextureZeroInitCopyTest, WriteTextureHalfAtMipLevel) {
     wgpu::TextureDescriptor descriptor =
         CreateTextureDescriptor(4, 1,
                                 wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::TextureBinding |
@@ -2257,6 +2261,24 @@ DAWN_INSTANTIATE_TEST(
                   "use_blit_for_buffer_to_stencil_texture_copy"}),
     VulkanBackend({"nonzero_clear_resources_on_creation_for_testing"}));
 
+DAWN_INSTANTIATE_TEST(
+    TextureZeroInitCopyTest,
+    D3D11Backend({"nonzero_clear_resources_on_creation_for_testing"}),
+    D3D12Backend({"nonzero_clear_resources_on_creation_for_testing"}),
+    D3D12Backend({"nonzero_clear_resources_on_creation_for_testing"}, {"use_d3d12_render_pass"}),
+    OpenGLBackend({"nonzero_clear_resources_on_creation_for_testing"}),
+    OpenGLESBackend({"nonzero_clear_resources_on_creation_for_testing"}),
+    OpenGLESBackend({"gl_defer", "nonzero_clear_resources_on_creation_for_testing"}),
+    MetalBackend({"nonzero_clear_resources_on_creation_for_testing",
+                  "metal_keep_multisubresource_depth_stencil_textures_initialized"}),
+    MetalBackend({"nonzero_clear_resources_on_creation_for_testing"},
+                 {"metal_keep_multisubresource_depth_stencil_textures_initialized"}),
+    MetalBackend({"nonzero_clear_resources_on_creation_for_testing",
+                  "use_blit_for_buffer_to_depth_texture_copy",
+                  "use_blit_for_buffer_to_stencil_texture_copy"}),
+    NullBackend({"null_backend_execute_commands"}),
+    VulkanBackend({"nonzero_clear_resources_on_creation_for_testing"}));
+
 // =============================================================================
 // LazyClearRenderPassAttachments must take sub-rect RenderPassRenderArea into
 // account. Tests based on a Project Fortify-produced POC.
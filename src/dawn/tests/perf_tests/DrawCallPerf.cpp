@@ -240,6 +240,10 @@ class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
     template <typename Encoder>
     void RecordRenderCommands(Encoder pass);
 
+    // Prints the average number of command blocks allocated from the heap per frame, ignoring the
+    // first frame which fills the recycled block caches.
+    void PrintCommandBlockAllocations();
+
   private:
     void Step() override;
 
@@ -268,6 +272,9 @@ class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
     wgpu::TextureView mDepthStencilAttachment;
 
     wgpu::RenderBundle mRenderBundle;
+
+    unsigned int mFramesRecorded = 0;
+    uint64_t mCommandBlockAllocations = 0;
 };
 
 void DrawCallPerf::SetUpPerfTest() {
@@ -583,6 +590,9 @@ void DrawCallPerf::Step() {
         }
     }
 
+    uint64_t allocationsBefore =
+        UsesWire() ? 0 : native::GetCommandBlockAllocationCountForTesting(device.Get());
+
     wgpu::CommandEncoder commands = device.CreateCommandEncoder();
     utils::ComboRenderPassDescriptor renderPass({mColorAttachment}, mDepthStencilAttachment);
     wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
@@ -602,10 +612,25 @@ void DrawCallPerf::Step() {
     pass.End();
     wgpu::CommandBuffer commandBuffer = commands.Finish();
     queue.Submit(1, &commandBuffer);
+
+    if (!UsesWire() && mFramesRecorded++ > 0) {
+        mCommandBlockAllocations +=
+            native::GetCommandBlockAllocationCountForTesting(device.Get()) - allocationsBefore;
+    }
+}
+
+void DrawCallPerf::PrintCommandBlockAllocations() {
+    if (UsesWire() || mFramesRecorded < 2) {
+        return;
+    }
+    PrintResult("command_block_allocations",
+                static_cast<double>(mCommandBlockAllocations) / (mFramesRecorded - 1),
+                "allocs/frame", false);
 }
 
 TEST_P(DrawCallPerf, Run) {
     RunTest();
+    PrintCommandBlockAllocations();
 }
 
 DAWN_INSTANTIATE_TEST_P(
@@ -97,10 +97,22 @@ class SubresourceTrackingPerf : public DawnPerfTestWithParams<SubresourceTrackin
         mPipeline = device.CreateRenderPipeline(&pipelineDesc);
     }
 
+    // Prints the average number of pipeline barrier commands recorded per step.
+    void PrintPipelineBarriers() {
+        if (UsesWire() || mStepsRecorded == 0) {
+            return;
+        }
+        PrintResult("pipeline_barriers", static_cast<double>(mPipelineBarriers) / mStepsRecorded,
+                    "barriers/step", false);
+    }
+
   private:
     void Step() override {
         const SubresourceTrackingParams& params = GetParam();
 
+        uint64_t barriersBefore =
+            UsesWire() ? 0 : native::GetPipelineBarrierCountForTesting(device.Get());
+
         uint32_t layerUploaded = params.arrayLayerCount / 2;
 
         wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
@@ -147,8 +159,17 @@ class SubresourceTrackingPerf : public DawnPerfTestWithParams<SubresourceTrackin
 
         wgpu::CommandBuffer commands = encoder.Finish();
         queue.Submit(1, &commands);
+
+        if (!UsesWire()) {
+            mPipelineBarriers +=
+                native::GetPipelineBarrierCountForTesting(device.Get()) - barriersBefore;
+            mStepsRecorded++;
+        }
     }
 
+    uint64_t mStepsRecorded = 0;
+    uint64_t mPipelineBarriers = 0;
+
     wgpu::Texture mUploadTexture;
     wgpu::Texture mMaterials;
     wgpu::RenderPipeline mPipeline;
@@ -156,10 +177,12 @@ class SubresourceTrackingPerf : public DawnPerfTestWithParams<SubresourceTrackin
 
 TEST_P(SubresourceTrackingPerf, Run) {
     RunTest();
+    PrintPipelineBarriers();
 }
 
 DAWN_INSTANTIATE_TEST_P(SubresourceTrackingPerf,
-                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+                         VulkanBackend({"vulkan_use_synchronization2"})},
                         {1, 4, 16, 256},
                         {2, 3, 8});
 
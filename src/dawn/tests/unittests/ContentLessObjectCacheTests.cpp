@@ -63,6 +63,8 @@ class CacheableT : public RefCounted, public ContentLessObjectCacheable<Cacheabl
         }
     };
 
+    size_t GetValue() const { return mValue; }
+
     void SetHashFn(std::function<void(const CacheableT*)> fn) { mHashFn = fn; }
     void SetEqualFn(std::function<void(const CacheableT*)> fn) { mEqualFn = fn; }
     void SetDeleteFn(std::function<void(CacheableT*)> fn) { mDeleteFn = fn; }
@@ -420,5 +422,96 @@ TEST(ContentLessObjectCacheTest, InsertDeletingLastRefHashEquivalent) {
     tB.join();
 }
 
+// Concurrent inserts, finds and erases of objects spread over all the shards keep the cache
+// consistent, and every object is erased once its last reference is dropped.
+TEST(ContentLessObjectCacheTest, ConcurrentInsertFindErase) {
+    constexpr size_t kNumValues = 64;
+    constexpr size_t kNumIterations = 2000;
+    constexpr size_t kNumThreads = 8;
+    ContentLessObjectCache<CacheableT> cache;
+
+    auto f = [&](size_t seed) {
+        for (size_t i = 0; i < kNumIterations; i++) {
+            size_t value = (seed * 7919 + i * 31) % kNumValues;
+
+            Ref<CacheableT> object = AcquireRef(new CacheableT(value));
+            object->SetDeleteFn([&](CacheableT* x) { cache.Erase(x); });
+            auto [cached, inserted] = cache.Insert(object.Get());
+            ASSERT_NE(cached.Get(), nullptr);
+            EXPECT_EQ(cached->GetValue(), value);
+            EXPECT_EQ(inserted, cached.Get() == object.Get());
+
+            // The object is live, so an equivalent lookup finds it, or an equivalent object that
+            // replaced it after another thread dropped the last reference of the cached one.
+            CacheableT blueprint(value);
+            Ref<CacheableT> found = cache.Find(&blueprint);
+            if (found != nullptr) {
+                EXPECT_EQ(found->GetValue(), value);
+            }
+
+            // Lookups of other values, possibly in other shards, race with their erasure.
+            CacheableT otherBlueprint((value + 1) % kNumValues);
+            Ref<CacheableT> other = cache.Find(&otherBlueprint);
+            if (other != nullptr) {
+                EXPECT_EQ(other->GetValue(), (value + 1) % kNumValues);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kNumThreads; t++) {
+        threads.emplace_back(f, t);
+    }
+    for (size_t t = 0; t < kNumThreads; t++) {
+        threads[t].join();
+    }
+    EXPECT_TRUE(cache.Empty());
+}
+
+// Objects in other shards can be found and inserted while the last reference of a cached object is
+// being released, and the pending erase only removes the object that is being destroyed.
+TEST(ContentLessObjectCacheTest, FindAndInsertWhileErasingLastRef) {
+    BinarySemaphore semA, semB;
+
+    ContentLessObjectCache<CacheableT> cache;
+    Ref<CacheableT> object1 = AcquireRef(new CacheableT(1));
+    object1->SetDeleteFn([&](CacheableT* x) { cache.Erase(x); });
+    EXPECT_TRUE(cache.Insert(object1.Get()).second);
+
+    Ref<CacheableT> object2 = AcquireRef(new CacheableT(2));
+    object2->SetDeleteFn([&](CacheableT* x) {
+        semA.Release();
+        semB.Acquire();
+        cache.Erase(x);
+    });
+    EXPECT_TRUE(cache.Insert(object2.Get()).second);
+
+    Ref<CacheableT> object3 = AcquireRef(new CacheableT(2));
+    object3->SetDeleteFn([&](CacheableT* x) { cache.Erase(x); });
+
+    // Thread A will release the last reference of the second object.
+    auto threadA = [&] { object2 = nullptr; };
+    // Thread B will look up the objects while the second one is being destroyed.
+    auto threadB = [&] {
+        semA.Acquire();
+        CacheableT blueprint1(1);
+        EXPECT_TRUE(cache.Find(&blueprint1) == object1.Get());
+        CacheableT blueprint2(2);
+        EXPECT_TRUE(cache.Find(&blueprint2) == nullptr);
+        EXPECT_TRUE(cache.Insert(object3.Get()).second);
+        semB.Release();
+    };
+
+    std::thread tA(threadA);
+    std::thread tB(threadB);
+    tA.join();
+    tB.join();
+
+    CacheableT blueprint1(1);
+    EXPECT_TRUE(cache.Find(&blueprint1) == object1.Get());
+    CacheableT blueprint2(2);
+    EXPECT_TRUE(cache.Find(&blueprint2) == object3.Get());
+}
+
 }  // anonymous namespace
 }  // namespace dawn
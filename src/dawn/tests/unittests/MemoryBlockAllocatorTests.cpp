@@ -25,6 +25,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -175,4 +176,74 @@ TEST(MemoryBlockAllocator, AllocateAndReturnManyBlocks) {
     pool.Return(std::move(reallocated));
 }
 
+// Blocks recycled by a thread are reused by that thread without any new heap allocation, even
+// once the number of blocks it records exceeds the initial capacity of its free list.
+TEST(MemoryBlockAllocator, SteadyStateFramesDoNotAllocate) {
+    MemoryBlockAllocator pool(kBlockSize);
+    constexpr size_t kBlocksPerFrame = 40;
+
+    auto RecordAndReleaseFrame = [&] {
+        std::vector<HeapArray<std::byte>> blocks;
+        for (size_t i = 0; i < kBlocksPerFrame; ++i) {
+            blocks.push_back(pool.Allocate(kBlockSize));
+        }
+        pool.Return(std::move(blocks));
+    };
+
+    RecordAndReleaseFrame();
+    RecordAndReleaseFrame();
+    uint64_t allocationCount = pool.GetHeapAllocationCount();
+    EXPECT_GE(allocationCount, kBlocksPerFrame);
+
+    for (size_t frame = 0; frame < 10; ++frame) {
+        RecordAndReleaseFrame();
+    }
+    EXPECT_EQ(pool.GetHeapAllocationCount(), allocationCount);
+    EXPECT_EQ(pool.GetRecycledBlockCountForTesting(), kBlocksPerFrame);
+}
+
+// Blocks returned on one thread can be allocated on another thread, and Tick() / TrimMemory()
+// reach the blocks held by other threads.
+TEST(MemoryBlockAllocator, BlocksAreSharedAcrossThreads) {
+    MemoryBlockAllocator pool(kBlockSize, 2);
+    constexpr size_t kNumBlocks = 20;
+
+    std::vector<HeapArray<std::byte>> blocks;
+    for (size_t i = 0; i < kNumBlocks; ++i) {
+        blocks.push_back(pool.Allocate(kBlockSize));
+    }
+    std::thread([&] { pool.Return(std::move(blocks)); }).join();
+    EXPECT_EQ(pool.GetRecycledBlockCountForTesting(), kNumBlocks);
+
+    // The returning thread only keeps a few blocks since it never allocated, the rest are in the
+    // shared free list and are reused instead of allocating new blocks.
+    uint64_t allocationCount = pool.GetHeapAllocationCount();
+    std::vector<HeapArray<std::byte>> reallocated;
+    for (size_t i = 0; i < kNumBlocks / 2; ++i) {
+        reallocated.push_back(pool.Allocate(kBlockSize));
+    }
+    EXPECT_EQ(pool.GetHeapAllocationCount(), allocationCount);
+    pool.Return(std::move(reallocated));
+
+    pool.Tick();
+    pool.Tick();
+    EXPECT_EQ(pool.GetRecycledBlockCountForTesting(), 0u);
+
+    std::vector<HeapArray<std::byte>> more;
+    more.push_back(pool.Allocate(kBlockSize));
+    std::thread([&] { pool.Return(std::move(more)); }).join();
+    EXPECT_EQ(pool.GetRecycledBlockCountForTesting(), 1u);
+    pool.TrimMemory();
+    EXPECT_EQ(pool.GetRecycledBlockCountForTesting(), 0u);
+}
+
+// Requests larger than the block size are always counted as heap allocations.
+TEST(MemoryBlockAllocator, OversizedAllocationsAreCounted) {
+    MemoryBlockAllocator pool(kBlockSize);
+    EXPECT_EQ(pool.GetHeapAllocationCount(), 0u);
+
+    HeapArray<std::byte> block = pool.Allocate(kBlockSize + 1);
+    EXPECT_EQ(pool.GetHeapAllocationCount(), 1u);
+}
+
 }  // namespace dawn
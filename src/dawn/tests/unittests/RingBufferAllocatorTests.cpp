@@ -122,6 +122,7 @@ TEST(RingBufferAllocatorTests, RingBufferSubAlloc) {
     ASSERT_EQ(allocator.Allocate(frameSizeInBytes * 3, serial),
               RingBufferAllocator::kInvalidOffset);
     ASSERT_EQ(allocator.GetUsedSize(), frameSizeInBytes * 8);
+    EXPECT_EQ(allocator.GetWrapCount(), 0u);
 
     // Reclaim the first 3 frames.
     allocator.Deallocate(ExecutionSerial(2u));
@@ -144,6 +145,7 @@ TEST(RingBufferAllocatorTests, RingBufferSubAlloc) {
 
     ASSERT_EQ(offset, 0u);
     ASSERT_EQ(allocator.GetUsedSize(), frameSizeInBytes * maxNumOfFrames);
+    EXPECT_EQ(allocator.GetWrapCount(), 1u);
 
     // Ensure we are full.
     ASSERT_EQ(allocator.Allocate(frameSizeInBytes, serial), RingBufferAllocator::kInvalidOffset);
@@ -162,6 +164,8 @@ TEST(RingBufferAllocatorTests, RingBufferSubAlloc) {
 
     ASSERT_EQ(offset, frameSizeInBytes * 3);
     ASSERT_EQ(allocator.GetUsedSize(), frameSizeInBytes * maxNumOfFrames);
+    // Sub-allocating in the middle of a split buffer is not a wrap.
+    EXPECT_EQ(allocator.GetWrapCount(), 1u);
 
     //        F9         F10      F6   F7   F8
     //  [xxxxxxxxxxxx|xxxxxxxxx|xxxx|xxxx|xxxx|xxxxxxxx]
@@ -748,6 +748,62 @@ TEST(SubresourceStorageTest, FillAfterModificationRecompresses) {
     CheckAspectCompressed(s, Aspect::Stencil, true);
 }
 
+// Check that All() visits compressed aspects and layers once and stops at the first false.
+TEST(SubresourceStorageTest, AllOnCompressedStorage) {
+    const uint32_t kLayers = 5;
+    const uint32_t kLevels = 4;
+    SubresourceStorage<bool> s(Aspect::Depth | Aspect::Stencil, kLayers, kLevels, true);
+    SubresourceRange fullRange(Aspect::Depth | Aspect::Stencil, {0, kLayers}, {0, kLevels});
+
+    // Fully compressed: the predicate is called once per aspect.
+    uint32_t callCount = 0;
+    EXPECT_TRUE(s.All(fullRange, [&](const bool& data) {
+        callCount++;
+        return data;
+    }));
+    EXPECT_EQ(callCount, 2u);
+
+    // Decompress one layer of the stencil aspect, the depth aspect stays compressed and the
+    // stencil aspect is visited once per layer plus once per level of the decompressed layer.
+    s.Update(SubresourceRange::MakeSingle(Aspect::Stencil, 2, 3),
+             [](const SubresourceRange&, bool* data) { *data = false; });
+    callCount = 0;
+    EXPECT_TRUE(s.All(SubresourceRange(Aspect::Depth, {0, kLayers}, {0, kLevels}),
+                      [&](const bool& data) {
+                          callCount++;
+                          return data;
+                      }));
+    EXPECT_EQ(callCount, 1u);
+
+    callCount = 0;
+    EXPECT_FALSE(s.All(fullRange, [&](const bool& data) {
+        callCount++;
+        return data;
+    }));
+    // 1 for depth, 2 for stencil layers 0 and 1, 4 for the levels of layer 2.
+    EXPECT_EQ(callCount, 7u);
+}
+
+// Check that All() only looks at the subresources in the range.
+TEST(SubresourceStorageTest, AllOnSubrange) {
+    const uint32_t kLayers = 4;
+    const uint32_t kLevels = 3;
+    SubresourceStorage<bool> s(Aspect::Color, kLayers, kLevels, false);
+    auto isTrue = [](const bool& data) { return data; };
+
+    SubresourceRange written(Aspect::Color, {1, 2}, {1, 2});
+    s.Update(written, [](const SubresourceRange&, bool* data) { *data = true; });
+
+    EXPECT_TRUE(s.All(written, isTrue));
+    EXPECT_TRUE(s.All(SubresourceRange::MakeSingle(Aspect::Color, 2, 2), isTrue));
+    EXPECT_FALSE(s.All(SubresourceRange(Aspect::Color, {1, 2}, {0, 2}), isTrue));
+    EXPECT_FALSE(s.All(SubresourceRange(Aspect::Color, {0, 2}, {1, 2}), isTrue));
+    EXPECT_FALSE(s.All(SubresourceRange(Aspect::Color, {0, kLayers}, {0, kLevels}), isTrue));
+
+    // An empty range is trivially true.
+    EXPECT_TRUE(s.All(SubresourceRange(Aspect::Color, {0, 0}, {0, kLevels}), isTrue));
+}
+
 // Bugs found while testing:
 //  - mLayersCompressed not initialized to true.
 //  - DecompressLayer setting Compressed to true instead of false.
@@ -25,10 +25,13 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "dawn/platform/DawnPlatform.h"
 #include "gtest/gtest.h"
+#include "src/dawn/platform/WorkerThread.h"
 #include "src/dawn/tests/MockCallback.h"
 
 namespace dawn {
@@ -114,5 +117,65 @@ TEST_F(WorkerTaskPoolTests, PostJobCancel) {
     handle->Join();
 }
 
+// Verifies that many tasks posted to a pool with several threads all complete, and are counted.
+TEST(AsyncWorkerThreadPoolTests, ManyTasks) {
+    constexpr uint32_t kTaskCount = 200;
+    platform::AsyncWorkerThreadPool pool(4);
+
+    std::atomic<uint32_t> result = 0;
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; i++) {
+        events.push_back(pool.PostWorkerTaskWithPriority(
+            [](void* userdata) { (*static_cast<std::atomic<uint32_t>*>(userdata))++; }, &result,
+            i % 2 == 0 ? platform::TaskPriority::UserVisible : platform::TaskPriority::Background));
+    }
+    for (auto& event : events) {
+        event->Wait();
+    }
+    EXPECT_EQ(result, kTaskCount);
+
+    platform::AsyncWorkerThreadPool::Counters counters = pool.GetCounters();
+    EXPECT_EQ(counters.completedTasks, kTaskCount);
+    EXPECT_EQ(counters.queuedTasks[0], 0u);
+    EXPECT_EQ(counters.queuedTasks[1], 0u);
+    EXPECT_GE(counters.totalWaitTime, counters.maxWaitTime);
+}
+
+// Verifies that pending tasks with a higher priority are started first.
+TEST(AsyncWorkerThreadPoolTests, Priorities) {
+    platform::AsyncWorkerThreadPool pool(1);
+
+    // Block the only thread until all the tasks are posted.
+    std::atomic<bool> blocked = true;
+    auto blockingEvent = pool.PostWorkerTask(
+        [](void* userdata) { static_cast<std::atomic<bool>*>(userdata)->wait(true); }, &blocked);
+
+    struct Order {
+        std::atomic<uint32_t> next = 0;
+        uint32_t background = 0;
+        uint32_t userVisible = 0;
+    } order;
+    auto backgroundEvent = pool.PostWorkerTaskWithPriority(
+        [](void* userdata) {
+            Order* order = static_cast<Order*>(userdata);
+            order->background = order->next++;
+        },
+        &order, platform::TaskPriority::Background);
+    auto userVisibleEvent = pool.PostWorkerTaskWithPriority(
+        [](void* userdata) {
+            Order* order = static_cast<Order*>(userdata);
+            order->userVisible = order->next++;
+        },
+        &order, platform::TaskPriority::UserVisible);
+
+    blocked = false;
+    blocked.notify_all();
+    blockingEvent->Wait();
+    backgroundEvent->Wait();
+    userVisibleEvent->Wait();
+
+    EXPECT_LT(order.userVisible, order.background);
+}
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -25,9 +25,11 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <memory>
 #include <vector>
 
 #include "dawn/dawn_version.h"
+#include "dawn/platform/DawnPlatform.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/dawn/native/BlobCache.h"
@@ -51,6 +53,12 @@ CacheKey CreateValidKey() {
     return key;
 }
 
+CacheKey CreateValidKey(uint32_t index) {
+    CacheKey key = CreateValidKey();
+    stream::StreamIn(&key, index);
+    return key;
+}
+
 TEST(BlobCacheTests, StoreAndLoad) {
     MockCppCallback<size_t (*)(std::span<const std::byte>, std::span<std::byte>)> mockLoadCallback;
     MockCppCallback<void (*)(std::span<const std::byte>, std::span<const std::byte>)>
@@ -95,5 +103,117 @@ TEST(BlobCacheTests, StoreAndLoad) {
     EXPECT_TRUE(std::ranges::equal(loadedBlob.Data(), value));
 }
 
+// Test that blobs in the memory tier are loaded without calling the load callback.
+TEST(BlobCacheTests, MemoryTierHit) {
+    MockCppCallback<size_t (*)(std::span<const std::byte>, std::span<std::byte>)> mockLoadCallback;
+    MockCppCallback<void (*)(std::span<const std::byte>, std::span<const std::byte>)>
+        mockStoreCallback;
+
+    wgpu::DawnCacheDeviceDescriptor desc = {};
+    desc.SetDawnLoadCacheDataCallback(mockLoadCallback.TemplatedCallback(), &mockLoadCallback);
+    desc.SetDawnStoreCacheDataCallback(mockStoreCallback.TemplatedCallback(), &mockStoreCallback);
+
+    BlobCache cache(*FromCppAPI(&desc), true, /*memoryBudget=*/1024);
+
+    CacheKey key = CreateValidKey();
+    const std::vector<std::byte> value = {std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+
+    EXPECT_CALL(mockStoreCallback, Call(_, _)).Times(1);
+    EXPECT_CALL(mockLoadCallback, Call(_, _)).Times(0);
+    cache.Store(key, value);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        auto result = cache.Load(key);
+        ASSERT_TRUE(result.IsSuccess());
+        EXPECT_TRUE(std::ranges::equal(result.AcquireSuccess().Data(), value));
+    }
+}
+
+// Test that the least recently used blobs are evicted from the memory tier to stay in its budget.
+TEST(BlobCacheTests, MemoryTierEvictsLeastRecentlyUsed) {
+    MockCppCallback<size_t (*)(std::span<const std::byte>, std::span<std::byte>)> mockLoadCallback;
+
+    wgpu::DawnCacheDeviceDescriptor desc = {};
+    desc.SetDawnLoadCacheDataCallback(mockLoadCallback.TemplatedCallback(), &mockLoadCallback);
+
+    BlobCache cache(*FromCppAPI(&desc), false, /*memoryBudget=*/8);
+
+    const std::vector<std::byte> value = {std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+    cache.Store(CreateValidKey(0), value);
+    cache.Store(CreateValidKey(1), value);
+
+    // Use the first blob so that the second one is the least recently used.
+    EXPECT_CALL(mockLoadCallback, Call(_, _)).Times(0);
+    EXPECT_FALSE(cache.Load(CreateValidKey(0)).AcquireSuccess().Empty());
+    testing::Mock::VerifyAndClearExpectations(&mockLoadCallback);
+
+    cache.Store(CreateValidKey(2), value);
+
+    // The second blob was evicted and is looked up with the load callback.
+    CacheKey evictedKey = CreateValidKey(1);
+    EXPECT_CALL(mockLoadCallback, Call(_, _))
+        .WillOnce([&](std::span<const std::byte> k, std::span<std::byte> v) -> size_t {
+            EXPECT_TRUE(std::ranges::equal(k, evictedKey));
+            return 0;
+        });
+    EXPECT_TRUE(cache.Load(evictedKey).AcquireSuccess().Empty());
+    EXPECT_FALSE(cache.Load(CreateValidKey(0)).AcquireSuccess().Empty());
+    EXPECT_FALSE(cache.Load(CreateValidKey(2)).AcquireSuccess().Empty());
+}
+
+// Test that stores are passed to the store callback on the worker task pool when one is set.
+TEST(BlobCacheTests, WriteBehindStores) {
+    MockCppCallback<size_t (*)(std::span<const std::byte>, std::span<std::byte>)> mockLoadCallback;
+    MockCppCallback<void (*)(std::span<const std::byte>, std::span<const std::byte>)>
+        mockStoreCallback;
+
+    wgpu::DawnCacheDeviceDescriptor desc = {};
+    desc.SetDawnLoadCacheDataCallback(mockLoadCallback.TemplatedCallback(), &mockLoadCallback);
+    desc.SetDawnStoreCacheDataCallback(mockStoreCallback.TemplatedCallback(), &mockStoreCallback);
+
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform::WorkerTaskPool::CreateDawnDefault(2);
+    BlobCache cache(*FromCppAPI(&desc), false);
+    cache.SetWorkerTaskPool(pool.get());
+
+    constexpr uint32_t kStoreCount = 16;
+    const std::vector<std::byte> value = {std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+
+    EXPECT_CALL(mockStoreCallback, Call(_, _))
+        .Times(kStoreCount)
+        .WillRepeatedly([&](std::span<const std::byte> k, std::span<const std::byte> v) {
+            EXPECT_TRUE(std::ranges::equal(v, value));
+        });
+    for (uint32_t i = 0; i < kStoreCount; i++) {
+        cache.Store(CreateValidKey(i), value);
+    }
+    cache.Flush();
+}
+
+// Test that detaching the worker task pool hands the queued stores to the store callback, and that
+// the stores that follow are synchronous.
+TEST(BlobCacheTests, DetachWorkerTaskPool) {
+    MockCppCallback<void (*)(std::span<const std::byte>, std::span<const std::byte>)>
+        mockStoreCallback;
+
+    wgpu::DawnCacheDeviceDescriptor desc = {};
+    desc.SetDawnStoreCacheDataCallback(mockStoreCallback.TemplatedCallback(), &mockStoreCallback);
+
+    std::unique_ptr<platform::WorkerTaskPool> pool = platform::WorkerTaskPool::CreateDawnDefault(1);
+    BlobCache cache(*FromCppAPI(&desc), false);
+    cache.SetWorkerTaskPool(pool.get());
+
+    const std::vector<std::byte> value = {std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+
+    EXPECT_CALL(mockStoreCallback, Call(_, _)).Times(1);
+    cache.Store(CreateValidKey(0), value);
+    cache.DetachWorkerTaskPool();
+    testing::Mock::VerifyAndClearExpectations(&mockStoreCallback);
+
+    pool = nullptr;
+    EXPECT_CALL(mockStoreCallback, Call(_, _)).Times(1);
+    cache.Store(CreateValidKey(1), value);
+    testing::Mock::VerifyAndClearExpectations(&mockStoreCallback);
+}
+
 }  // namespace
 }  // namespace dawn::native
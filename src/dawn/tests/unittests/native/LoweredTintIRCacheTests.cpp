@@ -0,0 +1,156 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "src/dawn/native/BlobCache.h"
+#include "src/dawn/native/CacheKey.h"
+#include "src/dawn/native/Device.h"
+#include "src/dawn/native/ShaderModule.h"
+#include "src/dawn/tests/DawnNativeTest.h"
+#include "src/dawn/tests/mocks/platform/CachingInterfaceMock.h"
+#include "src/dawn/utils/WGPUHelpers.h"
+
+namespace dawn::native {
+namespace {
+
+using ::testing::NiceMock;
+
+static constexpr std::string_view kComputeShader = R"(
+        @group(0) @binding(0) var<storage, read_write> data : array<u32>;
+
+        @compute @workgroup_size(64) fn main(@builtin(global_invocation_id) id : vec3u) {
+            data[id.x] = data[id.x] * 2u + 1u;
+        }
+    )";
+
+class LoweredTintIRCacheTests : public DawnNativeTest,
+                                public ::testing::WithParamInterface<bool> {
+  public:
+    wgpu::DawnTogglesDescriptor DeviceToggles() override {
+        // Explicitly set the toggle based on the test parameter.
+        wgpu::DawnTogglesDescriptor toggles = {};
+        if (GetParam()) {
+            toggles.enabledToggles = &kCacheLoweredTintIRToggle;
+            toggles.enabledToggleCount = 1;
+        } else {
+            toggles.disabledToggles = &kCacheLoweredTintIRToggle;
+            toggles.disabledToggleCount = 1;
+        }
+        return toggles;
+    }
+
+  protected:
+    std::unique_ptr<dawn::platform::Platform> CreateTestPlatform() override {
+        return std::make_unique<DawnCachingMockPlatform>(&mMockCache);
+    }
+
+    bool ExpectCaching() const {
+#if TINT_BUILD_IR_BINARY
+        return GetParam();
+#else
+        return false;
+#endif
+    }
+
+    tint::core::ir::Module GetLoweredTintIR(ShaderModuleBase* shaderModule) {
+        auto result = shaderModule->GetLoweredTintIR({});
+        if (result.IsError()) {
+            ADD_FAILURE() << result.AcquireError()->GetMessage();
+            return {};
+        }
+        return result.AcquireSuccess();
+    }
+
+    NiceMock<CachingInterfaceMock> mMockCache;
+    static constexpr const char* kCacheLoweredTintIRToggle = "cache_lowered_tint_ir";
+};
+
+// Test that lowering a shader module stores the lowered IR in the blob cache, and that lowering it
+// again after its Tint program was released decodes the IR instead of recreating the program.
+TEST_P(LoweredTintIRCacheTests, LoadsWithoutRecreatingTintProgram) {
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kComputeShader.data());
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+
+    size_t entriesBefore = mMockCache.GetNumEntries();
+    tint::core::ir::Module lowered = GetLoweredTintIR(shaderModule.Get());
+    EXPECT_EQ(mMockCache.GetNumEntries() - entriesBefore, ExpectCaching() ? 1u : 0u);
+
+    // Dropping the last external reference releases the Tint program.
+    module = {};
+    EXPECT_FALSE(shaderModule->GetNullableTintProgramForTesting());
+
+    size_t hitsBefore = mMockCache.GetHitCount();
+    tint::core::ir::Module loaded = GetLoweredTintIR(shaderModule.Get());
+    EXPECT_EQ(mMockCache.GetHitCount() - hitsBefore, ExpectCaching() ? 1u : 0u);
+    EXPECT_EQ(shaderModule->GetTintProgramRecreateCountForTesting(), ExpectCaching() ? 0 : 1);
+
+    // The decoded IR has the same entry point as the lowered one.
+    auto countEntryPoints = [](const tint::core::ir::Module& ir) {
+        size_t count = 0;
+        for (const tint::core::ir::Function* function : ir.functions) {
+            count += function->IsEntryPoint() ? 1 : 0;
+        }
+        return count;
+    };
+    EXPECT_EQ(countEntryPoints(lowered), 1u);
+    EXPECT_EQ(countEntryPoints(loaded), 1u);
+}
+
+// Test that a blob that can't be decoded is treated as a cache miss and replaced.
+TEST_P(LoweredTintIRCacheTests, UndecodableBlobIsReplaced) {
+    if (!ExpectCaching()) {
+        GTEST_SKIP();
+    }
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kComputeShader.data());
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    DeviceBase* deviceBase = FromAPI(device.Get());
+
+    CacheKey key;
+    StreamIn(&key, CacheKey::Type::LoweredTintIR, deviceBase->GetCacheKey(),
+             shaderModule->GetHash());
+    const std::string garbage = "not a Tint IR module";
+    deviceBase->GetBlobCache()->Store(
+        key, std::as_bytes(std::span<const char>(garbage.data(), garbage.size())));
+
+    tint::core::ir::Module ir = GetLoweredTintIR(shaderModule.Get());
+    EXPECT_FALSE(ir.functions.IsEmpty());
+
+    // The blob was overwritten with the encoded IR, which decodes on the next call.
+    module = {};
+    GetLoweredTintIR(shaderModule.Get());
+    EXPECT_EQ(shaderModule->GetTintProgramRecreateCountForTesting(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(, LoweredTintIRCacheTests, ::testing::Bool());
+
+}  // anonymous namespace
+}  // namespace dawn::native
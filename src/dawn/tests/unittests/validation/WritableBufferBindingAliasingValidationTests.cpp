@@ -25,6 +25,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -644,5 +645,58 @@ TEST_F(WritableBufferBindingAliasingValidationTests, SetBindGroupLazyAspectDynam
     }
 }
 
+// Test that alternating between bind group states that were already validated is still valid, and
+// that the cache of validated states doesn't hide an invalid state set afterwards.
+TEST_F(WritableBufferBindingAliasingValidationTests, AlternatingValidatedBindGroupStates) {
+    wgpu::Buffer bufferStorage =
+        CreateBuffer(1024, wgpu::BufferUsage::Uniform | wgpu::BufferUsage::Storage);
+
+    std::vector<BindingDescriptor> bindingDescriptor = {
+        {{0, bufferStorage, 256, 16}, wgpu::BufferBindingType::Storage, true},
+        {{1, bufferStorage, 0, 8}, wgpu::BufferBindingType::Storage, true},
+    };
+
+    wgpu::BindGroupLayout layout = CreateBindGroupLayout(bindingDescriptor);
+    std::string computeShader = CreateComputeShaderWithBindings({bindingDescriptor});
+    wgpu::ComputePipeline computePipelineA = CreateComputePipeline({layout}, computeShader);
+    wgpu::ComputePipeline computePipelineB = CreateComputePipeline({layout}, computeShader);
+    std::vector<wgpu::BindGroup> bindGroups = CreateBindGroups({layout}, {bindingDescriptor});
+
+    const std::array<std::array<uint32_t, 2>, 2> kValidOffsets = {{{0, 0}, {256, 0}}};
+    const std::array<uint32_t, 2> kInvalidOffsets = {0, 256};
+
+    // Alternating between validated pipelines and dynamic offsets is valid.
+    {
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder computePassEncoder = commandEncoder.BeginComputePass();
+        for (uint32_t i = 0; i < 8; ++i) {
+            computePassEncoder.SetPipeline(i % 2 == 0 ? computePipelineA : computePipelineB);
+            const std::array<uint32_t, 2>& offsets = kValidOffsets[(i / 2) % 2];
+            computePassEncoder.SetBindGroup(0, bindGroups[0], offsets.size(), offsets.data());
+            computePassEncoder.DispatchWorkgroups(1);
+        }
+        computePassEncoder.End();
+        commandEncoder.Finish();
+    }
+
+    // An invalid state after validated ones is still an error.
+    {
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder computePassEncoder = commandEncoder.BeginComputePass();
+        for (uint32_t i = 0; i < 4; ++i) {
+            computePassEncoder.SetPipeline(i % 2 == 0 ? computePipelineA : computePipelineB);
+            const std::array<uint32_t, 2>& offsets = kValidOffsets[(i / 2) % 2];
+            computePassEncoder.SetBindGroup(0, bindGroups[0], offsets.size(), offsets.data());
+            computePassEncoder.DispatchWorkgroups(1);
+        }
+        computePassEncoder.SetPipeline(computePipelineA);
+        computePassEncoder.SetBindGroup(0, bindGroups[0], kInvalidOffsets.size(),
+                                        kInvalidOffsets.data());
+        computePassEncoder.DispatchWorkgroups(1);
+        computePassEncoder.End();
+        ASSERT_DEVICE_ERROR(commandEncoder.Finish());
+    }
+}
+
 }  // anonymous namespace
 }  // namespace dawn
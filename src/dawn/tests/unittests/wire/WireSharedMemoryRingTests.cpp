@@ -0,0 +1,325 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/dawn/wire/SharedMemoryRing.h"
+#include "src/utils/platform.h"
+
+#if DAWN_PLATFORM_IS(LINUX) || DAWN_PLATFORM_IS(MACOS)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace dawn::wire {
+namespace {
+
+// Records the commands it is given.
+class RecordingCommandHandler : public CommandHandler {
+  public:
+    bool HandleCommands(std::span<const volatile std::byte> commands) override {
+        commandsHandled.emplace_back(commands.begin(), commands.end());
+        return true;
+    }
+
+    std::vector<std::vector<std::byte>> commandsHandled;
+};
+
+// Returns the contents used for the command at `index`.
+std::vector<std::byte> MakeCommand(uint32_t index, size_t size) {
+    std::vector<std::byte> command(size);
+    for (size_t i = 0; i < size; i++) {
+        command[i] = std::byte((index + i) & 0xFF);
+    }
+    return command;
+}
+
+// Serializes `command` in the ring. Returns false if the ring is closed.
+bool Serialize(SharedMemoryRingSerializer* serializer, const std::vector<std::byte>& command) {
+    std::optional<std::span<volatile std::byte>> space =
+        serializer->GetCommandSpace(command.size());
+    if (!space) {
+        return false;
+    }
+    std::ranges::copy(command, space->begin());
+    return true;
+}
+
+constexpr size_t kCapacity = 1024;
+
+class SharedMemoryRingTests : public testing::Test {
+  protected:
+    void SetUp() override { SharedMemoryRing::Initialize(GetMemory()); }
+
+    Span<std::byte> GetMemory() {
+        return Span<std::byte>(mMemory).first(SharedMemoryRing::GetRequiredMemorySize(kCapacity));
+    }
+
+  private:
+    alignas(64) std::array<std::byte, sizeof(SharedMemoryRingHeader) + kCapacity> mMemory;
+};
+
+// Test that flushed commands are passed to the handler in order.
+TEST_F(SharedMemoryRingTests, SerializeAndHandle) {
+    SharedMemoryRingSerializer serializer(GetMemory());
+    RecordingCommandHandler handler;
+    SharedMemoryRingReader reader(GetMemory(), &handler);
+
+    std::vector<std::vector<std::byte>> commands = {MakeCommand(0, 4), MakeCommand(1, 13),
+                                                    MakeCommand(2, 64)};
+    for (const auto& command : commands) {
+        ASSERT_TRUE(Serialize(&serializer, command));
+    }
+
+    // Commands are only visible to the reader after a flush.
+    EXPECT_TRUE(reader.HandleCommands());
+    EXPECT_TRUE(handler.commandsHandled.empty());
+
+    EXPECT_TRUE(serializer.Flush());
+    EXPECT_TRUE(reader.HandleCommands());
+    EXPECT_EQ(handler.commandsHandled, commands);
+}
+
+// Test that commands are still passed correctly when the ring wraps around many times.
+TEST_F(SharedMemoryRingTests, WrapAround) {
+    SharedMemoryRingSerializer serializer(GetMemory());
+    RecordingCommandHandler handler;
+    SharedMemoryRingReader reader(GetMemory(), &handler);
+
+    std::vector<std::vector<std::byte>> commands;
+    for (uint32_t i = 0; i < 200; i++) {
+        commands.push_back(MakeCommand(i, 1 + (i * 37) % serializer.GetMaximumAllocationSize()));
+        ASSERT_TRUE(Serialize(&serializer, commands.back()));
+        ASSERT_TRUE(serializer.Flush());
+        ASSERT_TRUE(reader.HandleCommands());
+    }
+    EXPECT_EQ(handler.commandsHandled, commands);
+}
+
+// Test streaming commands between two threads, with the serializer waiting for the reader when
+// the ring is full.
+TEST_F(SharedMemoryRingTests, TwoThreads) {
+    constexpr uint32_t kCommandCount = 5000;
+
+    RecordingCommandHandler handler;
+    std::thread readerThread([&] {
+        SharedMemoryRingReader reader(GetMemory(), &handler);
+        while (handler.commandsHandled.size() < kCommandCount) {
+            ASSERT_TRUE(reader.WaitAndHandleCommands());
+        }
+    });
+
+    SharedMemoryRingSerializer serializer(GetMemory());
+    for (uint32_t i = 0; i < kCommandCount; i++) {
+        ASSERT_TRUE(Serialize(&serializer, MakeCommand(i, 1 + (i * 53) % 300)));
+        if (i % 7 == 0) {
+            ASSERT_TRUE(serializer.Flush());
+        }
+    }
+    ASSERT_TRUE(serializer.Flush());
+    readerThread.join();
+
+    ASSERT_EQ(handler.commandsHandled.size(), kCommandCount);
+    for (uint32_t i = 0; i < kCommandCount; i++) {
+        EXPECT_EQ(handler.commandsHandled[i], MakeCommand(i, 1 + (i * 53) % 300));
+    }
+}
+
+// Test that the reader rejects offsets and record sizes that could make it read outside of the ring
+// or never catch up with the write offset, since they are written by the untrusted end.
+TEST_F(SharedMemoryRingTests, InvalidOffsetsAndSizes) {
+    RecordingCommandHandler handler;
+    SharedMemoryRingReader reader(GetMemory(), &handler);
+    SharedMemoryRingHeader* header = reinterpret_cast<SharedMemoryRingHeader*>(GetMemory().data());
+    std::byte* records = GetMemory().data() + sizeof(SharedMemoryRingHeader);
+
+    auto SetRecordSize = [&](uint64_t size) { memcpy(records, &size, sizeof(uint64_t)); };
+    auto Reset = [&] {
+        header->readOffset.store(0);
+        header->writeOffset.store(0);
+    };
+
+    // A write offset that is too far ahead of the read offset.
+    Reset();
+    header->writeOffset.store(kCapacity + 8);
+    EXPECT_FALSE(reader.HandleCommands());
+
+    // A misaligned write offset.
+    Reset();
+    header->writeOffset.store(12);
+    EXPECT_FALSE(reader.HandleCommands());
+
+    // A write offset behind the read offset.
+    Reset();
+    header->readOffset.store(16);
+    header->writeOffset.store(8);
+    EXPECT_FALSE(reader.HandleCommands());
+
+    // A record size that goes past the end of the ring, or that overflows when added to the
+    // position of the record.
+    for (uint64_t size : {uint64_t(kCapacity), uint64_t(kCapacity - 7), ~uint64_t(0) - 8}) {
+        Reset();
+        header->writeOffset.store(kCapacity);
+        SetRecordSize(size);
+        EXPECT_FALSE(reader.HandleCommands());
+    }
+
+    // A record that extends past the write offset.
+    Reset();
+    header->writeOffset.store(16);
+    SetRecordSize(64);
+    EXPECT_FALSE(reader.HandleCommands());
+
+    EXPECT_TRUE(handler.commandsHandled.empty());
+}
+
+// Test that the handler is given a copy of each command, so that the other end of the wire cannot
+// change the command while it is handled.
+TEST_F(SharedMemoryRingTests, CommandsAreCopiedOutOfTheRing) {
+    class CheckingCommandHandler : public CommandHandler {
+      public:
+        explicit CheckingCommandHandler(Span<std::byte> memory) : mMemory(memory) {}
+
+        bool HandleCommands(std::span<const volatile std::byte> commands) override {
+            auto* begin = const_cast<const std::byte*>(commands.data());
+            const std::byte* memoryEnd = mMemory.data() + mMemory.size();
+            insideRing |= begin < memoryEnd && begin + commands.size() > mMemory.data();
+            commandsHandled++;
+            return true;
+        }
+
+        bool insideRing = false;
+        size_t commandsHandled = 0;
+
+      private:
+        Span<std::byte> mMemory;
+    };
+
+    SharedMemoryRingSerializer serializer(GetMemory());
+    CheckingCommandHandler handler(GetMemory());
+    SharedMemoryRingReader reader(GetMemory(), &handler);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        ASSERT_TRUE(Serialize(&serializer, MakeCommand(i, 32)));
+    }
+    ASSERT_TRUE(serializer.Flush());
+    ASSERT_TRUE(reader.HandleCommands());
+
+    EXPECT_EQ(handler.commandsHandled, 3u);
+    EXPECT_FALSE(handler.insideRing);
+}
+
+// Test that closing the ring wakes up a waiting reader and makes the serializer fail.
+TEST_F(SharedMemoryRingTests, Close) {
+    RecordingCommandHandler handler;
+    SharedMemoryRingReader reader(GetMemory(), &handler);
+
+    std::thread closingThread([&] { SharedMemoryRingSerializer(GetMemory()).Close(); });
+    EXPECT_FALSE(reader.WaitAndHandleCommands());
+    closingThread.join();
+
+    SharedMemoryRingSerializer serializer(GetMemory());
+    EXPECT_TRUE(serializer.IsClosed());
+    EXPECT_EQ(serializer.GetCommandSpace(4), std::nullopt);
+    EXPECT_FALSE(serializer.Flush());
+}
+
+#if DAWN_PLATFORM_IS(LINUX) || DAWN_PLATFORM_IS(MACOS)
+// Test streaming commands to a reader in another process, with each end waiting for the other to
+// wake it up: the reader waits for commands, and the serializer waits for space in the ring.
+TEST(SharedMemoryRingProcessTests, TwoProcesses) {
+    constexpr uint32_t kCommandCount = 2000;
+    auto MakeProcessCommand = [](uint32_t i) { return MakeCommand(i, 1 + (i * 53) % 300); };
+
+    size_t memorySize = SharedMemoryRing::GetRequiredMemorySize(kCapacity);
+    void* mapping =
+        mmap(nullptr, memorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(mapping, MAP_FAILED);
+    Span<std::byte> memory(static_cast<std::byte*>(mapping), memorySize);
+    SharedMemoryRing::Initialize(memory);
+
+    pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        // Kill the reader if a wakeup is lost, instead of hanging the test.
+        alarm(60);
+
+        RecordingCommandHandler handler;
+        SharedMemoryRingReader reader(memory, &handler);
+        while (reader.WaitAndHandleCommands()) {
+        }
+
+        bool success = handler.commandsHandled.size() == kCommandCount;
+        for (uint32_t i = 0; success && i < kCommandCount; i++) {
+            success = handler.commandsHandled[i] == MakeProcessCommand(i);
+        }
+        _exit(success ? 0 : 1);
+    }
+
+    SharedMemoryRingSerializer serializer(memory);
+    std::thread serializerThread([&] {
+        for (uint32_t i = 0; i < kCommandCount; i++) {
+            if (!Serialize(&serializer, MakeProcessCommand(i))) {
+                return;
+            }
+            if (i % 7 == 0) {
+                serializer.Flush();
+            }
+        }
+        serializer.Flush();
+
+        // Close the ring once the reader has handled all the commands, which wakes it up for the
+        // last time.
+        auto* header = reinterpret_cast<SharedMemoryRingHeader*>(memory.data());
+        while (header->readOffset.load() != header->writeOffset.load() && !serializer.IsClosed()) {
+            std::this_thread::yield();
+        }
+        serializer.Close();
+    });
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    // Unblock the serializer if the reader was killed.
+    serializer.Close();
+    serializerThread.join();
+
+    munmap(mapping, memorySize);
+}
+#endif  // DAWN_PLATFORM_IS(LINUX) || DAWN_PLATFORM_IS(MACOS)
+
+}  // anonymous namespace
+}  // namespace dawn::wire
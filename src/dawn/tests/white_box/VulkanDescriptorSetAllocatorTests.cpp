@@ -0,0 +1,139 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "partition_alloc/pointers/raw_ptr.h"
+#include "src/dawn/native/vulkan/DeviceVk.h"
+#include "src/dawn/tests/DawnTest.h"
+#include "src/dawn/utils/WGPUHelpers.h"
+
+namespace dawn::native::vulkan {
+namespace {
+
+class VulkanDescriptorSetAllocatorTests : public DawnTest {
+  protected:
+    void SetUp() override {
+        DawnTest::SetUp();
+        DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+        mDeviceVk = ToBackend(FromAPI(device.Get()));
+
+        wgpu::BufferDescriptor desc;
+        desc.size = 4;
+        desc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+        mBuffer = device.CreateBuffer(&desc);
+    }
+
+    // Makes a layout with a single uniform buffer at `binding`. Layouts with different bindings
+    // are different VkDescriptorSetLayouts but have the same descriptor counts.
+    wgpu::BindGroupLayout MakeLayout(uint32_t binding) {
+        return utils::MakeBindGroupLayout(
+            device, {{binding, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform}});
+    }
+
+    // Submits work and waits for it so that the completed serial moves forward.
+    void AdvanceSerial() {
+        uint32_t data = 0;
+        queue.WriteBuffer(mBuffer, 0, &data, sizeof(data));
+        WaitForAllOperations();
+    }
+
+    raw_ptr<Device> mDeviceVk;
+    wgpu::Buffer mBuffer;
+};
+
+// Test that layouts with the same descriptor counts share descriptor pools.
+TEST_P(VulkanDescriptorSetAllocatorTests, LayoutsWithSameCountsSharePools) {
+    size_t poolCountBefore = mDeviceVk->GetDescriptorPoolCountForTesting();
+
+    std::vector<wgpu::BindGroup> bindGroups;
+    for (uint32_t binding = 0; binding < 64; ++binding) {
+        wgpu::BindGroupLayout layout = MakeLayout(binding);
+        bindGroups.push_back(utils::MakeBindGroup(device, layout, {{binding, mBuffer}}));
+    }
+
+    // A pool holds sets for many layouts with a single descriptor.
+    EXPECT_LE(mDeviceVk->GetDescriptorPoolCountForTesting(), poolCountBefore + 1);
+}
+
+// Test that running out of sets in a pool falls back to a new pool and that pools are trimmed
+// once all their sets are freed.
+TEST_P(VulkanDescriptorSetAllocatorTests, PoolsGrowAndAreTrimmed) {
+    size_t poolCountBefore = mDeviceVk->GetDescriptorPoolCountForTesting();
+
+    {
+        // More sets than fit in a single pool.
+        std::vector<wgpu::BindGroup> bindGroups;
+        for (uint32_t binding = 0; binding < 4; ++binding) {
+            wgpu::BindGroupLayout layout = MakeLayout(binding);
+            for (uint32_t i = 0; i < 256; ++i) {
+                bindGroups.push_back(utils::MakeBindGroup(device, layout, {{binding, mBuffer}}));
+            }
+        }
+        EXPECT_GT(mDeviceVk->GetDescriptorPoolCountForTesting(), poolCountBefore + 1);
+    }
+
+    // Releasing the layouts returns their sets to the pools, which are destroyed after staying
+    // empty for a few serials.
+    for (uint32_t i = 0; i < 16; ++i) {
+        AdvanceSerial();
+    }
+    EXPECT_LE(mDeviceVk->GetDescriptorPoolCountForTesting(), poolCountBefore);
+}
+
+// Test that sets recycled by a layout can be returned to the shared pools and reused.
+TEST_P(VulkanDescriptorSetAllocatorTests, ReduceMemoryUsageReleasesRecycledSets) {
+    wgpu::BindGroupLayout layout = MakeLayout(0);
+    {
+        std::vector<wgpu::BindGroup> bindGroups;
+        for (uint32_t i = 0; i < 16; ++i) {
+            bindGroups.push_back(utils::MakeBindGroup(device, layout, {{0, mBuffer}}));
+        }
+    }
+    AdvanceSerial();
+
+    // The sets recycled by the layout keep their pool alive.
+    size_t poolCountWithRecycledSets = mDeviceVk->GetDescriptorPoolCountForTesting();
+    EXPECT_GT(poolCountWithRecycledSets, 0u);
+
+    // Reducing memory usage returns the recycled sets to the pool, which is then trimmed.
+    native::ReduceMemoryUsage(device.Get());
+    for (uint32_t i = 0; i < 16; ++i) {
+        AdvanceSerial();
+    }
+    EXPECT_LT(mDeviceVk->GetDescriptorPoolCountForTesting(), poolCountWithRecycledSets);
+
+    // The layout can still allocate sets after its recycled sets were released.
+    wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, layout, {{0, mBuffer}});
+    EXPECT_NE(bindGroup, nullptr);
+}
+
+DAWN_INSTANTIATE_TEST(VulkanDescriptorSetAllocatorTests, VulkanBackend());
+
+}  // anonymous namespace
+}  // namespace dawn::native::vulkan
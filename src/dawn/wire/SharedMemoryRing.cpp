@@ -0,0 +1,278 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/dawn/wire/SharedMemoryRing.h"
+
+#include <cstring>
+#include <new>
+#include <random>
+
+#include "src/dawn/common/Math.h"
+#include "src/utils/assert.h"
+#include "src/utils/compiler.h"
+
+#if DAWN_PLATFORM_IS(LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+#elif DAWN_PLATFORM_IS(WINDOWS)
+#include <string>
+
+#include "src/utils/windows_with_undefs.h"
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+namespace dawn::wire {
+
+// SharedMemoryRing
+
+// static
+size_t SharedMemoryRing::GetRequiredMemorySize(size_t capacity) {
+    return sizeof(SharedMemoryRingHeader) + Align(capacity, kRecordAlignment);
+}
+
+// static
+void SharedMemoryRing::Initialize(Span<std::byte> memory) {
+    DAWN_ASSERT(memory.size() > sizeof(SharedMemoryRingHeader));
+    DAWN_ASSERT(IsPtrAligned(memory.data(), alignof(SharedMemoryRingHeader)));
+    auto* header = new (memory.data()) SharedMemoryRingHeader{};
+
+    std::random_device random;
+    header->id = (uint64_t(random()) << 32) | random();
+}
+
+SharedMemoryRing::SharedMemoryRing(Span<std::byte> memory)
+    : mHeader(reinterpret_cast<SharedMemoryRingHeader*>(memory.data())) {
+    DAWN_ASSERT(memory.size() > sizeof(SharedMemoryRingHeader));
+    DAWN_ASSERT(IsPtrAligned(memory.data(), alignof(SharedMemoryRingHeader)));
+
+    size_t capacity = memory.size() - sizeof(SharedMemoryRingHeader);
+    capacity -= capacity % kRecordAlignment;
+    mRecords = memory.subspan(sizeof(SharedMemoryRingHeader), capacity);
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+    // WaitOnAddress only works within a process, so each signal has a named event that both ends
+    // open, and that is set whenever the signal is incremented.
+    std::string name = "Local\\DawnWireSharedMemoryRing_" + std::to_string(mHeader->id);
+    mWriteEvent = SystemHandle::Acquire(CreateEventA(nullptr, FALSE, FALSE, (name + "_w").c_str()));
+    mReadEvent = SystemHandle::Acquire(CreateEventA(nullptr, FALSE, FALSE, (name + "_r").c_str()));
+    DAWN_CHECK(mWriteEvent.IsValid() && mReadEvent.IsValid());
+#endif  // DAWN_PLATFORM_IS(WINDOWS)
+}
+
+SharedMemoryRing::~SharedMemoryRing() = default;
+
+std::atomic<uint32_t>& SharedMemoryRing::GetSignal(Signal signal) {
+    return signal == Signal::Write ? mHeader->writeSignal : mHeader->readSignal;
+}
+
+void SharedMemoryRing::Notify(Signal signal) {
+    std::atomic<uint32_t>& value = GetSignal(signal);
+    value.fetch_add(1, std::memory_order_release);
+
+#if DAWN_PLATFORM_IS(LINUX)
+    // Not FUTEX_WAKE_PRIVATE, as the waiter can be in another process.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&value), FUTEX_WAKE, INT_MAX, nullptr, nullptr,
+            0);
+#elif DAWN_PLATFORM_IS(WINDOWS)
+    SetEvent(signal == Signal::Write ? mWriteEvent.Get() : mReadEvent.Get());
+#endif
+}
+
+void SharedMemoryRing::Wait(Signal signal, uint32_t value) {
+    std::atomic<uint32_t>& current = GetSignal(signal);
+    static_assert(sizeof(current) == sizeof(uint32_t));
+
+#if DAWN_PLATFORM_IS(LINUX)
+    // Not FUTEX_WAIT_PRIVATE, as the waker can be in another process. The kernel only sleeps if
+    // the signal still holds `value`, so a Notify() racing with this call is not lost.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&current), FUTEX_WAIT, value, nullptr, nullptr,
+            0);
+#elif DAWN_PLATFORM_IS(WINDOWS)
+    // The event is auto-reset and stays set if Notify() happens before the wait starts, so the
+    // wakeup is not lost.
+    if (current.load(std::memory_order_acquire) == value) {
+        WaitForSingleObject(signal == Signal::Write ? mWriteEvent.Get() : mReadEvent.Get(),
+                            INFINITE);
+    }
+#else
+    // There is no primitive to wait on shared memory across processes here, so poll.
+    if (current.load(std::memory_order_acquire) == value) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+#endif
+}
+
+void SharedMemoryRing::Close() {
+    mHeader->closed.store(1, std::memory_order_release);
+    Notify(Signal::Write);
+    Notify(Signal::Read);
+}
+
+bool SharedMemoryRing::IsClosed() const {
+    return mHeader->closed.load(std::memory_order_acquire) != 0;
+}
+
+// SharedMemoryRingSerializer
+
+SharedMemoryRingSerializer::SharedMemoryRingSerializer(Span<std::byte> memory)
+    : SharedMemoryRing(memory),
+      mReservedOffset(mHeader->writeOffset.load(std::memory_order_relaxed)) {}
+
+size_t SharedMemoryRingSerializer::GetMaximumAllocationSize() const {
+    // Skipping to the start of the ring wastes less than a record, so a record of at most half the
+    // ring always fits in an empty ring.
+    return mRecords.size() / 2 - sizeof(uint64_t);
+}
+
+std::optional<std::span<volatile std::byte>> SharedMemoryRingSerializer::GetCommandSpace(
+    size_t size) {
+    DAWN_ASSERT(size <= GetMaximumAllocationSize());
+
+    const uint64_t capacity = mRecords.size();
+    const uint64_t recordSize = sizeof(uint64_t) + Align(uint64_t(size), kRecordAlignment);
+
+    while (true) {
+        if (IsClosed()) {
+            return std::nullopt;
+        }
+
+        // Records are contiguous, so skip to the start of the ring if the record doesn't fit before
+        // its end.
+        uint64_t position = mReservedOffset % capacity;
+        uint64_t skipSize = position + recordSize > capacity ? capacity - position : 0;
+
+        uint32_t signal = mHeader->readSignal.load(std::memory_order_acquire);
+        uint64_t used = mReservedOffset - mHeader->readOffset.load(std::memory_order_acquire);
+        if (used + skipSize + recordSize <= capacity) {
+            if (skipSize != 0) {
+                memcpy(&mRecords[position], &kWrapMarker, sizeof(uint64_t));
+                mReservedOffset += skipSize;
+                position = 0;
+            }
+
+            uint64_t recordPayloadSize = size;
+            memcpy(&mRecords[position], &recordPayloadSize, sizeof(uint64_t));
+            mReservedOffset += recordSize;
+            return mRecords.subspan(position + sizeof(uint64_t), size);
+        }
+
+        // The ring is full. Make sure the reader can see all the commands so that it can free
+        // space, then wait for it to do so.
+        Flush();
+        Wait(Signal::Read, signal);
+    }
+}
+
+bool SharedMemoryRingSerializer::Flush() {
+    if (mHeader->writeOffset.load(std::memory_order_relaxed) != mReservedOffset) {
+        mHeader->writeOffset.store(mReservedOffset, std::memory_order_release);
+        Notify(Signal::Write);
+    }
+    return !IsClosed();
+}
+
+// SharedMemoryRingReader
+
+SharedMemoryRingReader::SharedMemoryRingReader(Span<std::byte> memory, CommandHandler* handler)
+    : SharedMemoryRing(memory), mHandler(handler) {}
+
+bool SharedMemoryRingReader::HandleCommands() {
+    const uint64_t capacity = mRecords.size();
+    uint64_t readOffset = mHeader->readOffset.load(std::memory_order_relaxed);
+    const uint64_t writeOffset = mHeader->writeOffset.load(std::memory_order_acquire);
+
+    // The offsets and the record sizes are in memory that the other end of the wire can write at
+    // any time, so they are untrusted and must be validated before they are used. Aligned offsets
+    // guarantee that each record's size is entirely inside the ring.
+    if (readOffset % kRecordAlignment != 0 || writeOffset % kRecordAlignment != 0 ||
+        writeOffset - readOffset > capacity) {
+        return false;
+    }
+
+    bool success = true;
+    while (readOffset != writeOffset) {
+        uint64_t position = readOffset % capacity;
+        uint64_t size;
+        memcpy(&size, &mRecords[position], sizeof(uint64_t));
+
+        uint64_t recordSize;
+        if (size == kWrapMarker) {
+            recordSize = capacity - position;
+        } else if (size <= capacity - position - sizeof(uint64_t)) {
+            recordSize = sizeof(uint64_t) + Align(size, kRecordAlignment);
+        } else {
+            success = false;
+            break;
+        }
+        // A record must not extend past the flushed commands, otherwise the read offset could skip
+        // over the write offset.
+        if (recordSize > writeOffset - readOffset) {
+            success = false;
+            break;
+        }
+
+        if (size != kWrapMarker) {
+            // Copy the command out of the ring so that the other end cannot change it while it is
+            // deserialized, for example between the validation of a field and its use.
+            mCommandCopy.resize(size);
+            memcpy(mCommandCopy.data(), &mRecords[position + sizeof(uint64_t)], size);
+            success = mHandler->HandleCommands(mCommandCopy);
+        }
+        readOffset += recordSize;
+
+        // Free the space of each record as soon as it is handled so that the serializer can reuse
+        // it while the next ones are handled.
+        mHeader->readOffset.store(readOffset, std::memory_order_release);
+        if (!success) {
+            break;
+        }
+    }
+
+    Notify(Signal::Read);
+    return success;
+}
+
+bool SharedMemoryRingReader::WaitAndHandleCommands() {
+    while (true) {
+        uint32_t signal = mHeader->writeSignal.load(std::memory_order_acquire);
+        if (IsClosed()) {
+            return false;
+        }
+        if (mHeader->writeOffset.load(std::memory_order_acquire) !=
+            mHeader->readOffset.load(std::memory_order_relaxed)) {
+            return HandleCommands();
+        }
+        Wait(Signal::Write, signal);
+    }
+}
+
+}  // namespace dawn::wire
@@ -0,0 +1,165 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_SHAREDMEMORYRING_H_
+#define SRC_DAWN_WIRE_SHAREDMEMORYRING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "dawn/wire/Wire.h"
+#include "dawn/wire/dawn_wire_export.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+#include "src/utils/platform.h"
+#include "src/utils/span.h"
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+#include "src/dawn/common/SystemHandle.h"
+#endif  // DAWN_PLATFORM_IS(WINDOWS)
+
+namespace dawn::wire {
+
+// A single-producer single-consumer ring of commands living in a block of memory that can be
+// shared between the two ends of the wire, for example a SharedMemory's mapped span. The producer
+// serializes commands directly into the ring with a SharedMemoryRingSerializer, and the consumer
+// passes them to a CommandHandler with a SharedMemoryRingReader. The serializer never copies
+// commands, including their bulk data like the contents of WriteBuffer, into intermediate buffers,
+// and does not split them into chunks unless they are larger than half of the ring. The reader
+// copies each command once into memory it owns before handling it, because the serializer's end
+// may be untrusted and could change the command while it is deserialized.
+//
+// The two ends can be in different processes: waiting and waking up use primitives that work
+// across processes.
+//
+// The memory starts with a SharedMemoryRingHeader holding the offsets of both ends, followed by
+// the ring of records. Each record is a uint64_t size followed by the command, padded to 8 bytes.
+struct SharedMemoryRingHeader {
+    // A random identifier of the ring, used to name the objects that the ends wait on on platforms
+    // where the signals cannot be waited on directly.
+    uint64_t id;
+
+    // The offsets are monotonic byte counts, and are taken modulo the capacity of the ring. Each
+    // one is only written by one end, and they are on separate cache lines to avoid false sharing.
+    // The signals are incremented when the offset next to them changes, or when the ring is closed,
+    // and are what the other end waits on.
+    alignas(64) std::atomic<uint64_t> writeOffset;
+    std::atomic<uint32_t> writeSignal;
+    alignas(64) std::atomic<uint64_t> readOffset;
+    std::atomic<uint32_t> readSignal;
+    alignas(64) std::atomic<uint32_t> closed;
+};
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+              "The ring's atomics must be lock-free to be shared between processes.");
+
+class DAWN_WIRE_EXPORT SharedMemoryRing {
+  public:
+    // The size of the memory needed for a ring that can hold `capacity` bytes of records.
+    static size_t GetRequiredMemorySize(size_t capacity);
+
+    // Initializes the header of the ring in `memory`. Must be done once, by only one of the ends,
+    // before either end uses the memory.
+    static void Initialize(Span<std::byte> memory);
+
+    // Marks the ring as closed, waking up both ends if they are waiting.
+    void Close();
+    bool IsClosed() const;
+
+  protected:
+    explicit SharedMemoryRing(Span<std::byte> memory);
+    ~SharedMemoryRing();
+
+    enum class Signal {
+        Write,
+        Read,
+    };
+
+    // Increments `signal` and wakes up the other end if it is waiting on it.
+    void Notify(Signal signal);
+    // Waits until `signal` is no longer `value`. May return early, so callers must check the state
+    // of the ring again.
+    void Wait(Signal signal, uint32_t value);
+
+    static constexpr uint64_t kRecordAlignment = 8;
+    // A record size that tells the reader to continue reading at the start of the ring.
+    static constexpr uint64_t kWrapMarker = ~uint64_t(0);
+
+    raw_ptr<SharedMemoryRingHeader> mHeader;
+    Span<std::byte> mRecords;
+
+  private:
+    std::atomic<uint32_t>& GetSignal(Signal signal);
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+    // Named auto-reset events shared by both ends, set when the matching signal is incremented.
+    SystemHandle mWriteEvent;
+    SystemHandle mReadEvent;
+#endif  // DAWN_PLATFORM_IS(WINDOWS)
+};
+
+class DAWN_WIRE_EXPORT SharedMemoryRingSerializer final : public CommandSerializer,
+                                                          public SharedMemoryRing {
+  public:
+    explicit SharedMemoryRingSerializer(Span<std::byte> memory);
+
+    // Waits for the reader to free enough space when the ring is full. Returns std::nullopt if the
+    // ring is closed.
+    std::optional<std::span<volatile std::byte>> GetCommandSpace(size_t size) override;
+    // Makes the commands serialized since the last flush visible to the reader.
+    bool Flush() override;
+    size_t GetMaximumAllocationSize() const override;
+
+  private:
+    // The write offset including the commands that are not flushed yet.
+    uint64_t mReservedOffset = 0;
+};
+
+class DAWN_WIRE_EXPORT SharedMemoryRingReader final : public SharedMemoryRing {
+  public:
+    SharedMemoryRingReader(Span<std::byte> memory, CommandHandler* handler);
+
+    // Passes all the flushed commands to the handler, and frees their space in the ring. Returns
+    // false if the handler failed.
+    bool HandleCommands();
+
+    // Waits until commands are flushed or the ring is closed, then handles the commands. Returns
+    // false if the handler failed or the ring is closed.
+    bool WaitAndHandleCommands();
+
+  private:
+    raw_ptr<CommandHandler> mHandler;
+    // The copy of the command being handled, reused for all commands.
+    std::vector<std::byte> mCommandCopy;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_SHAREDMEMORYRING_H_
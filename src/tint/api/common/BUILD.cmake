@@ -42,6 +42,7 @@ tint_add_target(tint_api_common lib
   api/common/binding_point.h
   api/common/bindings.h
   api/common/override_id.h
+  api/common/pass_timing.h
   api/common/resource_table_config.h
   api/common/resource_type.h
   api/common/subgroup_matrix.h
@@ -0,0 +1,69 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_API_COMMON_PASS_TIMING_H_
+#define SRC_TINT_API_COMMON_PASS_TIMING_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tint {
+
+/// Statistics recorded for a single IR transform when pass timing is enabled. This is part of the
+/// output of shader generation.
+struct PassTiming {
+    /// The name of the transform, for example "core.BinaryPolyfill"
+    std::string name;
+
+    /// The wall time spent in the transform, excluding IR validation
+    std::chrono::nanoseconds duration{};
+
+    /// The wall time spent validating the IR on behalf of the transform
+    std::chrono::nanoseconds validation_duration{};
+
+    /// The number of instructions allocated by the transform
+    size_t instructions_allocated = 0;
+
+    /// The number of values allocated by the transform
+    size_t values_allocated = 0;
+
+    /// The change in the number of live instructions in the module
+    int64_t instruction_delta = 0;
+
+    /// The change in the number of live values in the module
+    int64_t value_delta = 0;
+};
+
+/// The list of pass timings, in the order the transforms ran.
+using PassTimings = std::vector<PassTiming>;
+
+}  // namespace tint
+
+#endif  // SRC_TINT_API_COMMON_PASS_TIMING_H_
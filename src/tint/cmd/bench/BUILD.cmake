@@ -36,6 +36,7 @@
 
 include(cmd/bench/glsl/BUILD.cmake)
 include(cmd/bench/hlsl/BUILD.cmake)
+include(cmd/bench/ir/BUILD.cmake)
 include(cmd/bench/msl/BUILD.cmake)
 include(cmd/bench/spirv/BUILD.cmake)
 include(cmd/bench/wgsl/BUILD.cmake)
@@ -91,6 +92,12 @@ if(TINT_BUILD_HLSL_WRITER)
   )
 endif(TINT_BUILD_HLSL_WRITER)
 
+if(TINT_BUILD_IR_BINARY)
+  tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
+    tint_cmd_bench_ir_bench
+  )
+endif(TINT_BUILD_IR_BINARY)
+
 if(TINT_BUILD_MSL_WRITER)
   tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
     tint_cmd_bench_msl_bench
@@ -123,6 +130,7 @@ tint_add_target(tint_cmd_bench_bench bench
   cmd/bench/bench.h
   cmd/bench/enums_core_bench.cc
   cmd/bench/enums_wgsl_bench.cc
+  cmd/bench/hashmap_bench.cc
   cmd/bench/validator_bench.cc
 )
 
@@ -0,0 +1,165 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/containers/hashset.h"
+
+namespace tint {
+namespace {
+
+/// Keys holds the keys gathered from a benchmark input program.
+struct Keys {
+    /// The pointers to all the AST nodes of the program.
+    std::vector<const ast::Node*> nodes;
+    /// The names of all the symbols of the program.
+    std::vector<std::string_view> names;
+};
+
+Keys GatherKeys(const Program& program) {
+    Keys keys;
+    for (auto* node : program.ASTNodes().Objects()) {
+        keys.nodes.push_back(node);
+    }
+    program.Symbols().Foreach([&](Symbol sym) { keys.names.push_back(sym.NameView()); });
+    return keys;
+}
+
+void HashmapAddPointers(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    TINT_ASSERT(res == Success) << res.Failure().reason;
+    auto keys = GatherKeys(res->program);
+
+    for (auto _ : state) {
+        Hashmap<const ast::Node*, size_t, 8> map;
+        for (size_t i = 0; i < keys.nodes.size(); i++) {
+            map.Add(keys.nodes[i], i);
+        }
+        benchmark::DoNotOptimize(map.Count());
+    }
+}
+
+void UnorderedMapAddPointers(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    TINT_ASSERT(res == Success) << res.Failure().reason;
+    auto keys = GatherKeys(res->program);
+
+    for (auto _ : state) {
+        std::unordered_map<const ast::Node*, size_t> map;
+        for (size_t i = 0; i < keys.nodes.size(); i++) {
+            map.emplace(keys.nodes[i], i);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+}
+
+void HashmapGetPointers(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    TINT_ASSERT(res == Success) << res.Failure().reason;
+    auto keys = GatherKeys(res->program);
+
+    Hashmap<const ast::Node*, size_t, 8> map;
+    for (size_t i = 0; i < keys.nodes.size(); i++) {
+        map.Add(keys.nodes[i], i);
+    }
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (auto* node : keys.nodes) {
+            sum += *map.Get(node);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void UnorderedMapGetPointers(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    TINT_ASSERT(res == Success) << res.Failure().reason;
+    auto keys = GatherKeys(res->program);
+
+    std::unordered_map<const ast::Node*, size_t> map;
+    for (size_t i = 0; i < keys.nodes.size(); i++) {
+        map.emplace(keys.nodes[i], i);
+    }
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (auto* node : keys.nodes) {
+            sum += map.find(node)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void HashsetNames(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    TINT_ASSERT(res == Success) << res.Failure().reason;
+    auto keys = GatherKeys(res->program);
+
+    for (auto _ : state) {
+        Hashset<std::string_view, 8> set;
+        for (auto name : keys.names) {
+            set.Add(name);
+        }
+        size_t found = 0;
+        for (auto name : keys.names) {
+            found += set.Contains(name) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+void UnorderedMapNames(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    TINT_ASSERT(res == Success) << res.Failure().reason;
+    auto keys = GatherKeys(res->program);
+
+    for (auto _ : state) {
+        std::unordered_map<std::string_view, bool> set;
+        for (auto name : keys.names) {
+            set.emplace(name, true);
+        }
+        size_t found = 0;
+        for (auto name : keys.names) {
+            found += set.count(name);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(HashmapAddPointers);
+TINT_BENCHMARK_PROGRAMS(UnorderedMapAddPointers);
+TINT_BENCHMARK_PROGRAMS(HashmapGetPointers);
+TINT_BENCHMARK_PROGRAMS(UnorderedMapGetPointers);
+TINT_BENCHMARK_PROGRAMS(HashsetNames);
+TINT_BENCHMARK_PROGRAMS(UnorderedMapNames);
+
+}  // namespace
+}  // namespace tint
@@ -0,0 +1,86 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdint>
+#include <string>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/core/ir/binary/decode.h"
+#include "src/tint/lang/core/ir/binary/encode.h"
+#include "src/tint/lang/wgsl/reader/reader.h"
+
+#if TINT_BUILD_IS_MSVC
+#if _MSC_VER > 1930 && _MSC_VER < 1939
+#define BUGGY_COMPILER  // MSVC can ICE
+#endif
+#endif
+
+#ifndef BUGGY_COMPILER
+
+namespace tint::core::ir::binary {
+namespace {
+
+/// @returns the lowered IR of the benchmark program @p input_name, encoded with @p encode
+template <typename ENCODE>
+Vector<std::byte, 0> EncodeProgram(const std::string& input_name, ENCODE&& encode) {
+    auto res = bench::GetWgslProgram(input_name);
+    TINT_ASSERT(res == Success) << res.Failure().reason;
+
+    // Convert the AST program to an IR module.
+    auto ir = tint::wgsl::reader::ProgramToLoweredIR(res->program);
+    TINT_ASSERT(ir == Success) << ir.Failure().reason;
+
+    auto encoded = encode(ir.Get());
+    TINT_ASSERT(encoded == Success) << encoded.Failure().reason;
+    return encoded.Move();
+}
+
+void DecodeProtoIR(benchmark::State& state, std::string input_name) {
+    auto encoded = EncodeProgram(input_name, EncodeToBinary);
+    for (auto _ : state) {
+        auto decoded = Decode(encoded.AsSpan());
+        TINT_ASSERT(decoded == Success) << decoded.Failure().reason;
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * encoded.Length()));
+}
+
+void DecodeFlatIR(benchmark::State& state, std::string input_name) {
+    auto encoded = EncodeProgram(input_name, EncodeToFlatBinary);
+    for (auto _ : state) {
+        auto decoded = DecodeFlatBinary(encoded.AsSpan());
+        TINT_ASSERT(decoded == Success) << decoded.Failure().reason;
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * encoded.Length()));
+}
+
+TINT_BENCHMARK_PROGRAMS(DecodeProtoIR);
+TINT_BENCHMARK_PROGRAMS(DecodeFlatIR);
+
+}  // namespace
+}  // namespace tint::core::ir::binary
+
+#endif
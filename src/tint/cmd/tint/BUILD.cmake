@@ -72,6 +72,7 @@ tint_target_add_dependencies(tint_cmd_tint_cmd cmd
   tint_utils_rtti
   tint_utils_strconv
   tint_utils_symbol
+  tint_utils_system
   tint_utils_text
 )
 
@@ -26,10 +26,19 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <charconv>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -42,6 +51,7 @@
 #include "src/tint/api/tint.h"
 #include "src/tint/cmd/common/helper.h"
 #include "src/tint/lang/core/ir/disassembler.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/referenced_module_vars.h"
 #include "src/tint/lang/core/ir/transform/resource_table_helper.h"
 #include "src/tint/lang/core/ir/var.h"
@@ -54,6 +64,8 @@
 #include "src/tint/utils/diagnostic/diagnostic.h"
 #include "src/tint/utils/diagnostic/formatter.h"
 #include "src/tint/utils/macros/defer.h"
+#include "src/tint/utils/math/crc32.h"
+#include "src/tint/utils/system/executable_path.h"
 #include "src/tint/utils/text/color_mode.h"
 #include "src/tint/utils/text/string.h"
 #include "src/tint/utils/text/styled_text.h"
@@ -149,9 +161,12 @@ struct Options {
 
     bool rename_all = false;
     bool enable_robustness = true;
+    bool enable_cse = false;
+    bool enable_licm = false;
 
     bool dump_ir = false;
     bool enable_ir_validation_asserts = true;
+    bool time_passes = false;
     bool ir_roundtrip = false;
 
     bool treat_samplers_as_filtering = false;
@@ -345,6 +360,14 @@ If not provided, will be inferred from input filename extension:
         opts->enable_robustness = !disable;
     });
 
+    auto& enable_cse = options.Add<BoolOption>(
+        "cse", "Run common subexpression elimination in the backend", Default{false});
+    TINT_DEFER(opts->enable_cse = *enable_cse.value);
+
+    auto& enable_licm = options.Add<BoolOption>(
+        "licm", "Run loop-invariant code motion in the backend", Default{false});
+    TINT_DEFER(opts->enable_licm = *enable_licm.value);
+
     auto& rename_all = options.Add<BoolOption>("rename-all", "Renames all symbols", Default{false});
     TINT_DEFER(opts->rename_all = *rename_all.value);
 
@@ -565,6 +588,12 @@ When specified, automatically enables HLSL validation)",
                    !*disable_validation_asserts.value);
 #endif
 
+    auto& time_passes = options.Add<BoolOption>(
+        "time-passes",
+        "Print the time, IR validation time and IR size change of each transform to stderr",
+        Default{false});
+    TINT_DEFER(opts->time_passes = *time_passes.value);
+
     auto& ir_roundtrip = options.Add<BoolOption>(
         "ir-roundtrip", "Converts the Program to IR and then back to a Program", Default{false});
     TINT_DEFER(opts->ir_roundtrip = *ir_roundtrip.value);
@@ -961,6 +990,8 @@ std::string Disassemble(const std::vector<uint32_t>& data) {
     }
     gen_options.entry_point_name = options.ep_name;
     gen_options.disable_robustness = !options.enable_robustness;
+    gen_options.enable_common_subexpression_elimination = options.enable_cse;
+    gen_options.enable_loop_invariant_code_motion = options.enable_licm;
     gen_options.disable_workgroup_init = options.disable_workgroup_init;
     gen_options.extensions.use_storage_input_output_16 = options.use_storage_input_output_16;
     gen_options.spirv_version = options.spirv_version;
@@ -1174,6 +1205,8 @@ tint::msl::writer::ArrayLengthOptions GenerateArrayLengthFromConstants(tint::cor
     }
     gen_options.entry_point_name = options.ep_name;
     gen_options.disable_robustness = !options.enable_robustness;
+    gen_options.enable_common_subexpression_elimination = options.enable_cse;
+    gen_options.enable_loop_invariant_code_motion = options.enable_licm;
     gen_options.disable_workgroup_init = options.disable_workgroup_init;
     gen_options.pixel_local_attachments = options.pixel_local_attachments;
     gen_options.bindings = tint::GenerateBindings(
@@ -1264,6 +1297,8 @@ tint::msl::writer::ArrayLengthOptions GenerateArrayLengthFromConstants(tint::cor
     }
     gen_options.entry_point_name = options.ep_name;
     gen_options.disable_robustness = !options.enable_robustness;
+    gen_options.enable_common_subexpression_elimination = options.enable_cse;
+    gen_options.enable_loop_invariant_code_motion = options.enable_licm;
     gen_options.disable_workgroup_init = options.disable_workgroup_init;
     gen_options.pixel_local = options.pixel_local_options;
     gen_options.extensions.polyfill_dot_4x8_packed =
@@ -1396,6 +1431,8 @@ tint::msl::writer::ArrayLengthOptions GenerateArrayLengthFromConstants(tint::cor
 
     gen_options.entry_point_name = options.ep_name;
     gen_options.disable_robustness = !options.enable_robustness;
+    gen_options.enable_common_subexpression_elimination = options.enable_cse;
+    gen_options.enable_loop_invariant_code_motion = options.enable_licm;
 
     // Run SubstituteOverrides to replace override instructions with constants.
     // This needs to run after SingleEntryPoint which removes unused overrides.
@@ -1506,6 +1543,40 @@ bool DumpIR([[maybe_unused]] const tint::Program& program,
 #endif
 }
 
+/// Prints the per-transform statistics in @p timings to stderr.
+/// @param timings the pass timings to print
+void PrintPassTimings(const tint::PassTimings& timings) {
+    auto to_ms = [](std::chrono::nanoseconds duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+
+    std::chrono::nanoseconds total{};
+    std::chrono::nanoseconds total_validation{};
+    for (auto& timing : timings) {
+        total += timing.duration;
+        total_validation += timing.validation_duration;
+    }
+
+    std::cerr << std::fixed << std::setprecision(3);
+    std::cerr << std::setw(10) << "time (ms)" << std::setw(8) << "%" << std::setw(14)
+              << "validate (ms)" << std::setw(12) << "insts new" << std::setw(12) << "values new"
+              << std::setw(12) << "insts +/-" << std::setw(12) << "values +/-"
+              << "  transform\n";
+    for (auto& timing : timings) {
+        double percent = total.count() > 0 ? 100.0 * static_cast<double>(timing.duration.count()) /
+                                                 static_cast<double>(total.count())
+                                           : 0.0;
+        std::cerr << std::setw(10) << to_ms(timing.duration) << std::setw(8)
+                  << std::setprecision(1) << percent << std::setprecision(3) << std::setw(14)
+                  << to_ms(timing.validation_duration) << std::setw(12)
+                  << timing.instructions_allocated << std::setw(12) << timing.values_allocated
+                  << std::setw(12) << timing.instruction_delta << std::setw(12)
+                  << timing.value_delta << "  " << timing.name << "\n";
+    }
+    std::cerr << std::setw(10) << to_ms(total) << std::setw(8) << "" << std::setw(14)
+              << to_ms(total_validation) << std::setw(48) << "" << "  total\n";
+}
+
 /// Generate backend code for a program.
 /// @param options the options that Tint was invoked with
 /// @param inspector the inspector
@@ -1526,6 +1597,19 @@ bool Generate([[maybe_unused]] const Options& options,
         return false;
     }
 
+    // Time each transform, printing the results once the backend has finished.
+    tint::core::ir::PassTimer pass_timer;
+    if (options.time_passes) {
+        ir.Get().pass_timer = &pass_timer;
+    }
+    TINT_DEFER({
+        if (options.time_passes) {
+            pass_timer.End(ir.Get());
+            ir.Get().pass_timer = nullptr;
+            PrintPassTimings(pass_timer.Timings());
+        }
+    });
+
     switch (options.format) {
         case Format::kHlsl:
         case Format::kHlslFxc:
@@ -1694,6 +1778,22 @@ int Run(tint::VectorRef<std::string_view> arguments, ExeMode exe_mode) {
     return success ? 0 : 1;
 }
 
+/// Splits a line of arguments by whitespace, taking double-quotes into account.
+/// @param arg_line the line of arguments
+/// @returns the list of arguments
+tint::Vector<std::string, 8> SplitArguments(const std::string& arg_line) {
+    std::istringstream arg_in(arg_line);
+    tint::Vector<std::string, 8> arg_tokens;
+    while (!arg_in.eof()) {
+        std::string arg;
+        arg_in >> std::quoted(arg, '"', '\0');
+        if (!arg.empty()) {
+            arg_tokens.Push(arg);
+        }
+    }
+    return arg_tokens;
+}
+
 /// Run a server that accepts arguments on stdin.
 /// @returns 0 on success, non-zero on failure
 int RunServer() {
@@ -1705,16 +1805,7 @@ int RunServer() {
         std::string arg_line;
         std::getline(std::cin, arg_line);
 
-        // Split the arguments by whitespace, taking double-quotes into account.
-        std::istringstream arg_in(arg_line);
-        tint::Vector<std::string, 8> arg_tokens;
-        while (!arg_in.eof()) {
-            std::string arg;
-            arg_in >> std::quoted(arg, '"', '\0');
-            if (!arg.empty()) {
-                arg_tokens.Push(arg);
-            }
-        }
+        auto arg_tokens = SplitArguments(arg_line);
 
         // Run Tint with the provided arguments.
         auto arguments =
@@ -1734,6 +1825,221 @@ int RunServer() {
     return 0;
 }
 
+/// The configuration of a RunBatch() invocation.
+struct BatchOptions {
+    /// The number of jobs to run concurrently
+    size_t num_jobs = std::max(1u, std::thread::hardware_concurrency());
+    /// The maximum number of bytes held by the result cache
+    size_t cache_size = 256u * 1024 * 1024;
+};
+
+/// Parses the arguments of a `--batch` invocation.
+/// @param arguments the command line arguments, starting with `--batch`
+/// @param options the batch options to populate
+/// @returns true on success
+bool ParseBatchArgs(tint::VectorRef<std::string_view> arguments, BatchOptions* options) {
+    auto parse_number = [](std::string_view arg, std::string_view prefix, size_t* out) {
+        auto value = arg.substr(prefix.size());
+        auto* end = value.data() + value.size();
+        auto res = std::from_chars(value.data(), end, *out);
+        return res.ec == std::errc{} && res.ptr == end;
+    };
+    for (size_t i = 1; i < arguments.Length(); i++) {
+        auto arg = arguments[i];
+        if (arg.starts_with("--jobs=")) {
+            if (!parse_number(arg, "--jobs=", &options->num_jobs) || options->num_jobs == 0) {
+                std::cerr << "invalid value for --jobs: " << arg << "\n";
+                return false;
+            }
+        } else if (arg.starts_with("--cache-size=")) {
+            size_t mib = 0;
+            if (!parse_number(arg, "--cache-size=", &mib)) {
+                std::cerr << "invalid value for --cache-size: " << arg << "\n";
+                return false;
+            }
+            if (mib > std::numeric_limits<size_t>::max() / (1024 * 1024)) {
+                std::cerr << "--cache-size is too large: " << arg << "\n";
+                return false;
+            }
+            options->cache_size = mib * 1024 * 1024;
+        } else {
+            std::cerr << "--batch only accepts --jobs=<n> and --cache-size=<MiB>, got: " << arg
+                      << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Builds the key used to look up the result of a job in the batch result cache.
+/// The key holds the job's arguments and a digest of the content of every argument that names a
+/// readable file, so that jobs are only shared if they were given identical inputs.
+/// @param args the job's arguments
+/// @returns the cache key, or std::nullopt if the job's result must not be cached
+std::optional<std::string> BatchCacheKey(tint::VectorRef<std::string> args) {
+    std::string key;
+    for (auto& arg : args) {
+        // Jobs that write to a file have side-effects that a cached result would skip.
+        if (arg == "-o" || arg.starts_with("-o=") || arg.starts_with("--output-name")) {
+            return std::nullopt;
+        }
+        key += std::to_string(arg.size()) + ":" + arg;
+
+        if (arg.starts_with("-")) {
+            continue;
+        }
+        std::ifstream file(arg, std::ios::binary);
+        if (file) {
+            std::ostringstream content;
+            content << file.rdbuf();
+            auto str = content.str();
+            // Only keep a digest of the content, so that the key stays small. The size and two
+            // independent hashes make a collision between different inputs vanishingly unlikely.
+            key += "[" + std::to_string(str.size()) + ":" +
+                   std::to_string(tint::CRC32(str.data(), str.size())) + ":" +
+                   std::to_string(std::hash<std::string>{}(str)) + "]";
+        }
+    }
+    return key;
+}
+
+/// Run jobs read from stdin concurrently, caching the results of identical jobs.
+/// @param options the batch options
+/// @returns 0 on success, non-zero on failure
+int RunBatch(const BatchOptions& options) {
+    // Each line read from stdin is a job that invokes Tint with the supplied arguments.
+    // Jobs are run concurrently in child processes, and results are written to stdout in the
+    // order they complete. Each result is a header line of the form:
+    //   <job index> <exit code> <stdout size> <stderr size>
+    // followed by the stdout and stderr bytes of the job.
+    // Jobs with identical arguments and input files share a single result. A job that is identical
+    // to one that is still running waits for that job's result instead of running again. Unlike
+    // the server, a failing job does not stop the batch.
+    auto tint_exe = tint::Command(tint::ExecutablePath());
+    if (!tint_exe.Found()) {
+        std::cerr << "could not find the tint executable\n";
+        return 1;
+    }
+
+    struct Job {
+        size_t index = 0;
+        std::string arg_line;
+    };
+
+    std::mutex mutex;
+    std::condition_variable queue_changed;
+    std::deque<Job> queue;
+    bool done_reading = false;
+    const size_t max_queued = options.num_jobs * 2;
+
+    // The results are shared, so that they can be written without holding the cache lock.
+    using Result = std::shared_ptr<const tint::Command::Output>;
+    std::mutex cache_mutex;
+    std::unordered_map<std::string, Result> cache;
+    size_t cache_bytes = 0;
+    // The indices of the jobs waiting for the result of the running job with the same key.
+    std::unordered_map<std::string, std::vector<size_t>> in_flight;
+
+    std::mutex output_mutex;
+    auto write_result = [&](size_t index, const tint::Command::Output& out) {
+        std::lock_guard<std::mutex> lock(output_mutex);
+        std::cout << index << " " << out.error_code << " " << out.out.size() << " "
+                  << out.err.size() << "\n";
+        std::cout.write(out.out.data(), static_cast<std::streamsize>(out.out.size()));
+        std::cout.write(out.err.data(), static_cast<std::streamsize>(out.err.size()));
+        std::cout << std::flush;
+    };
+
+    auto run_job = [&](const Job& job) {
+        auto args = SplitArguments(job.arg_line);
+        auto key = BatchCacheKey(args);
+        if (key) {
+            Result cached;
+            {
+                std::lock_guard<std::mutex> lock(cache_mutex);
+                if (auto it = cache.find(*key); it != cache.end()) {
+                    cached = it->second;
+                } else if (auto running = in_flight.find(*key); running != in_flight.end()) {
+                    // The job that is running writes the result of this one when it completes.
+                    running->second.push_back(job.index);
+                    return;
+                } else {
+                    in_flight.emplace(*key, std::vector<size_t>{});
+                }
+            }
+            if (cached) {
+                write_result(job.index, *cached);
+                return;
+            }
+        }
+
+        std::vector<std::string> arg_list(args.begin(), args.end());
+        auto out = std::make_shared<const tint::Command::Output>(tint_exe.Exec(arg_list));
+        write_result(job.index, *out);
+
+        if (key) {
+            std::vector<size_t> waiting;
+            {
+                std::lock_guard<std::mutex> lock(cache_mutex);
+                auto running = in_flight.find(*key);
+                waiting = std::move(running->second);
+                in_flight.erase(running);
+
+                size_t size = key->size() + out->out.size() + out->err.size();
+                if (cache_bytes + size <= options.cache_size &&
+                    cache.emplace(std::move(*key), out).second) {
+                    cache_bytes += size;
+                }
+            }
+            for (size_t index : waiting) {
+                write_result(index, *out);
+            }
+        }
+    };
+
+    auto worker = [&] {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                queue_changed.wait(lock, [&] { return !queue.empty() || done_reading; });
+                if (queue.empty()) {
+                    return;
+                }
+                job = std::move(queue.front());
+                queue.pop_front();
+            }
+            queue_changed.notify_all();
+            run_job(job);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < options.num_jobs; i++) {
+        threads.emplace_back(worker);
+    }
+
+    // Read the jobs, blocking while the queue is full to bound the memory used by pending jobs.
+    std::string arg_line;
+    for (size_t index = 0; std::getline(std::cin, arg_line); index++) {
+        std::unique_lock<std::mutex> lock(mutex);
+        queue_changed.wait(lock, [&] { return queue.size() < max_queued; });
+        queue.push_back(Job{index, std::move(arg_line)});
+        lock.unlock();
+        queue_changed.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done_reading = true;
+    }
+    queue_changed.notify_all();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return 0;
+}
+
 }  // namespace
 
 int main(int argc, const char** argv) {
@@ -1749,5 +2055,13 @@ int main(int argc, const char** argv) {
         return RunServer();
     }
 
+    if (arguments.Length() > 0 && arguments[0] == "--batch") {
+        BatchOptions batch_options;
+        if (!ParseBatchArgs(arguments, &batch_options)) {
+            return 1;
+        }
+        return RunBatch(batch_options);
+    }
+
     return Run(arguments, ExeMode::kStandalone);
 }
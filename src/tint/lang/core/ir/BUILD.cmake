@@ -62,6 +62,8 @@ tint_add_target(tint_lang_core_ir lib
   lang/core/ir/call.h
   lang/core/ir/clone_context.cc
   lang/core/ir/clone_context.h
+  lang/core/ir/clone_module.cc
+  lang/core/ir/clone_module.h
   lang/core/ir/const_param_validator.cc
   lang/core/ir/const_param_validator.h
   lang/core/ir/constant.cc
@@ -130,6 +132,8 @@ tint_add_target(tint_lang_core_ir lib
   lang/core/ir/operand_instruction.h
   lang/core/ir/override.cc
   lang/core/ir/override.h
+  lang/core/ir/pass_timer.cc
+  lang/core/ir/pass_timer.h
   lang/core/ir/phony.cc
   lang/core/ir/phony.h
   lang/core/ir/referenced_functions.h
@@ -187,6 +191,7 @@ tint_target_add_dependencies(tint_lang_core_ir lib
   tint_utils_reflection
   tint_utils_rtti
   tint_utils_symbol
+  tint_utils_system
   tint_utils_text
 )
 
@@ -204,6 +209,7 @@ tint_add_target(tint_lang_core_ir_test test
   lang/core/ir/block_test.cc
   lang/core/ir/break_if_test.cc
   lang/core/ir/builder_test.cc
+  lang/core/ir/clone_module_test.cc
   lang/core/ir/const_param_validator_test.cc
   lang/core/ir/constant_test.cc
   lang/core/ir/construct_test.cc
@@ -232,6 +238,7 @@ tint_add_target(tint_lang_core_ir_test test
   lang/core/ir/next_iteration_test.cc
   lang/core/ir/operand_instruction_test.cc
   lang/core/ir/override_test.cc
+  lang/core/ir/pass_timer_test.cc
   lang/core/ir/referenced_functions_test.cc
   lang/core/ir/referenced_module_decls_test.cc
   lang/core/ir/referenced_module_vars_test.cc
@@ -43,8 +43,13 @@ if(TINT_BUILD_IR_BINARY)
 tint_add_target(tint_lang_core_ir_binary lib
   lang/core/ir/binary/decode.cc
   lang/core/ir/binary/decode.h
+  lang/core/ir/binary/decode_flat.cc
   lang/core/ir/binary/encode.cc
   lang/core/ir/binary/encode.h
+  lang/core/ir/binary/encode_flat.cc
+  lang/core/ir/binary/flat.h
+  lang/core/ir/binary/identifier.cc
+  lang/core/ir/binary/identifier.h
 )
 
 tint_target_add_dependencies(tint_lang_core_ir_binary lib
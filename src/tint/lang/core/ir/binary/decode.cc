@@ -35,6 +35,7 @@
 #include <utility>
 
 #include "src/tint/lang/core/enums.h"
+#include "src/tint/lang/core/ir/binary/identifier.h"
 #include "src/tint/lang/core/ir/builder.h"
 #include "src/tint/lang/core/ir/control_instruction.h"
 #include "src/tint/lang/core/ir/module.h"
@@ -191,64 +192,12 @@ struct Decoder {
     /// Checks that the given @p name is valid.
     /// @returns the name if valid, otherwise nullopt.
     std::optional<std::string> CheckName(std::string name, const char* kind) {
-        if (DAWN_UNLIKELY(name.find('\0') != std::string::npos)) {
+        if (auto reason = CheckIdentifier(name); DAWN_UNLIKELY(!reason.empty())) {
             if (!options_.strip_invalid_identifiers) {
-                err_ << kind << " '" << name << "' contains '\\0' before end of the string\n";
+                err_ << kind << " '" << name << "' " << reason << "\n";
             }
             return std::nullopt;
         }
-
-        // Reject excessively long names as they cause problems in some backends.
-        if (DAWN_UNLIKELY(name.length() > 16384)) {
-            if (!options_.strip_invalid_identifiers) {
-                err_ << kind << " '" << name << "' is longer than 16384 characters\n";
-            }
-            return std::nullopt;
-        }
-
-        if (DAWN_UNLIKELY(!tint::utf8::IsWGSLIdentifier(name))) {
-            // Check if this is an internal frexp or modf result identifier.
-            auto builtin = core::ParseBuiltinType(name);
-            if (builtin != core::BuiltinType::kUndefined) {
-                switch (builtin) {
-                    case core::BuiltinType::kAtomicCompareExchangeResultI32:
-                    case core::BuiltinType::kAtomicCompareExchangeResultU32:
-                    case core::BuiltinType::kFrexpResultAbstract:
-                    case core::BuiltinType::kFrexpResultF16:
-                    case core::BuiltinType::kFrexpResultF32:
-                    case core::BuiltinType::kFrexpResultVec2Abstract:
-                    case core::BuiltinType::kFrexpResultVec2F16:
-                    case core::BuiltinType::kFrexpResultVec2F32:
-                    case core::BuiltinType::kFrexpResultVec3Abstract:
-                    case core::BuiltinType::kFrexpResultVec3F16:
-                    case core::BuiltinType::kFrexpResultVec3F32:
-                    case core::BuiltinType::kFrexpResultVec4Abstract:
-                    case core::BuiltinType::kFrexpResultVec4F16:
-                    case core::BuiltinType::kFrexpResultVec4F32:
-                    case core::BuiltinType::kModfResultAbstract:
-                    case core::BuiltinType::kModfResultF16:
-                    case core::BuiltinType::kModfResultF32:
-                    case core::BuiltinType::kModfResultVec2Abstract:
-                    case core::BuiltinType::kModfResultVec2F16:
-                    case core::BuiltinType::kModfResultVec2F32:
-                    case core::BuiltinType::kModfResultVec3Abstract:
-                    case core::BuiltinType::kModfResultVec3F16:
-                    case core::BuiltinType::kModfResultVec3F32:
-                    case core::BuiltinType::kModfResultVec4Abstract:
-                    case core::BuiltinType::kModfResultVec4F16:
-                    case core::BuiltinType::kModfResultVec4F32:
-                        return name;
-                    default:
-                        break;
-                }
-            }
-
-            if (!options_.strip_invalid_identifiers) {
-                err_ << kind << " '" << name << "' is not a valid WGSL identifier\n";
-            }
-            return std::nullopt;
-        }
-
         return name;
     }
 
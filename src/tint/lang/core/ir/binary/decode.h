@@ -54,6 +54,11 @@ Result<Module> Decode(std::span<const std::byte> encoded, const DecoderOptions&
 /// @returns the decoded Module from the protobuf.
 Result<Module> Decode(const pb::Module& module, const DecoderOptions& options = {});
 
+/// @returns the decoded Module from the flat binary representation produced by
+/// EncodeToFlatBinary(). The module is decoded directly from @p encoded in a single pass.
+Result<Module> DecodeFlatBinary(std::span<const std::byte> encoded,
+                                const DecoderOptions& options = {});
+
 }  // namespace tint::core::ir::binary
 
 #endif  // SRC_TINT_LANG_CORE_IR_BINARY_DECODE_H_
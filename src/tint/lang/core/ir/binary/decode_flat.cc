@@ -0,0 +1,1300 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "src/tint/lang/core/enums.h"
+#include "src/tint/lang/core/ir/binary/decode.h"
+#include "src/tint/lang/core/ir/binary/flat.h"
+#include "src/tint/lang/core/ir/binary/identifier.h"
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/control_instruction.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/type/array_count.h"
+#include "src/tint/lang/core/type/binding_array.h"
+#include "src/tint/lang/core/type/depth_multisampled_texture.h"
+#include "src/tint/lang/core/type/depth_texture.h"
+#include "src/tint/lang/core/type/external_texture.h"
+#include "src/tint/lang/core/type/function.h"
+#include "src/tint/lang/core/type/input_attachment.h"
+#include "src/tint/lang/core/type/invalid.h"
+#include "src/tint/lang/core/type/multisampled_texture.h"
+#include "src/tint/lang/core/type/sampled_texture.h"
+#include "src/tint/lang/core/type/storage_texture.h"
+#include "src/tint/lang/core/type/vector.h"
+#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/internal_limits.h"
+#include "src/tint/utils/memory/bitcast.h"
+#include "src/tint/utils/result.h"
+
+using namespace tint::core::fluent_types;  // NOLINT
+
+namespace tint::core::ir::binary {
+namespace {
+
+/// Reader reads the primitive encodings of the flat format from a span of bytes.
+/// Reading past the end of the span sets the failed flag and returns zero values, so callers only
+/// need to check Failed() at convenient points.
+class Reader {
+  public:
+    explicit Reader(std::span<const std::byte> data) : data_(data) {}
+
+    bool Failed() const { return failed_; }
+
+    void Fail() { failed_ = true; }
+
+    bool AtEnd() const { return offset_ == data_.size(); }
+
+    size_t Remaining() const { return data_.size() - offset_; }
+
+    uint8_t U8() {
+        if (DAWN_UNLIKELY(offset_ >= data_.size())) {
+            failed_ = true;
+            return 0;
+        }
+        return static_cast<uint8_t>(data_[offset_++]);
+    }
+
+    uint64_t Varint() {
+        uint64_t value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = U8();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        failed_ = true;
+        return 0;
+    }
+
+    uint32_t U32() {
+        uint64_t value = Varint();
+        if (DAWN_UNLIKELY(value > UINT32_MAX)) {
+            failed_ = true;
+            return 0;
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    int32_t Zigzag() {
+        uint32_t bits = U32();
+        return tint::Bitcast<int32_t>((bits >> 1) ^ (0u - (bits & 1)));
+    }
+
+    uint32_t U32LE() {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < 4; i++) {
+            value |= static_cast<uint32_t>(U8()) << (i * 8);
+        }
+        return value;
+    }
+
+    float F32() { return tint::Bitcast<float>(U32LE()); }
+
+    /// @returns a view of the string's bytes in the encoded data.
+    std::string_view String() {
+        uint64_t length = Varint();
+        if (DAWN_UNLIKELY(length > Remaining())) {
+            failed_ = true;
+            return {};
+        }
+        std::string_view str(reinterpret_cast<const char*>(data_.data() + offset_),
+                             static_cast<size_t>(length));
+        offset_ += static_cast<size_t>(length);
+        return str;
+    }
+
+    /// @returns an element count. As every element occupies at least one byte, counts greater
+    /// than the number of remaining bytes are rejected, bounding the work done on corrupt data.
+    uint32_t Count() {
+        uint32_t count = U32();
+        if (DAWN_UNLIKELY(count > Remaining())) {
+            failed_ = true;
+            return 0;
+        }
+        return count;
+    }
+
+  private:
+    std::span<const std::byte> data_;
+    size_t offset_ = 0;
+    bool failed_ = false;
+};
+
+struct FlatDecoder {
+    Reader in_;
+    const DecoderOptions& options_;
+
+    Module mod_out_{};
+    Vector<ir::Block*, 32> blocks_{};
+    Vector<const core::type::Type*, 32> types_{};
+    Vector<const core::constant::Value*, 32> constant_values_{};
+    Vector<ir::Value*, 32> values_{};
+    Builder b{mod_out_};
+
+    Vector<ir::ExitIf*, 32> exit_ifs_{};
+    Vector<ir::ExitSwitch*, 32> exit_switches_{};
+    Vector<ir::ExitLoop*, 32> exit_loops_{};
+    Vector<ir::NextIteration*, 32> next_iterations_{};
+    Vector<ir::BreakIf*, 32> break_ifs_{};
+    Vector<ir::Continue*, 32> continues_{};
+
+    std::stringstream err_{};
+    Hashset<std::string, 4> struct_names_{};
+
+    uint32_t entry_point_count = 0;
+
+    Result<Module> Decode() {
+        if (in_.U32LE() != flat::kMagic) {
+            return Failure{"not a flat IR binary"};
+        }
+        if (auto version = in_.U32(); version != flat::kVersion) {
+            return Failure{"unsupported flat IR binary version " + std::to_string(version)};
+        }
+
+        uint32_t num_types = in_.Count();
+        uint32_t num_constants = in_.Count();
+        uint32_t num_values = in_.Count();
+        uint32_t num_functions = in_.Count();
+        uint32_t num_blocks = in_.Count();
+        if (in_.Failed()) {
+            return Truncated();
+        }
+        if (num_blocks == 0) {
+            return Failure{"flat IR binary has no root block"};
+        }
+
+        mod_out_.functions.Reserve(num_functions);
+        for (uint32_t i = 0; i < num_functions; i++) {
+            auto* fn = mod_out_.CreateValue<ir::Function>();
+            fn->SetType(mod_out_.Types().function());
+            mod_out_.functions.Push(fn);
+        }
+        blocks_.Reserve(num_blocks);
+        for (uint32_t i = 0; i < num_blocks; i++) {
+            bool is_multi_in = in_.U8() != 0;
+            if (i == 0) {
+                if (is_multi_in) {
+                    err_ << "root block must not be a multi-in block\n";
+                }
+                blocks_.Push(mod_out_.root_block);
+            } else {
+                blocks_.Push(is_multi_in ? b.MultiInBlock() : b.Block());
+            }
+        }
+
+        // Definitions only refer to earlier definitions, so the tables can be filled in order.
+        types_.Reserve(num_types);
+        constant_values_.Reserve(num_constants);
+        values_.Reserve(num_values);
+        for (uint64_t i = 0, n = uint64_t{num_types} + num_constants + num_values; i < n; i++) {
+            switch (static_cast<flat::DefKind>(in_.U8())) {
+                case flat::DefKind::kType:
+                    types_.Push(CreateType());
+                    break;
+                case flat::DefKind::kConstant:
+                    constant_values_.Push(CreateConstantValue());
+                    break;
+                case flat::DefKind::kValue:
+                    values_.Push(CreateValue());
+                    break;
+                default:
+                    err_ << "invalid definition kind\n";
+                    return Failure{err_.str()};
+            }
+            if (in_.Failed()) {
+                return Truncated();
+            }
+        }
+        if (types_.Length() != num_types || constant_values_.Length() != num_constants ||
+            values_.Length() != num_values) {
+            err_ << "definition counts do not match the header\n";
+        }
+
+        for (auto* fn : mod_out_.functions) {
+            PopulateFunction(fn);
+            if (in_.Failed()) {
+                return Truncated();
+            }
+        }
+        for (auto* block : blocks_) {
+            PopulateBlock(block);
+            if (in_.Failed()) {
+                return Truncated();
+            }
+        }
+        if (!in_.AtEnd()) {
+            err_ << "unexpected data after the end of the module\n";
+        }
+
+        auto err = err_.str();
+        if (!err.empty()) {
+            // Note: Its not safe to call InferControlInstruction() with a broken IR.
+            return Failure{err};
+        }
+
+        if (CheckBlocks()) {
+            for (auto* exit : exit_ifs_) {
+                InferControlInstruction(exit, &ExitIf::SetIf);
+            }
+            for (auto* exit : exit_switches_) {
+                InferControlInstruction(exit, &ExitSwitch::SetSwitch);
+            }
+            for (auto* exit : exit_loops_) {
+                InferControlInstruction(exit, &ExitLoop::SetLoop);
+            }
+            for (auto* break_ifs : break_ifs_) {
+                InferControlInstruction(break_ifs, &BreakIf::SetLoop);
+            }
+            for (auto* next_iters : next_iterations_) {
+                InferControlInstruction(next_iters, &NextIteration::SetLoop);
+            }
+            for (auto* cont : continues_) {
+                InferControlInstruction(cont, &Continue::SetLoop);
+            }
+        }
+
+        // Set properties that are used by the decoded module.
+        if (entry_point_count > 1) {
+            mod_out_.properties.Add(core::ir::Property::kAllowMultipleEntryPoints);
+        }
+
+        err = err_.str();
+        if (!err.empty()) {
+            return Failure{err};
+        }
+        return std::move(mod_out_);
+    }
+
+    /// @returns the failure for when decoding stopped before reaching the end of the data.
+    Failure Truncated() {
+        auto err = err_.str();
+        return Failure{err.empty() ? "unexpected end of flat IR binary\n" : err};
+    }
+
+    /// Errors if @p number is not finite.
+    /// @returns @p number if finite, otherwise 0.
+    template <typename T>
+    Number<T> CheckFinite(Number<T> number) {
+        if (DAWN_UNLIKELY(!std::isfinite(number.value))) {
+            err_ << "value must be finite\n";
+            return Number<T>{};
+        }
+        return number;
+    }
+
+    /// Checks that the given @p name is valid.
+    /// @returns the name if valid, otherwise nullopt.
+    std::optional<std::string_view> CheckName(std::string_view name, const char* kind) {
+        if (auto reason = CheckIdentifier(name); DAWN_UNLIKELY(!reason.empty())) {
+            if (!options_.strip_invalid_identifiers) {
+                err_ << kind << " '" << name << "' " << reason << "\n";
+            }
+            return std::nullopt;
+        }
+        return name;
+    }
+
+    /// Reads an enum value, erroring if it is not in the inclusive range [@p first, @p last].
+    /// @returns the enum value, or @p first if the value is out of range.
+    template <typename T>
+    T Enum(T first, T last, const char* kind) {
+        auto value = in_.U8();
+        if (DAWN_UNLIKELY(value < static_cast<uint8_t>(first) ||
+                          value > static_cast<uint8_t>(last))) {
+            err_ << "invalid " << kind << ", " << std::to_string(value) << "\n";
+            return first;
+        }
+        return static_cast<T>(value);
+    }
+
+    /// @returns true if all blocks are reachable, acyclic nesting depth is less than or equal to
+    /// kMaxBlockDepth.
+    bool CheckBlocks() {
+        const size_t kMaxBlockDepth = 128;
+        Vector<std::pair<const ir::Block*, size_t>, 32> pending;
+        pending.Push(std::make_pair(mod_out_.root_block, 0));
+        for (auto& fn : mod_out_.functions) {
+            pending.Push(std::make_pair(fn->Block(), 0));
+        }
+        Hashset<const ir::Block*, 32> seen;
+        while (!pending.IsEmpty()) {
+            const auto block_depth = pending.Pop();
+            const auto* block = block_depth.first;
+            const size_t depth = block_depth.second;
+            if (!seen.Add(block)) {
+                err_ << "cyclic nesting of blocks\n";
+                return false;
+            }
+            if (depth > kMaxBlockDepth) {
+                err_ << "block nesting exceeds " << kMaxBlockDepth << "\n";
+                return false;
+            }
+            for (auto* inst = block->Instructions(); inst; inst = inst->next) {
+                if (auto* ctrl = inst->As<ir::ControlInstruction>()) {
+                    ctrl->ForeachBlock([&](const ir::Block* child) {
+                        pending.Push(std::make_pair(child, depth + 1));
+                    });
+                }
+            }
+        }
+
+        for (auto* block : blocks_) {
+            if (!seen.Contains(block)) {
+                err_ << "unreachable block\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename EXIT, typename CTRL_INST>
+    void InferControlInstruction(EXIT* exit, void (EXIT::*set)(CTRL_INST*)) {
+        for (auto* block = exit->Block(); block;) {
+            auto* parent = block->Parent();
+            if (!parent) {
+                break;
+            }
+            if (auto* ctrl_inst = parent->template As<CTRL_INST>()) {
+                (exit->*set)(ctrl_inst);
+                break;
+            }
+            block = parent->Block();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void PopulateFunction(ir::Function* fn_out) {
+        if (auto name_in = in_.String(); !name_in.empty()) {
+            if (auto name = CheckName(name_in, "function name")) {
+                mod_out_.SetName(fn_out, *name);
+            }
+        }
+        fn_out->SetReturnType(Type(in_.U32()));
+        auto stage = Enum(Function::PipelineStage::kUndefined, Function::PipelineStage::kVertex,
+                          "pipeline stage");
+        if (stage != Function::PipelineStage::kUndefined) {
+            fn_out->SetStage(stage);
+            entry_point_count++;
+        }
+        auto flags = in_.U8();
+        if (flags & flat::kFnWorkgroupSize) {
+            auto* x = Value(in_.U32());
+            auto* y = Value(in_.U32());
+            auto* z = Value(in_.U32());
+            fn_out->SetWorkgroupSize(x, y, z);
+        }
+        if (flags & flat::kFnSubgroupSize) {
+            fn_out->SetSubgroupSize(Value(in_.U32()));
+        }
+        Vector<FunctionParam*, 8> params_out;
+        for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+            auto* param_out = ValueAs<FunctionParam>(in_.U32());
+            if (DAWN_LIKELY(param_out)) {
+                params_out.Push(param_out);
+            }
+        }
+        if (flags & flat::kFnReturnLocation) {
+            fn_out->SetReturnLocation(in_.U32());
+        }
+        if (flags & flat::kFnReturnInterpolation) {
+            fn_out->SetReturnInterpolation(Interpolation());
+        }
+        if (flags & flat::kFnReturnBuiltin) {
+            fn_out->SetReturnBuiltin(BuiltinValue());
+        }
+        if (flags & flat::kFnReturnInvariant) {
+            fn_out->SetReturnInvariant(true);
+        }
+        fn_out->SetParams(std::move(params_out));
+        fn_out->SetBlock(Block(in_.U32()));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Blocks
+    ////////////////////////////////////////////////////////////////////////////
+    void PopulateBlock(ir::Block* block_out) {
+        if (auto* mib = block_out->As<ir::MultiInBlock>()) {
+            Vector<ir::BlockParam*, 8> params;
+            for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+                auto* param_out = ValueAs<BlockParam>(in_.U32());
+                if (DAWN_LIKELY(param_out)) {
+                    params.Push(param_out);
+                }
+            }
+            mib->SetParams(std::move(params));
+        }
+        for (uint32_t i = 0, n = in_.Count(); i < n && !in_.Failed(); i++) {
+            block_out->Append(Instruction());
+        }
+    }
+
+    ir::Block* Block(uint32_t id) {
+        if (DAWN_UNLIKELY(id >= blocks_.Length())) {
+            err_ << "block id " << id << " out of range\n";
+            return b.Block();
+        }
+        return blocks_[id];
+    }
+
+    template <typename T>
+    T* BlockAs(uint32_t id) {
+        auto* block = Block(id);
+        if (auto cast = As<T>(block); DAWN_LIKELY(cast)) {
+            return cast;
+        }
+        err_ << "block " << id << " is " << (block ? block->TypeInfo().name : "<null>")
+             << " expected " << TypeInfo::Of<T>().name << "\n";
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Instructions
+    ////////////////////////////////////////////////////////////////////////////
+    ir::Instruction* Instruction() {
+        ir::Instruction* inst_out = nullptr;
+        uint32_t num_next_iter_values = 0;
+        auto kind = in_.U8();
+        switch (static_cast<flat::InstructionKind>(kind)) {
+            case flat::InstructionKind::kAccess:
+                inst_out = mod_out_.CreateInstruction<ir::Access>();
+                break;
+            case flat::InstructionKind::kBreakIf: {
+                auto* break_if_out = mod_out_.CreateInstruction<ir::BreakIf>();
+                break_ifs_.Push(break_if_out);
+                num_next_iter_values = in_.U32();
+                inst_out = break_if_out;
+                break;
+            }
+            case flat::InstructionKind::kCoreBinary: {
+                auto op = Enum(core::BinaryOp::kAnd, core::BinaryOp::kModulo, "binary op");
+                auto* binary_out = mod_out_.CreateInstruction<ir::CoreBinary>();
+                binary_out->SetOp(op);
+                inst_out = binary_out;
+                break;
+            }
+            case flat::InstructionKind::kCoreBuiltinCall:
+                inst_out = CreateInstructionBuiltinCall();
+                break;
+            case flat::InstructionKind::kCoreUnary: {
+                auto op = Enum(core::UnaryOp::kAddressOf, core::UnaryOp::kNot, "unary op");
+                auto* unary_out = mod_out_.CreateInstruction<ir::CoreUnary>();
+                unary_out->SetOp(op);
+                inst_out = unary_out;
+                break;
+            }
+            case flat::InstructionKind::kConstExprIf:
+                inst_out = CreateInstructionIf(mod_out_.CreateInstruction<ir::ConstExprIf>());
+                break;
+            case flat::InstructionKind::kConstruct:
+                inst_out = mod_out_.CreateInstruction<ir::Construct>();
+                break;
+            case flat::InstructionKind::kContinue: {
+                auto* continue_ = mod_out_.CreateInstruction<ir::Continue>();
+                continues_.Push(continue_);
+                inst_out = continue_;
+                break;
+            }
+            case flat::InstructionKind::kConvert:
+                inst_out = mod_out_.CreateInstruction<ir::Convert>();
+                break;
+            case flat::InstructionKind::kDiscard:
+                inst_out = mod_out_.CreateInstruction<ir::Discard>();
+                break;
+            case flat::InstructionKind::kExitIf: {
+                auto* exit_out = mod_out_.CreateInstruction<ir::ExitIf>();
+                exit_ifs_.Push(exit_out);
+                inst_out = exit_out;
+                break;
+            }
+            case flat::InstructionKind::kExitLoop: {
+                auto* exit_out = mod_out_.CreateInstruction<ir::ExitLoop>();
+                exit_loops_.Push(exit_out);
+                inst_out = exit_out;
+                break;
+            }
+            case flat::InstructionKind::kExitSwitch: {
+                auto* exit_out = mod_out_.CreateInstruction<ir::ExitSwitch>();
+                exit_switches_.Push(exit_out);
+                inst_out = exit_out;
+                break;
+            }
+            case flat::InstructionKind::kIf:
+                inst_out = CreateInstructionIf(mod_out_.CreateInstruction<ir::If>());
+                break;
+            case flat::InstructionKind::kLet:
+                inst_out = mod_out_.CreateInstruction<ir::Let>();
+                break;
+            case flat::InstructionKind::kLoad:
+                inst_out = mod_out_.CreateInstruction<ir::Load>();
+                break;
+            case flat::InstructionKind::kLoadVectorElement:
+                inst_out = mod_out_.CreateInstruction<ir::LoadVectorElement>();
+                break;
+            case flat::InstructionKind::kLoop:
+                inst_out = CreateInstructionLoop();
+                break;
+            case flat::InstructionKind::kNextIteration: {
+                auto* next_it_out = mod_out_.CreateInstruction<ir::NextIteration>();
+                next_iterations_.Push(next_it_out);
+                inst_out = next_it_out;
+                break;
+            }
+            case flat::InstructionKind::kOverride: {
+                auto* override_out = mod_out_.CreateInstruction<ir::Override>();
+                if (in_.U8() & flat::kInstOverrideId) {
+                    override_out->SetOverrideId(OverrideId{static_cast<uint16_t>(in_.U32())});
+                }
+                mod_out_.properties.Add(core::ir::Property::kAllowOverrides);
+                inst_out = override_out;
+                break;
+            }
+            case flat::InstructionKind::kReturn:
+                inst_out = mod_out_.CreateInstruction<ir::Return>();
+                break;
+            case flat::InstructionKind::kStore:
+                inst_out = mod_out_.CreateInstruction<ir::Store>();
+                break;
+            case flat::InstructionKind::kStoreVectorElement:
+                inst_out = mod_out_.CreateInstruction<ir::StoreVectorElement>();
+                break;
+            case flat::InstructionKind::kSwitch:
+                inst_out = CreateInstructionSwitch();
+                break;
+            case flat::InstructionKind::kSwizzle: {
+                auto* swizzle_out = mod_out_.CreateInstruction<ir::Swizzle>();
+                Vector<uint32_t, 4> indices;
+                for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+                    indices.Push(in_.U32());
+                }
+                swizzle_out->SetIndices(indices);
+                inst_out = swizzle_out;
+                break;
+            }
+            case flat::InstructionKind::kUserCall:
+                inst_out = mod_out_.CreateInstruction<ir::UserCall>();
+                break;
+            case flat::InstructionKind::kVar:
+                inst_out = CreateInstructionVar();
+                break;
+            case flat::InstructionKind::kUnreachable:
+                inst_out = b.Unreachable();
+                break;
+        }
+        if (!inst_out) {
+            err_ << "invalid instruction kind: " << std::to_string(kind) << "\n";
+            // Stop decoding, as the length of the instruction is unknown.
+            in_.Fail();
+            return b.Let(mod_out_.Types().invalid());
+        }
+
+        Vector<ir::Value*, 4> operands;
+        for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+            operands.Push(Value(in_.U32()));
+        }
+        inst_out->SetOperands(std::move(operands));
+
+        Vector<ir::InstructionResult*, 4> results;
+        for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+            results.Push(ValueAs<ir::InstructionResult>(in_.U32()));
+        }
+        inst_out->SetResults(std::move(results));
+
+        if (auto alignment = in_.Varint(); alignment != 0) {
+            if (DAWN_UNLIKELY(alignment - 1 > UINT32_MAX)) {
+                err_ << "invalid alignment\n";
+            } else {
+                inst_out->SetAlignment(static_cast<uint32_t>(alignment - 1));
+            }
+        }
+
+        if (auto* break_if = inst_out->As<ir::BreakIf>()) {
+            bool is_valid = inst_out->Operands().Length() >=
+                            uint64_t{num_next_iter_values} + BreakIf::kArgsOperandOffset;
+            if (DAWN_LIKELY(is_valid)) {
+                break_if->SetNumNextIterValues(num_next_iter_values);
+            } else {
+                err_ << "invalid value for num_next_iter_values()\n";
+            }
+        }
+
+        return inst_out;
+    }
+
+    ir::CoreBuiltinCall* CreateInstructionBuiltinCall() {
+        auto* call_out = mod_out_.CreateInstruction<ir::CoreBuiltinCall>();
+        auto fn = in_.U8();
+        if (DAWN_UNLIKELY(fn >= static_cast<uint8_t>(core::BuiltinFn::kNone))) {
+            err_ << "invalid builtin function, " << std::to_string(fn) << "\n";
+        }
+        call_out->SetFunc(static_cast<core::BuiltinFn>(
+            std::min(fn, static_cast<uint8_t>(core::BuiltinFn::kNone))));
+        Vector<TemplateParameter, 1> params;
+        for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+            switch (static_cast<flat::TemplateParamKind>(in_.U8())) {
+                case flat::TemplateParamKind::kType:
+                    params.Push(Type(in_.U32()));
+                    break;
+                case flat::TemplateParamKind::kMajorness:
+                    params.Push(Enum(core::Majorness::kColMajor, core::Majorness::kRowMajor,
+                                     "majorness"));
+                    break;
+                default:
+                    err_ << "invalid template parameter kind\n";
+                    params.Push(mod_out_.Types().invalid());
+                    break;
+            }
+        }
+        call_out->SetExplicitTemplateParams(params);
+        return call_out;
+    }
+
+    ir::If* CreateInstructionIf(ir::If* if_out) {
+        auto flags = in_.U8();
+        if_out->SetTrue((flags & flat::kInstTrue) ? Block(in_.U32()) : b.Block());
+        if_out->SetFalse((flags & flat::kInstFalse) ? Block(in_.U32()) : b.Block());
+        return if_out;
+    }
+
+    ir::Loop* CreateInstructionLoop() {
+        auto flags = in_.U8();
+        ir::Block* initializer = nullptr;
+        if (flags & flat::kInstInitializer) {
+            initializer = Block(in_.U32());
+            if (initializer->Is<ir::MultiInBlock>()) {
+                err_ << "loop initializer must not be a multi-in block\n";
+                in_.Fail();
+                return nullptr;
+            }
+        } else {
+            initializer = b.Block();
+        }
+
+        auto* loop_out = mod_out_.CreateInstruction<ir::Loop>();
+        loop_out->SetInitializer(initializer);
+        loop_out->SetBody(BlockAs<ir::MultiInBlock>(in_.U32()));
+        if (flags & flat::kInstContinuing) {
+            loop_out->SetContinuing(BlockAs<ir::MultiInBlock>(in_.U32()));
+        } else {
+            loop_out->SetContinuing(b.MultiInBlock());
+        }
+        return loop_out;
+    }
+
+    ir::Switch* CreateInstructionSwitch() {
+        auto* switch_out = mod_out_.CreateInstruction<ir::Switch>();
+        for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+            ir::Switch::Case case_out{};
+            case_out.block = Block(in_.U32());
+            case_out.block->SetParent(switch_out);
+            bool is_default = in_.U8() != 0;
+            for (uint32_t j = 0, m = in_.Count(); j < m; j++) {
+                ir::Switch::CaseSelector selector_out{};
+                selector_out.val = b.Constant(ConstantValue(in_.U32()));
+                case_out.selectors.Push(std::move(selector_out));
+            }
+            if (is_default) {
+                ir::Switch::CaseSelector selector_out{};
+                case_out.selectors.Push(std::move(selector_out));
+            }
+            switch_out->Cases().Push(std::move(case_out));
+        }
+        return switch_out;
+    }
+
+    ir::Var* CreateInstructionVar() {
+        auto* var_out = mod_out_.CreateInstruction<ir::Var>();
+        auto flags = in_.U8();
+        if (flags & flat::kInstBindingPoint) {
+            auto group = in_.U32();
+            auto binding = in_.U32();
+            var_out->SetBindingPoint(group, binding);
+        }
+        if (flags & flat::kInstInputAttachmentIndex) {
+            var_out->SetInputAttachmentIndex(in_.U32());
+        }
+        return var_out;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    const core::type::Type* CreateType() {
+        auto kind = in_.U8();
+        switch (static_cast<flat::TypeKind>(kind)) {
+            case flat::TypeKind::kVoid:
+                return mod_out_.Types().void_();
+            case flat::TypeKind::kBool:
+                return mod_out_.Types().bool_();
+            case flat::TypeKind::kI32:
+                return mod_out_.Types().i32();
+            case flat::TypeKind::kU32:
+                return mod_out_.Types().u32();
+            case flat::TypeKind::kF32:
+                return mod_out_.Types().f32();
+            case flat::TypeKind::kF16:
+                mod_out_.properties.Add(core::ir::Property::kAllow16BitFloats);
+                return mod_out_.Types().f16();
+            case flat::TypeKind::kU64:
+                return mod_out_.Types().u64();
+            case flat::TypeKind::kI8:
+                return mod_out_.Types().i8();
+            case flat::TypeKind::kU8:
+                return mod_out_.Types().u8();
+            case flat::TypeKind::kVector:
+                return CreateTypeVector();
+            case flat::TypeKind::kMatrix:
+                return CreateTypeMatrix();
+            case flat::TypeKind::kPointer: {
+                auto address_space =
+                    Enum(core::AddressSpace::kFunction, core::AddressSpace::kWorkgroup,
+                         "address space");
+                auto* store_ty = Type(in_.U32());
+                auto access = AccessControl();
+                return mod_out_.Types().ptr(address_space, store_ty, access);
+            }
+            case flat::TypeKind::kStruct:
+                return CreateTypeStruct();
+            case flat::TypeKind::kAtomic:
+                return mod_out_.Types().atomic(Type(in_.U32()));
+            case flat::TypeKind::kArray:
+                return CreateTypeArray();
+            case flat::TypeKind::kBindingArray:
+                return CreateTypeBindingArray();
+            case flat::TypeKind::kDepthTexture: {
+                auto dimension = TextureDimension();
+                if (!core::type::DepthTexture::IsValidDimension(dimension)) {
+                    err_ << "invalid DepthTexture dimension\n";
+                    return mod_out_.Types().invalid();
+                }
+                return mod_out_.Types().depth_texture(dimension);
+            }
+            case flat::TypeKind::kSampledTexture: {
+                auto dimension = TextureDimension();
+                return mod_out_.Types().sampled_texture(dimension, Type(in_.U32()));
+            }
+            case flat::TypeKind::kMultisampledTexture: {
+                auto dimension = TextureDimension();
+                return mod_out_.Types().multisampled_texture(dimension, Type(in_.U32()));
+            }
+            case flat::TypeKind::kDepthMultisampledTexture: {
+                auto dimension = TextureDimension();
+                if (!core::type::DepthMultisampledTexture::IsValidDimension(dimension)) {
+                    err_ << "invalid DepthMultisampledTexture dimension\n";
+                    return mod_out_.Types().invalid();
+                }
+                return mod_out_.Types().depth_multisampled_texture(dimension);
+            }
+            case flat::TypeKind::kStorageTexture: {
+                auto dimension = TextureDimension();
+                auto texel_format = TexelFormat();
+                auto access = AccessControl();
+                if (!mod_out_.Types().SubtypeFor(texel_format)) {
+                    err_ << "unable to create a sub-type for " << texel_format << "\n";
+                    return mod_out_.Types().invalid();
+                }
+                return mod_out_.Types().storage_texture(dimension, texel_format, access);
+            }
+            case flat::TypeKind::kTexelBuffer: {
+                auto texel_format = TexelFormat();
+                auto access = AccessControl();
+                if (!mod_out_.Types().SubtypeFor(texel_format)) {
+                    err_ << "unable to create a sub-type for " << texel_format << "\n";
+                    return mod_out_.Types().invalid();
+                }
+                return mod_out_.Types().texel_buffer(texel_format, access);
+            }
+            case flat::TypeKind::kExternalTexture:
+                return mod_out_.Types().external_texture();
+            case flat::TypeKind::kSampler: {
+                auto kind_in = Enum(core::type::SamplerKind::kSampler,
+                                    core::type::SamplerKind::kComparisonSampler, "sampler kind");
+                return mod_out_.Types().Get<core::type::Sampler>(kind_in);
+            }
+            case flat::TypeKind::kInputAttachment:
+                return mod_out_.Types().input_attachment(Type(in_.U32()));
+            case flat::TypeKind::kSubgroupMatrix: {
+                auto kind_in = Enum(SubgroupMatrixKind::kLeft, SubgroupMatrixKind::kRight,
+                                    "subgroup matrix kind");
+                auto* el_ty = Type(in_.U32());
+                auto columns = in_.U32();
+                auto rows = in_.U32();
+                return mod_out_.Types().subgroup_matrix(kind_in, el_ty, columns, rows);
+            }
+            case flat::TypeKind::kBuffer:
+                return CreateTypeBuffer();
+        }
+
+        err_ << "invalid type kind: " << std::to_string(kind) << "\n";
+        in_.Fail();
+        return mod_out_.Types().invalid();
+    }
+
+    const core::type::Type* CreateTypeVector() {
+        auto width = in_.U32();
+        auto* el_ty = Type(in_.U32());
+        if (DAWN_UNLIKELY(width < 2 || width > 4)) {
+            err_ << "invalid vector width\n";
+            return mod_out_.Types().invalid();
+        }
+        return mod_out_.Types().vec(el_ty, width);
+    }
+
+    const core::type::Type* CreateTypeMatrix() {
+        auto cols = in_.U32();
+        auto rows = in_.U32();
+        auto* el_ty = Type(in_.U32());
+        if (DAWN_UNLIKELY(rows < 2 || rows > 4 || cols < 2 || cols > 4)) {
+            err_ << "invalid matrix dimensions\n";
+            return mod_out_.Types().invalid();
+        }
+        auto* column_ty = mod_out_.Types().vec(el_ty, rows);
+        return mod_out_.Types().mat(column_ty, cols);
+    }
+
+    const core::type::Type* CreateTypeStruct() {
+        auto struct_name_in = in_.String();
+        bool valid = true;
+        if (DAWN_UNLIKELY(struct_name_in.empty())) {
+            err_ << "struct must have a name\n";
+            valid = false;
+        }
+        auto struct_name = valid ? CheckName(struct_name_in, "struct name") : std::nullopt;
+        if (valid && !struct_name) {
+            valid = options_.strip_invalid_identifiers;
+        } else if (struct_name && !struct_names_.Add(std::string(*struct_name))) {
+            err_ << "duplicate struct name: " << *struct_name << "\n";
+            valid = false;
+        }
+
+        // The members are always read, so that the decoder remains in sync with the stream.
+        Vector<const core::type::StructMember*, 8> members_out;
+        uint32_t offset = 0;
+        for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+            auto member_name_in = in_.String();
+            auto* type = Type(in_.U32());
+            auto size = in_.U32();
+            auto align = in_.U32();
+            auto flags = in_.U8();
+            core::IOAttributes attributes_out{};
+            if (flags & flat::kAttrLocation) {
+                attributes_out.location = in_.U32();
+            }
+            if (flags & flat::kAttrBlendSrc) {
+                attributes_out.blend_src = in_.U32();
+            }
+            if (flags & flat::kAttrColor) {
+                attributes_out.color = in_.U32();
+            }
+            if (flags & flat::kAttrBuiltin) {
+                attributes_out.builtin = BuiltinValue();
+            }
+            if (flags & flat::kAttrInterpolation) {
+                attributes_out.interpolation = Interpolation();
+            }
+            attributes_out.invariant = (flags & flat::kAttrInvariant) != 0;
+            if (!valid) {
+                continue;
+            }
+
+            if (DAWN_UNLIKELY(member_name_in.empty())) {
+                err_ << "struct member must have a name\n";
+                valid = false;
+                continue;
+            }
+            auto member_name = CheckName(member_name_in, "member name");
+            if (!member_name && !options_.strip_invalid_identifiers) {
+                valid = false;
+                continue;
+            }
+            auto symbol =
+                member_name ? mod_out_.symbols.Register(*member_name) : mod_out_.symbols.New();
+            offset = RoundUp(align, offset);
+            auto* member_out = mod_out_.Types().Get<core::type::StructMember>(
+                symbol, type, i, offset, align, size, std::move(attributes_out));
+            offset += size;
+            members_out.Push(member_out);
+        }
+        if (!valid) {
+            return mod_out_.Types().invalid();
+        }
+        if (DAWN_UNLIKELY(members_out.IsEmpty())) {
+            err_ << "struct requires at least one member\n";
+            return mod_out_.Types().invalid();
+        }
+        auto name = struct_name ? mod_out_.symbols.Register(*struct_name) : mod_out_.symbols.New();
+        return mod_out_.Types().Struct(name, std::move(members_out));
+    }
+
+    const core::type::Type* CreateTypeArray() {
+        auto* element = Type(in_.U32());
+        auto kind =
+            Enum(flat::CountKind::kConstant, flat::CountKind::kOverride, "array count kind");
+        auto count = in_.U32();
+        switch (kind) {
+            case flat::CountKind::kOverride: {
+                auto* value_count =
+                    mod_out_.Types().Get<core::ir::type::ValueArrayCount>(Value(count));
+                return mod_out_.Types().Get<core::type::Array>(element, value_count, 0u);
+            }
+            case flat::CountKind::kRuntime:
+                return mod_out_.Types().runtime_array(element);
+            case flat::CountKind::kConstant:
+                break;
+        }
+        if (count == 0 || count >= internal_limits::kMaxArrayElementCount) {
+            err_ << "array count (" << count << ") must be greater than 0 and less than "
+                 << internal_limits::kMaxArrayElementCount << "\n";
+            return mod_out_.Types().invalid();
+        }
+        return mod_out_.Types().array(element, count);
+    }
+
+    const core::type::Type* CreateTypeBindingArray() {
+        auto* element = Type(in_.U32());
+        auto count = in_.U32();
+        if (count >= internal_limits::kMaxArrayElementCount) {
+            err_ << "binding_array count (" << count << ") must be less than "
+                 << internal_limits::kMaxArrayElementCount << "\n";
+            return mod_out_.Types().invalid();
+        }
+        return mod_out_.Types().binding_array(element, count);
+    }
+
+    const core::type::Type* CreateTypeBuffer() {
+        mod_out_.properties.Add(core::ir::Property::kAllowBufferTypes);
+        auto kind =
+            Enum(flat::CountKind::kConstant, flat::CountKind::kOverride, "buffer size kind");
+        auto size = in_.U32();
+        switch (kind) {
+            case flat::CountKind::kOverride: {
+                auto* value_size =
+                    mod_out_.Types().Get<core::ir::type::ValueArrayCount>(Value(size));
+                return mod_out_.Types().Get<core::type::Buffer>(value_size);
+            }
+            case flat::CountKind::kRuntime:
+                return mod_out_.Types().unsized_buffer();
+            case flat::CountKind::kConstant:
+                break;
+        }
+        if (size == 0 || size >= internal_limits::kMaxArrayElementCount) {
+            err_ << "buffer size (" << size << ") must be greater than 0 and less than "
+                 << internal_limits::kMaxArrayElementCount << "\n";
+            return mod_out_.Types().invalid();
+        }
+        return mod_out_.Types().buffer(size);
+    }
+
+    const core::type::Type* Type(uint32_t id) {
+        if (DAWN_UNLIKELY(id >= types_.Length())) {
+            err_ << "type id " << id << " out of range\n";
+            return mod_out_.Types().invalid();
+        }
+        return types_[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Values
+    ////////////////////////////////////////////////////////////////////////////
+    ir::Value* CreateValue() {
+        auto kind = in_.U8();
+        switch (static_cast<flat::ValueKind>(kind)) {
+            case flat::ValueKind::kInstructionResult: {
+                auto* type = Type(in_.U32());
+                auto name = in_.String();
+                if (!CheckValueType(type, name, "result")) {
+                    return nullptr;
+                }
+                return Named(b.InstructionResult(type), name, "result name");
+            }
+            case flat::ValueKind::kFunctionParam:
+                return CreateFunctionParameter();
+            case flat::ValueKind::kBlockParam: {
+                auto* type = Type(in_.U32());
+                auto name = in_.String();
+                if (!CheckValueType(type, name, "block parameter")) {
+                    return nullptr;
+                }
+                return Named(b.BlockParam(type), name, "param name");
+            }
+            case flat::ValueKind::kFunction: {
+                auto id = in_.U32();
+                if (DAWN_UNLIKELY(id >= mod_out_.functions.Length())) {
+                    err_ << "function id " << id << " out of range\n";
+                    return nullptr;
+                }
+                return mod_out_.functions[id];
+            }
+            case flat::ValueKind::kConstant:
+                return b.Constant(ConstantValue(in_.U32()));
+        }
+
+        err_ << "invalid value kind: " << std::to_string(kind) << "\n";
+        in_.Fail();
+        return nullptr;
+    }
+
+    bool CheckValueType(const core::type::Type* type, std::string_view name, const char* kind) {
+        if (type->Is<core::type::Invalid>()) {
+            err_ << kind << " '" << name << "' has invalid type\n";
+            return false;
+        }
+        return true;
+    }
+
+    /// Names @p value with @p name, if it is not empty.
+    /// @returns @p value, or nullptr if the name is invalid and cannot be stripped.
+    template <typename T>
+    T* Named(T* value, std::string_view name, const char* kind) {
+        if (!name.empty()) {
+            if (auto checked = CheckName(name, kind)) {
+                mod_out_.SetName(value, *checked);
+            } else if (!options_.strip_invalid_identifiers) {
+                return nullptr;
+            }
+        }
+        return value;
+    }
+
+    ir::FunctionParam* CreateFunctionParameter() {
+        auto* type = Type(in_.U32());
+        auto name = in_.String();
+        auto flags = in_.U8();
+        std::optional<BindingPoint> binding_point;
+        if (flags & flat::kAttrBindingPoint) {
+            auto group = in_.U32();
+            auto binding = in_.U32();
+            binding_point = BindingPoint{group, binding};
+        }
+        std::optional<uint32_t> location;
+        if (flags & flat::kAttrLocation) {
+            location = in_.U32();
+        }
+        std::optional<uint32_t> color;
+        if (flags & flat::kAttrColor) {
+            color = in_.U32();
+        }
+        std::optional<core::Interpolation> interpolation;
+        if (flags & flat::kAttrInterpolation) {
+            interpolation = Interpolation();
+        }
+        std::optional<core::BuiltinValue> builtin;
+        if (flags & flat::kAttrBuiltin) {
+            builtin = BuiltinValue();
+        }
+
+        if (!CheckValueType(type, name, "param")) {
+            return nullptr;
+        }
+        auto* param_out = Named(b.FunctionParam(type), name, "param name");
+        if (!param_out) {
+            return nullptr;
+        }
+        if (binding_point) {
+            param_out->SetBindingPoint(binding_point->group, binding_point->binding);
+        }
+        if (location) {
+            param_out->SetLocation(*location);
+        }
+        if (color) {
+            param_out->SetColor(*color);
+        }
+        if (interpolation) {
+            param_out->SetInterpolation(*interpolation);
+        }
+        if (builtin) {
+            param_out->SetBuiltin(*builtin);
+        }
+        if (flags & flat::kAttrInvariant) {
+            param_out->SetInvariant(true);
+        }
+        return param_out;
+    }
+
+    ir::Value* Value(uint32_t id) {
+        if (DAWN_UNLIKELY(id > values_.Length())) {
+            err_ << "value id " << id << " out of range\n";
+            return nullptr;
+        }
+        return id == 0 ? nullptr : values_[id - 1];
+    }
+
+    template <typename T>
+    T* ValueAs(uint32_t id) {
+        auto* value = Value(id);
+        if (auto cast = As<T>(value); DAWN_LIKELY(cast)) {
+            return cast;
+        }
+        err_ << "value " << id << " is " << (value ? value->TypeInfo().name : "<null>")
+             << " expected " << TypeInfo::Of<T>().name << "\n";
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // ConstantValues
+    ////////////////////////////////////////////////////////////////////////////
+    const core::constant::Value* CreateConstantValue() {
+        auto kind = in_.U8();
+        switch (static_cast<flat::ConstantKind>(kind)) {
+            case flat::ConstantKind::kBool:
+                return b.ConstantValue(in_.U8() != 0);
+            case flat::ConstantKind::kI32:
+                return b.ConstantValue(i32(in_.Zigzag()));
+            case flat::ConstantKind::kU32:
+                return b.ConstantValue(u32(in_.U32()));
+            case flat::ConstantKind::kF32:
+                return b.ConstantValue(CheckFinite(f32(in_.F32())));
+            case flat::ConstantKind::kF16:
+                return b.ConstantValue(CheckFinite(f16(in_.F32())));
+            case flat::ConstantKind::kComposite:
+                return CreateConstantComposite();
+            case flat::ConstantKind::kSplat:
+                return CreateConstantSplat();
+        }
+        err_ << "invalid constant kind: " << std::to_string(kind) << "\n";
+        in_.Fail();
+        return b.InvalidConstant()->Value();
+    }
+
+    const core::constant::Value* CreateConstantComposite() {
+        auto* type = Type(in_.U32());
+        Vector<const core::constant::Value*, 8> elements_out;
+        for (uint32_t i = 0, n = in_.Count(); i < n; i++) {
+            elements_out.Push(ConstantValue(in_.U32()));
+        }
+
+        auto type_elements = type->Elements();
+        if (DAWN_UNLIKELY(type_elements.count == 0)) {
+            err_ << "cannot create a composite of type " << type->FriendlyName() << "\n";
+            return b.InvalidConstant()->Value();
+        }
+        if (DAWN_UNLIKELY(type_elements.count != elements_out.Length())) {
+            err_ << "constant composite type " << type->FriendlyName() << " expects "
+                 << type_elements.count << " elements, but " << elements_out.Length()
+                 << " values encoded\n";
+            return b.InvalidConstant()->Value();
+        }
+        for (uint32_t i = 0; i < elements_out.Length(); i++) {
+            auto* value = elements_out[i];
+            if (auto* el_type = type->Element(i); DAWN_UNLIKELY(value->Type() != el_type)) {
+                if (!el_type) {
+                    err_ << "constant composite has a null element type\n";
+                } else {
+                    err_ << "constant composite element value type "
+                         << value->Type()->FriendlyName() << " does not match element type "
+                         << el_type->FriendlyName() << "\n";
+                }
+                return b.InvalidConstant()->Value();
+            }
+        }
+        return mod_out_.constant_values.Composite(type, std::move(elements_out));
+    }
+
+    const core::constant::Value* CreateConstantSplat() {
+        auto* type = Type(in_.U32());
+        auto* value = ConstantValue(in_.U32());
+
+        uint32_t num_elements = type->Elements().count;
+        if (DAWN_UNLIKELY(num_elements == 0)) {
+            err_ << "cannot create a splat of type " << type->FriendlyName() << "\n";
+            return b.InvalidConstant()->Value();
+        }
+        if (DAWN_UNLIKELY(num_elements > internal_limits::kMaxArrayConstructorElements)) {
+            err_ << "array constructor has excessive number of elements (>"
+                 << internal_limits::kMaxArrayConstructorElements << ")\n";
+            return b.InvalidConstant()->Value();
+        }
+        for (uint32_t i = 0; i < num_elements; i++) {
+            auto* el_type = type->Element(i);
+            if (DAWN_UNLIKELY(el_type != value->Type())) {
+                err_ << "constant splat element value type " << value->Type()->FriendlyName()
+                     << " does not match element " << i << " type " << el_type->FriendlyName()
+                     << "\n";
+                return b.InvalidConstant()->Value();
+            }
+        }
+        return mod_out_.constant_values.Splat(type, value);
+    }
+
+    const core::constant::Value* ConstantValue(uint32_t id) {
+        if (DAWN_UNLIKELY(id >= constant_values_.Length())) {
+            err_ << "constant value id " << id << " out of range\n";
+            return b.InvalidConstant()->Value();
+        }
+        return constant_values_[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Attributes and enums
+    ////////////////////////////////////////////////////////////////////////////
+    core::Interpolation Interpolation() {
+        core::Interpolation interpolation_out{};
+        interpolation_out.type = Enum(core::InterpolationType::kFlat,
+                                      core::InterpolationType::kPerspective, "interpolation type");
+        interpolation_out.sampling =
+            Enum(core::InterpolationSampling::kUndefined, core::InterpolationSampling::kSample,
+                 "interpolation sampling");
+        return interpolation_out;
+    }
+
+    core::BuiltinValue BuiltinValue() {
+        return Enum(core::BuiltinValue::kCullDistance, core::BuiltinValue::kWorkgroupIndex,
+                    "builtin value");
+    }
+
+    core::Access AccessControl() {
+        return Enum(core::Access::kRead, core::Access::kWrite, "access control");
+    }
+
+    core::TexelFormat TexelFormat() {
+        return Enum(core::TexelFormat::kBgra8Unorm, core::TexelFormat::kRgba8Unorm,
+                    "texel format");
+    }
+
+    core::type::TextureDimension TextureDimension() {
+        return Enum(core::type::TextureDimension::k1d, core::type::TextureDimension::kCubeArray,
+                    "texture dimension");
+    }
+};
+
+}  // namespace
+
+Result<Module> DecodeFlatBinary(std::span<const std::byte> encoded, const DecoderOptions& options) {
+    return FlatDecoder{Reader{encoded}, options}.Decode();
+}
+
+}  // namespace tint::core::ir::binary
@@ -270,5 +270,68 @@ TEST_F(IRBinaryDecodeTest, Overrides) {
     EXPECT_TRUE(decoded.Get().properties.Contains(core::ir::Property::kAllowOverrides));
 }
 
+TEST_F(IRBinaryDecodeTest, Flat_MultipleEntryPointsAndOverrides) {
+    b.Append(mod.root_block, [&] {  //
+        b.Override(ty.u32());
+    });
+    b.ComputeFunction("ep1");
+    b.ComputeFunction("ep2");
+
+    auto res = EncodeToFlatBinary(mod);
+    ASSERT_TRUE(res == Success) << res.Failure();
+
+    auto decoded = DecodeFlatBinary(res->AsSpan());
+    ASSERT_EQ(decoded, Success);
+
+    EXPECT_TRUE(decoded.Get().properties.Contains(core::ir::Property::kAllowMultipleEntryPoints));
+    EXPECT_TRUE(decoded.Get().properties.Contains(core::ir::Property::kAllowOverrides));
+}
+
+TEST_F(IRBinaryDecodeTest, Flat_BadMagic) {
+    b.ComputeFunction("main");
+
+    auto res = EncodeToFlatBinary(mod);
+    ASSERT_TRUE(res == Success) << res.Failure();
+
+    auto encoded = std::move(res.Get());
+    encoded[0] = std::byte{'X'};
+
+    auto decoded = DecodeFlatBinary(encoded.AsSpan());
+    EXPECT_NE(decoded, Success);
+    EXPECT_THAT(decoded.Failure().reason, testing::HasSubstr("not a flat IR binary"));
+}
+
+TEST_F(IRBinaryDecodeTest, Flat_Truncated) {
+    auto* fn = b.Function("f", ty.vec4<f32>());
+    b.Append(fn->Block(), [&] {
+        auto* v = b.Var<function, vec4<f32>>("v");
+        b.Return(fn, b.Load(v));
+    });
+
+    auto res = EncodeToFlatBinary(mod);
+    ASSERT_TRUE(res == Success) << res.Failure();
+
+    auto encoded = res->AsSpan();
+    for (size_t len = 0; len < encoded.size(); len++) {
+        auto decoded = DecodeFlatBinary(encoded.first(len));
+        EXPECT_NE(decoded, Success) << "length: " << len;
+    }
+}
+
+TEST_F(IRBinaryDecodeTest, Flat_TrailingData) {
+    b.ComputeFunction("main");
+
+    auto res = EncodeToFlatBinary(mod);
+    ASSERT_TRUE(res == Success) << res.Failure();
+
+    auto encoded = std::move(res.Get());
+    encoded.Push(std::byte{0});
+
+    auto decoded = DecodeFlatBinary(encoded.AsSpan());
+    EXPECT_NE(decoded, Success);
+    EXPECT_THAT(decoded.Failure().reason,
+                testing::HasSubstr("unexpected data after the end of the module"));
+}
+
 }  // namespace
 }  // namespace tint::core::ir::binary
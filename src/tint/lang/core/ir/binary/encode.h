@@ -50,6 +50,9 @@ Result<std::unique_ptr<pb::Module>> EncodeToProto(const Module& module);
 // Encode the module into a binary representation.
 Result<Vector<std::byte, 0>> EncodeToBinary(const Module& module);
 
+// Encode the module into the flat binary representation. See flat.h for the format.
+Result<Vector<std::byte, 0>> EncodeToFlatBinary(const Module& module);
+
 }  // namespace tint::core::ir::binary
 
 #endif  // SRC_TINT_LANG_CORE_IR_BINARY_ENCODE_H_
@@ -0,0 +1,841 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/enums.h"
+#include "src/tint/lang/core/ir/access.h"
+#include "src/tint/lang/core/ir/binary/encode.h"
+#include "src/tint/lang/core/ir/binary/flat.h"
+#include "src/tint/lang/core/ir/break_if.h"
+#include "src/tint/lang/core/ir/constexpr_if.h"
+#include "src/tint/lang/core/ir/construct.h"
+#include "src/tint/lang/core/ir/continue.h"
+#include "src/tint/lang/core/ir/convert.h"
+#include "src/tint/lang/core/ir/core_binary.h"
+#include "src/tint/lang/core/ir/core_builtin_call.h"
+#include "src/tint/lang/core/ir/core_unary.h"
+#include "src/tint/lang/core/ir/discard.h"
+#include "src/tint/lang/core/ir/exit_if.h"
+#include "src/tint/lang/core/ir/exit_loop.h"
+#include "src/tint/lang/core/ir/exit_switch.h"
+#include "src/tint/lang/core/ir/function_param.h"
+#include "src/tint/lang/core/ir/if.h"
+#include "src/tint/lang/core/ir/let.h"
+#include "src/tint/lang/core/ir/load.h"
+#include "src/tint/lang/core/ir/load_vector_element.h"
+#include "src/tint/lang/core/ir/loop.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/multi_in_block.h"
+#include "src/tint/lang/core/ir/next_iteration.h"
+#include "src/tint/lang/core/ir/override.h"
+#include "src/tint/lang/core/ir/return.h"
+#include "src/tint/lang/core/ir/store.h"
+#include "src/tint/lang/core/ir/store_vector_element.h"
+#include "src/tint/lang/core/ir/switch.h"
+#include "src/tint/lang/core/ir/swizzle.h"
+#include "src/tint/lang/core/ir/type/array_count.h"
+#include "src/tint/lang/core/ir/unreachable.h"
+#include "src/tint/lang/core/ir/user_call.h"
+#include "src/tint/lang/core/ir/var.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/binding_array.h"
+#include "src/tint/lang/core/type/bool.h"
+#include "src/tint/lang/core/type/depth_multisampled_texture.h"
+#include "src/tint/lang/core/type/depth_texture.h"
+#include "src/tint/lang/core/type/external_texture.h"
+#include "src/tint/lang/core/type/f16.h"
+#include "src/tint/lang/core/type/f32.h"
+#include "src/tint/lang/core/type/i32.h"
+#include "src/tint/lang/core/type/i8.h"
+#include "src/tint/lang/core/type/input_attachment.h"
+#include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/multisampled_texture.h"
+#include "src/tint/lang/core/type/pointer.h"
+#include "src/tint/lang/core/type/sampled_texture.h"
+#include "src/tint/lang/core/type/sampler.h"
+#include "src/tint/lang/core/type/storage_texture.h"
+#include "src/tint/lang/core/type/u32.h"
+#include "src/tint/lang/core/type/u64.h"
+#include "src/tint/lang/core/type/u8.h"
+#include "src/tint/lang/core/type/void.h"
+#include "src/tint/utils/internal_limits.h"
+#include "src/tint/utils/memory/bitcast.h"
+#include "src/tint/utils/rtti/switch.h"
+
+namespace tint::core::ir::binary {
+namespace {
+
+/// Writer appends the primitive encodings of the flat format to a byte buffer.
+class Writer {
+  public:
+    void U8(uint8_t value) { bytes_.Push(static_cast<std::byte>(value)); }
+
+    void Varint(uint64_t value) {
+        while (value >= 0x80) {
+            U8(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        U8(static_cast<uint8_t>(value));
+    }
+
+    void Zigzag(int32_t value) {
+        auto bits = tint::Bitcast<uint32_t>(value);
+        Varint((bits << 1) ^ (value < 0 ? 0xffffffffu : 0u));
+    }
+
+    void U32LE(uint32_t value) {
+        for (uint32_t i = 0; i < 4; i++) {
+            U8(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    void F32(float value) { U32LE(tint::Bitcast<uint32_t>(value)); }
+
+    void String(std::string_view str) {
+        Varint(str.size());
+        for (char c : str) {
+            U8(static_cast<uint8_t>(c));
+        }
+    }
+
+    template <typename T>
+    void Enum(T value) {
+        U8(static_cast<uint8_t>(value));
+    }
+
+    void Append(const Writer& other) {
+        bytes_.Reserve(bytes_.Length() + other.bytes_.Length());
+        for (auto b : other.bytes_) {
+            bytes_.Push(b);
+        }
+    }
+
+    Vector<std::byte, 0>& Bytes() { return bytes_; }
+
+  private:
+    Vector<std::byte, 0> bytes_;
+};
+
+struct FlatEncoder {
+    const Module& mod_in_;
+
+    /// The definition stream, holding types, constants and values in dependency order.
+    Writer defs_{};
+    /// The function records.
+    Writer functions_out_{};
+    /// The block records.
+    Writer blocks_out_{};
+
+    Hashmap<const core::ir::Function*, uint32_t, 32> functions_{};
+    Hashmap<const core::ir::Block*, uint32_t, 32> blocks_{};
+    Hashmap<const core::type::Type*, uint32_t, 32> types_{};
+    Hashmap<const core::ir::Value*, uint32_t, 32> values_{};
+    Hashmap<const core::constant::Value*, uint32_t, 32> constant_values_{};
+
+    /// The blocks in id order. Blocks are assigned an id when first referenced, and their records
+    /// are written in id order once all the functions have been written.
+    Vector<const ir::Block*, 32> block_order_{};
+
+    uint32_t num_types_ = 0;
+    uint32_t num_constants_ = 0;
+    uint32_t num_values_ = 0;
+
+    std::stringstream err_{};
+
+    Result<Vector<std::byte, 0>> Encode() {
+        // Encode all user-declared structures first. This is to ensure that the IR disassembly
+        // (which prints structure types first) does not reorder after encoding and decoding.
+        for (auto* ty : mod_in_.Types()) {
+            if (auto* str = ty->As<core::type::Struct>()) {
+                Type(str);
+            }
+        }
+        for (size_t i = 0, n = mod_in_.functions.Length(); i < n; i++) {
+            functions_.Add(mod_in_.functions[i], static_cast<uint32_t>(i));
+        }
+        Block(mod_in_.root_block);  // Always block 0.
+        for (auto& fn_in : mod_in_.functions) {
+            WriteFunction(fn_in);
+        }
+        for (size_t i = 0; i < block_order_.Length(); i++) {
+            WriteBlock(block_order_[i]);
+        }
+
+        auto err = err_.str();
+        if (!err.empty()) {
+            return Failure{err};
+        }
+
+        Writer out;
+        out.U32LE(flat::kMagic);
+        out.Varint(flat::kVersion);
+        out.Varint(num_types_);
+        out.Varint(num_constants_);
+        out.Varint(num_values_);
+        out.Varint(mod_in_.functions.Length());
+        out.Varint(block_order_.Length());
+        for (auto* block : block_order_) {
+            out.U8(block->Is<ir::MultiInBlock>() ? 1 : 0);
+        }
+        out.Append(defs_);
+        out.Append(functions_out_);
+        out.Append(blocks_out_);
+        return std::move(out.Bytes());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void WriteFunction(const ir::Function* fn_in) {
+        // Resolve all the referenced definitions before writing the record.
+        auto return_type = Type(fn_in->ReturnType());
+        uint8_t flags = 0;
+        uint32_t wg_size[3] = {};
+        if (auto wg_size_in = fn_in->WorkgroupSize()) {
+            flags |= flat::kFnWorkgroupSize;
+            for (size_t i = 0; i < 3; i++) {
+                wg_size[i] = Value((*wg_size_in)[i]);
+            }
+        }
+        uint32_t subgroup_size = 0;
+        if (auto subgroup_size_in = fn_in->SubgroupSize()) {
+            flags |= flat::kFnSubgroupSize;
+            subgroup_size = Value(*subgroup_size_in);
+        }
+        Vector<uint32_t, 8> params;
+        for (auto* param_in : fn_in->Params()) {
+            params.Push(Value(param_in));
+        }
+        auto ret_location = fn_in->ReturnLocation();
+        auto ret_interpolation = fn_in->ReturnInterpolation();
+        auto ret_builtin = fn_in->ReturnBuiltin();
+        flags |= ret_location ? flat::kFnReturnLocation : 0;
+        flags |= ret_interpolation ? flat::kFnReturnInterpolation : 0;
+        flags |= ret_builtin ? flat::kFnReturnBuiltin : 0;
+        flags |= fn_in->ReturnInvariant() ? flat::kFnReturnInvariant : 0;
+
+        auto& out = functions_out_;
+        auto name = mod_in_.NameOf(fn_in);
+        out.String(name ? name.NameView() : std::string_view{});
+        out.Varint(return_type);
+        out.Enum(fn_in->Stage());
+        out.U8(flags);
+        if (flags & flat::kFnWorkgroupSize) {
+            for (auto id : wg_size) {
+                out.Varint(id);
+            }
+        }
+        if (flags & flat::kFnSubgroupSize) {
+            out.Varint(subgroup_size);
+        }
+        out.Varint(params.Length());
+        for (auto id : params) {
+            out.Varint(id);
+        }
+        if (ret_location) {
+            out.Varint(*ret_location);
+        }
+        if (ret_interpolation) {
+            Interpolation(out, *ret_interpolation);
+        }
+        if (ret_builtin) {
+            out.Enum(*ret_builtin);
+        }
+        out.Varint(Block(fn_in->Block()));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Blocks
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Block(const ir::Block* block_in) {
+        TINT_ASSERT(block_in != nullptr);
+        return blocks_.GetOrAdd(block_in, [&] {
+            auto id = static_cast<uint32_t>(block_order_.Length());
+            block_order_.Push(block_in);
+            return id;
+        });
+    }
+
+    void WriteBlock(const ir::Block* block_in) {
+        // Instructions are written to a scratch buffer, as writing an instruction may append new
+        // definitions, and all definitions must precede their uses.
+        Writer out;
+        if (auto* mib = block_in->As<ir::MultiInBlock>()) {
+            out.Varint(mib->Params().Length());
+            for (auto* param : mib->Params()) {
+                out.Varint(Value(param));
+            }
+        }
+        out.Varint(block_in->Length());
+        for (auto* inst : *block_in) {
+            Instruction(out, inst);
+        }
+        blocks_out_.Append(out);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Instructions
+    ////////////////////////////////////////////////////////////////////////////
+    void Instruction(Writer& out, const ir::Instruction* inst_in) {
+        tint::Switch(
+            inst_in,  //
+            [&](const ir::Access*) { out.Enum(flat::InstructionKind::kAccess); },
+            [&](const ir::BreakIf* i) {
+                out.Enum(flat::InstructionKind::kBreakIf);
+                out.Varint(i->NextIterValues().size());
+            },
+            [&](const ir::CoreBinary* i) {
+                out.Enum(flat::InstructionKind::kCoreBinary);
+                out.Enum(i->Op());
+            },
+            [&](const ir::CoreBuiltinCall* i) { InstructionBuiltinCall(out, i); },
+            [&](const ir::CoreUnary* i) {
+                out.Enum(flat::InstructionKind::kCoreUnary);
+                out.Enum(i->Op());
+            },
+            [&](const ir::ConstExprIf* i) {
+                out.Enum(flat::InstructionKind::kConstExprIf);
+                InstructionIfBlocks(out, i->True(), i->False());
+            },
+            [&](const ir::Construct*) { out.Enum(flat::InstructionKind::kConstruct); },
+            [&](const ir::Continue*) { out.Enum(flat::InstructionKind::kContinue); },
+            [&](const ir::Convert*) { out.Enum(flat::InstructionKind::kConvert); },
+            [&](const ir::Discard*) { out.Enum(flat::InstructionKind::kDiscard); },
+            [&](const ir::ExitIf*) { out.Enum(flat::InstructionKind::kExitIf); },
+            [&](const ir::ExitLoop*) { out.Enum(flat::InstructionKind::kExitLoop); },
+            [&](const ir::ExitSwitch*) { out.Enum(flat::InstructionKind::kExitSwitch); },
+            [&](const ir::If* i) {
+                out.Enum(flat::InstructionKind::kIf);
+                InstructionIfBlocks(out, i->True(), i->False());
+            },
+            [&](const ir::Let*) { out.Enum(flat::InstructionKind::kLet); },
+            [&](const ir::Load*) { out.Enum(flat::InstructionKind::kLoad); },
+            [&](const ir::LoadVectorElement*) {
+                out.Enum(flat::InstructionKind::kLoadVectorElement);
+            },
+            [&](const ir::Loop* i) { InstructionLoop(out, i); },
+            [&](const ir::NextIteration*) { out.Enum(flat::InstructionKind::kNextIteration); },
+            [&](const ir::Override* i) {
+                out.Enum(flat::InstructionKind::kOverride);
+                auto id = i->OverrideId();
+                out.U8(id ? flat::kInstOverrideId : 0);
+                if (id) {
+                    out.Varint(id->value);
+                }
+            },
+            [&](const ir::Return*) { out.Enum(flat::InstructionKind::kReturn); },
+            [&](const ir::Store*) { out.Enum(flat::InstructionKind::kStore); },
+            [&](const ir::StoreVectorElement*) {
+                out.Enum(flat::InstructionKind::kStoreVectorElement);
+            },
+            [&](const ir::Switch* i) { InstructionSwitch(out, i); },
+            [&](const ir::Swizzle* i) {
+                out.Enum(flat::InstructionKind::kSwizzle);
+                out.Varint(i->Indices().Length());
+                for (auto idx : i->Indices()) {
+                    out.Varint(idx);
+                }
+            },
+            [&](const ir::UserCall*) { out.Enum(flat::InstructionKind::kUserCall); },
+            [&](const ir::Var* i) { InstructionVar(out, i); },
+            [&](const ir::Unreachable*) { out.Enum(flat::InstructionKind::kUnreachable); },
+            TINT_ICE_ON_NO_MATCH);
+
+        out.Varint(inst_in->Operands().Length());
+        for (auto* operand : inst_in->Operands()) {
+            out.Varint(Value(operand));
+        }
+        out.Varint(inst_in->Results().Length());
+        for (auto* result : inst_in->Results()) {
+            out.Varint(Value(result));
+        }
+        // Alignment is biased by one, so that zero means 'no alignment'.
+        out.Varint(inst_in->Alignment() ? uint64_t{*inst_in->Alignment()} + 1 : 0);
+    }
+
+    void InstructionBuiltinCall(Writer& out, const ir::CoreBuiltinCall* call_in) {
+        if (call_in->Func() == core::BuiltinFn::kNone) {
+            TINT_ICE() << "invalid BuiltinFn: " << call_in->Func();
+        }
+        Vector<std::pair<flat::TemplateParamKind, uint32_t>, 2> params;
+        for (auto param : call_in->ExplicitTemplateParams()) {
+            if (std::holds_alternative<const core::type::Type*>(param)) {
+                params.Push({flat::TemplateParamKind::kType,
+                             Type(std::get<const core::type::Type*>(param))});
+            } else if (std::holds_alternative<core::Majorness>(param)) {
+                params.Push({flat::TemplateParamKind::kMajorness,
+                             static_cast<uint32_t>(std::get<core::Majorness>(param))});
+            } else {
+                TINT_ICE() << "invalid template parameter kind";
+            }
+        }
+        out.Enum(flat::InstructionKind::kCoreBuiltinCall);
+        out.Enum(call_in->Func());
+        out.Varint(params.Length());
+        for (auto& param : params) {
+            out.Enum(param.first);
+            out.Varint(param.second);
+        }
+    }
+
+    void InstructionIfBlocks(Writer& out, const ir::Block* true_in, const ir::Block* false_in) {
+        out.U8((true_in ? flat::kInstTrue : 0) | (false_in ? flat::kInstFalse : 0));
+        if (true_in) {
+            out.Varint(Block(true_in));
+        }
+        if (false_in) {
+            out.Varint(Block(false_in));
+        }
+    }
+
+    void InstructionLoop(Writer& out, const ir::Loop* loop_in) {
+        out.Enum(flat::InstructionKind::kLoop);
+        out.U8((loop_in->HasInitializer() ? flat::kInstInitializer : 0) |
+               (loop_in->HasContinuing() ? flat::kInstContinuing : 0));
+        if (loop_in->HasInitializer()) {
+            out.Varint(Block(loop_in->Initializer()));
+        }
+        out.Varint(Block(loop_in->Body()));
+        if (loop_in->HasContinuing()) {
+            out.Varint(Block(loop_in->Continuing()));
+        }
+    }
+
+    void InstructionSwitch(Writer& out, const ir::Switch* switch_in) {
+        // Resolve the case selector constants before writing the instruction.
+        Vector<Vector<uint32_t, 4>, 4> selectors;
+        for (auto& case_in : switch_in->Cases()) {
+            selectors.Emplace();
+            auto& case_selectors = selectors.Back();
+            for (auto& selector_in : case_in.selectors) {
+                if (!selector_in.IsDefault()) {
+                    case_selectors.Push(ConstantValue(selector_in.val->Value()));
+                }
+            }
+        }
+        out.Enum(flat::InstructionKind::kSwitch);
+        out.Varint(switch_in->Cases().Length());
+        for (size_t i = 0; i < switch_in->Cases().Length(); i++) {
+            auto& case_in = switch_in->Cases()[i];
+            out.Varint(Block(case_in.block));
+            bool is_default = false;
+            for (auto& selector_in : case_in.selectors) {
+                is_default |= selector_in.IsDefault();
+            }
+            out.U8(is_default ? 1 : 0);
+            out.Varint(selectors[i].Length());
+            for (auto id : selectors[i]) {
+                out.Varint(id);
+            }
+        }
+    }
+
+    void InstructionVar(Writer& out, const ir::Var* var_in) {
+        auto bp = var_in->BindingPoint();
+        auto input_attachment_index = var_in->InputAttachmentIndex();
+        out.Enum(flat::InstructionKind::kVar);
+        out.U8((bp ? flat::kInstBindingPoint : 0) |
+               (input_attachment_index ? flat::kInstInputAttachmentIndex : 0));
+        if (bp) {
+            out.Varint(bp->group);
+            out.Varint(bp->binding);
+        }
+        if (input_attachment_index) {
+            out.Varint(*input_attachment_index);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Type(const core::type::Type* type_in) {
+        TINT_ASSERT(type_in != nullptr);
+        return types_.GetOrAdd(type_in, [&]() -> uint32_t {
+            tint::Switch(
+                type_in,  //
+                [&](const core::type::Void*) { TypeDef(flat::TypeKind::kVoid); },
+                [&](const core::type::Bool*) { TypeDef(flat::TypeKind::kBool); },
+                [&](const core::type::I32*) { TypeDef(flat::TypeKind::kI32); },
+                [&](const core::type::U32*) { TypeDef(flat::TypeKind::kU32); },
+                [&](const core::type::F32*) { TypeDef(flat::TypeKind::kF32); },
+                [&](const core::type::F16*) { TypeDef(flat::TypeKind::kF16); },
+                [&](const core::type::U64*) { TypeDef(flat::TypeKind::kU64); },
+                [&](const core::type::I8*) { TypeDef(flat::TypeKind::kI8); },
+                [&](const core::type::U8*) { TypeDef(flat::TypeKind::kU8); },
+                [&](const core::type::Vector* v) {
+                    auto el = Type(v->Type());
+                    TypeDef(flat::TypeKind::kVector);
+                    defs_.Varint(v->Width());
+                    defs_.Varint(el);
+                },
+                [&](const core::type::Matrix* m) {
+                    auto el = Type(m->Type());
+                    TypeDef(flat::TypeKind::kMatrix);
+                    defs_.Varint(m->Columns());
+                    defs_.Varint(m->Rows());
+                    defs_.Varint(el);
+                },
+                [&](const core::type::Pointer* p) {
+                    auto store = Type(p->StoreType());
+                    TypeDef(flat::TypeKind::kPointer);
+                    defs_.Enum(p->AddressSpace());
+                    defs_.Varint(store);
+                    defs_.Enum(p->Access());
+                },
+                [&](const core::type::Struct* s) { TypeStruct(s); },
+                [&](const core::type::Atomic* a) {
+                    auto el = Type(a->Type());
+                    TypeDef(flat::TypeKind::kAtomic);
+                    defs_.Varint(el);
+                },
+                [&](const core::type::Array* a) { TypeArray(a); },
+                [&](const core::type::BindingArray* a) { TypeBindingArray(a); },
+                [&](const core::type::DepthTexture* t) {
+                    TypeDef(flat::TypeKind::kDepthTexture);
+                    defs_.Enum(t->Dim());
+                },
+                [&](const core::type::SampledTexture* t) {
+                    auto sub_type = Type(t->Type());
+                    TypeDef(flat::TypeKind::kSampledTexture);
+                    defs_.Enum(t->Dim());
+                    defs_.Varint(sub_type);
+                },
+                [&](const core::type::MultisampledTexture* t) {
+                    auto sub_type = Type(t->Type());
+                    TypeDef(flat::TypeKind::kMultisampledTexture);
+                    defs_.Enum(t->Dim());
+                    defs_.Varint(sub_type);
+                },
+                [&](const core::type::DepthMultisampledTexture* t) {
+                    TypeDef(flat::TypeKind::kDepthMultisampledTexture);
+                    defs_.Enum(t->Dim());
+                },
+                [&](const core::type::StorageTexture* t) {
+                    TypeDef(flat::TypeKind::kStorageTexture);
+                    defs_.Enum(t->Dim());
+                    defs_.Enum(t->TexelFormat());
+                    defs_.Enum(t->Access());
+                },
+                [&](const core::type::TexelBuffer* t) {
+                    TypeDef(flat::TypeKind::kTexelBuffer);
+                    defs_.Enum(t->TexelFormat());
+                    defs_.Enum(t->Access());
+                },
+                [&](const core::type::ExternalTexture*) {
+                    TypeDef(flat::TypeKind::kExternalTexture);
+                },
+                [&](const core::type::Sampler* s) {
+                    TypeDef(flat::TypeKind::kSampler);
+                    defs_.Enum(s->Kind());
+                },
+                [&](const core::type::InputAttachment* i) {
+                    auto sub_type = Type(i->Type());
+                    TypeDef(flat::TypeKind::kInputAttachment);
+                    defs_.Varint(sub_type);
+                },
+                [&](const core::type::SubgroupMatrix* s) {
+                    auto sub_type = Type(s->Type());
+                    TypeDef(flat::TypeKind::kSubgroupMatrix);
+                    defs_.Enum(s->Kind());
+                    defs_.Varint(sub_type);
+                    defs_.Varint(s->Columns());
+                    defs_.Varint(s->Rows());
+                },
+                [&](const core::type::Buffer* b) { TypeBuffer(b); },
+                TINT_ICE_ON_NO_MATCH);
+            return num_types_++;
+        });
+    }
+
+    void TypeDef(flat::TypeKind kind) {
+        defs_.Enum(flat::DefKind::kType);
+        defs_.Enum(kind);
+    }
+
+    void TypeStruct(const core::type::Struct* struct_in) {
+        Vector<uint32_t, 8> member_types;
+        for (auto* member_in : struct_in->Members()) {
+            member_types.Push(Type(member_in->Type()));
+        }
+        TypeDef(flat::TypeKind::kStruct);
+        defs_.String(struct_in->Name().NameView());
+        defs_.Varint(struct_in->Members().Length());
+        for (size_t i = 0; i < member_types.Length(); i++) {
+            auto* member_in = struct_in->Members()[i];
+            defs_.String(member_in->Name().NameView());
+            defs_.Varint(member_types[i]);
+            defs_.Varint(member_in->Size());
+            defs_.Varint(member_in->Align());
+
+            auto& attrs_in = member_in->Attributes();
+            uint8_t flags = 0;
+            flags |= attrs_in.location ? flat::kAttrLocation : 0;
+            flags |= attrs_in.blend_src ? flat::kAttrBlendSrc : 0;
+            flags |= attrs_in.color ? flat::kAttrColor : 0;
+            flags |= attrs_in.builtin ? flat::kAttrBuiltin : 0;
+            flags |= attrs_in.interpolation ? flat::kAttrInterpolation : 0;
+            flags |= attrs_in.invariant ? flat::kAttrInvariant : 0;
+            defs_.U8(flags);
+            if (attrs_in.location) {
+                defs_.Varint(*attrs_in.location);
+            }
+            if (attrs_in.blend_src) {
+                defs_.Varint(*attrs_in.blend_src);
+            }
+            if (attrs_in.color) {
+                defs_.Varint(*attrs_in.color);
+            }
+            if (attrs_in.builtin) {
+                defs_.Enum(*attrs_in.builtin);
+            }
+            if (attrs_in.interpolation) {
+                Interpolation(defs_, *attrs_in.interpolation);
+            }
+        }
+    }
+
+    void TypeArray(const core::type::Array* array_in) {
+        auto element = Type(array_in->ElemType());
+        auto [kind, count] = Count(array_in->Count(), "array count");
+        TypeDef(flat::TypeKind::kArray);
+        defs_.Varint(element);
+        defs_.Enum(kind);
+        defs_.Varint(count);
+    }
+
+    void TypeBindingArray(const core::type::BindingArray* array_in) {
+        auto element = Type(array_in->ElemType());
+        auto [kind, count] = Count(array_in->Count(), "binding_array count");
+        if (kind != flat::CountKind::kConstant) {
+            TINT_ICE() << "binding_array count must be a constant";
+        }
+        TypeDef(flat::TypeKind::kBindingArray);
+        defs_.Varint(element);
+        defs_.Varint(count);
+    }
+
+    void TypeBuffer(const core::type::Buffer* buffer_in) {
+        auto [kind, size] = Count(buffer_in->Count(), "buffer size");
+        TypeDef(flat::TypeKind::kBuffer);
+        defs_.Enum(kind);
+        defs_.Varint(size);
+    }
+
+    /// @returns the kind and encoded value of the array count @p count_in. For override counts,
+    /// the value is the value id of the count expression.
+    std::pair<flat::CountKind, uint32_t> Count(const core::type::ArrayCount* count_in,
+                                               const char* what) {
+        std::pair<flat::CountKind, uint32_t> out{};
+        tint::Switch(
+            count_in,  //
+            [&](const core::type::ConstantArrayCount* c) {
+                if (c->value >= internal_limits::kMaxArrayElementCount) {
+                    err_ << what << " (" << c->value << ") must be less than "
+                         << internal_limits::kMaxArrayElementCount << "\n";
+                }
+                out = {flat::CountKind::kConstant, c->value};
+            },
+            [&](const core::type::RuntimeArrayCount*) {
+                out = {flat::CountKind::kRuntime, 0u};
+            },
+            [&](const core::ir::type::ValueArrayCount* c) {
+                out = {flat::CountKind::kOverride, Value(c->value)};
+            },
+            TINT_ICE_ON_NO_MATCH);
+        return out;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Values
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Value(const ir::Value* value_in) {
+        if (!value_in) {
+            return 0;
+        }
+        return values_.GetOrAdd(value_in, [&] {
+            tint::Switch(
+                value_in,
+                [&](const ir::InstructionResult* v) {
+                    auto type = Type(v->Type());
+                    ValueDef(flat::ValueKind::kInstructionResult);
+                    defs_.Varint(type);
+                    Name(v);
+                },
+                [&](const ir::FunctionParam* v) { FunctionParameter(v); },
+                [&](const ir::BlockParam* v) {
+                    auto type = Type(v->Type());
+                    ValueDef(flat::ValueKind::kBlockParam);
+                    defs_.Varint(type);
+                    Name(v);
+                },
+                [&](const ir::Function* v) {
+                    ValueDef(flat::ValueKind::kFunction);
+                    defs_.Varint(*functions_.Get(v));
+                },
+                [&](const ir::Constant* v) {
+                    auto constant = ConstantValue(v->Value());
+                    ValueDef(flat::ValueKind::kConstant);
+                    defs_.Varint(constant);
+                },
+                TINT_ICE_ON_NO_MATCH);
+            return ++num_values_;
+        });
+    }
+
+    void ValueDef(flat::ValueKind kind) {
+        defs_.Enum(flat::DefKind::kValue);
+        defs_.Enum(kind);
+    }
+
+    void Name(const ir::Value* value_in) {
+        auto name = mod_in_.NameOf(value_in);
+        defs_.String(name.IsValid() ? name.NameView() : std::string_view{});
+    }
+
+    void FunctionParameter(const ir::FunctionParam* param_in) {
+        auto type = Type(param_in->Type());
+        ValueDef(flat::ValueKind::kFunctionParam);
+        defs_.Varint(type);
+        Name(param_in);
+
+        auto bp = param_in->BindingPoint();
+        auto location = param_in->Location();
+        auto color = param_in->Color();
+        auto interpolation = param_in->Interpolation();
+        auto builtin = param_in->Builtin();
+        uint8_t flags = 0;
+        flags |= bp ? flat::kAttrBindingPoint : 0;
+        flags |= location ? flat::kAttrLocation : 0;
+        flags |= color ? flat::kAttrColor : 0;
+        flags |= interpolation ? flat::kAttrInterpolation : 0;
+        flags |= builtin ? flat::kAttrBuiltin : 0;
+        flags |= param_in->Invariant() ? flat::kAttrInvariant : 0;
+        defs_.U8(flags);
+        if (bp) {
+            defs_.Varint(bp->group);
+            defs_.Varint(bp->binding);
+        }
+        if (location) {
+            defs_.Varint(*location);
+        }
+        if (color) {
+            defs_.Varint(*color);
+        }
+        if (interpolation) {
+            Interpolation(defs_, *interpolation);
+        }
+        if (builtin) {
+            defs_.Enum(*builtin);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // ConstantValues
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t ConstantValue(const core::constant::Value* constant_in) {
+        TINT_ASSERT(constant_in != nullptr);
+        return constant_values_.GetOrAdd(constant_in, [&] {
+            tint::Switch(
+                constant_in,  //
+                [&](const core::constant::Scalar<bool>* b) {
+                    ConstantDef(flat::ConstantKind::kBool);
+                    defs_.U8(b->value ? 1 : 0);
+                },
+                [&](const core::constant::Scalar<core::i32>* i32) {
+                    ConstantDef(flat::ConstantKind::kI32);
+                    defs_.Zigzag(i32->value);
+                },
+                [&](const core::constant::Scalar<core::u32>* u32) {
+                    ConstantDef(flat::ConstantKind::kU32);
+                    defs_.Varint(u32->value);
+                },
+                [&](const core::constant::Scalar<core::f32>* f32) {
+                    ConstantDef(flat::ConstantKind::kF32);
+                    defs_.F32(f32->value);
+                },
+                [&](const core::constant::Scalar<core::f16>* f16) {
+                    ConstantDef(flat::ConstantKind::kF16);
+                    defs_.F32(f16->value);
+                },
+                [&](const core::constant::Composite* composite) {
+                    auto type = Type(composite->type);
+                    Vector<uint32_t, 8> elements;
+                    for (auto* el : composite->elements) {
+                        elements.Push(ConstantValue(el));
+                    }
+                    ConstantDef(flat::ConstantKind::kComposite);
+                    defs_.Varint(type);
+                    defs_.Varint(elements.Length());
+                    for (auto id : elements) {
+                        defs_.Varint(id);
+                    }
+                },
+                [&](const core::constant::Splat* splat) {
+                    if (DAWN_UNLIKELY(splat->count >
+                                      internal_limits::kMaxArrayConstructorElements)) {
+                        err_ << "array constructor has excessive number of elements (>"
+                             << internal_limits::kMaxArrayConstructorElements << ")\n";
+                    }
+                    auto type = Type(splat->type);
+                    auto element = ConstantValue(splat->el);
+                    ConstantDef(flat::ConstantKind::kSplat);
+                    defs_.Varint(type);
+                    defs_.Varint(element);
+                },
+                TINT_ICE_ON_NO_MATCH);
+            return num_constants_++;
+        });
+    }
+
+    void ConstantDef(flat::ConstantKind kind) {
+        defs_.Enum(flat::DefKind::kConstant);
+        defs_.Enum(kind);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Attributes
+    ////////////////////////////////////////////////////////////////////////////
+    void Interpolation(Writer& out, const core::Interpolation& interpolation_in) {
+        out.Enum(interpolation_in.type);
+        out.Enum(interpolation_in.sampling);
+    }
+};
+
+}  // namespace
+
+Result<Vector<std::byte, 0>> EncodeToFlatBinary(const Module& mod_in) {
+    return FlatEncoder{mod_in}.Encode();
+}
+
+}  // namespace tint::core::ir::binary
@@ -0,0 +1,201 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_BINARY_FLAT_H_
+#define SRC_TINT_LANG_CORE_IR_BINARY_FLAT_H_
+
+#include <cstdint>
+
+// The flat IR binary format.
+//
+// Unlike the protobuf format, the flat format is designed to be decoded in a single forward pass
+// over a contiguous (possibly memory-mapped) span of bytes, without building any intermediate
+// representation. Enums are stored as their raw core values, so the format is only stable for a
+// given Tint revision and is intended for caching, not for interchange.
+//
+// All integers are unsigned LEB128 varints unless otherwise noted. Signed integers are zig-zag
+// encoded. Floats are stored as their 4-byte little-endian bit pattern. Strings are a varint byte
+// length followed by the UTF-8 bytes.
+//
+//   module     := magic:u32le version num_types num_constants num_values num_functions
+//                 num_blocks block_kind:u8[num_blocks] def[num_types+num_constants+num_values]
+//                 function[num_functions] block[num_blocks]
+//   def        := DefKind payload
+//
+// Definitions are emitted in dependency order: every type, constant or value only refers to
+// definitions that precede it, so each table can be filled as the stream is read. Functions and
+// blocks are declared up front so that definitions and instructions may refer to them by index.
+// Block 0 is always the module's root block. Value id 0 is reserved for 'null'; all other value
+// ids are one-based.
+
+namespace tint::core::ir::binary::flat {
+
+/// The magic number at the start of a flat encoded module ('TIRF' in little-endian).
+static constexpr uint32_t kMagic = 0x46524954;
+
+/// The version of the flat format. Must be incremented whenever the layout, or the numbering of
+/// any of the encoded enums changes.
+static constexpr uint32_t kVersion = 1;
+
+/// The kind of a definition in the definition stream.
+enum class DefKind : uint8_t {
+    kType,
+    kConstant,
+    kValue,
+};
+
+/// The kind of a type definition.
+enum class TypeKind : uint8_t {
+    kVoid,
+    kBool,
+    kI32,
+    kU32,
+    kF32,
+    kF16,
+    kU64,
+    kI8,
+    kU8,
+    kVector,
+    kMatrix,
+    kPointer,
+    kStruct,
+    kAtomic,
+    kArray,
+    kBindingArray,
+    kDepthTexture,
+    kSampledTexture,
+    kMultisampledTexture,
+    kDepthMultisampledTexture,
+    kStorageTexture,
+    kTexelBuffer,
+    kExternalTexture,
+    kSampler,
+    kInputAttachment,
+    kSubgroupMatrix,
+    kBuffer,
+};
+
+/// The kind of an array count or buffer size.
+enum class CountKind : uint8_t {
+    kConstant,
+    kRuntime,
+    kOverride,
+};
+
+/// The kind of a constant value definition.
+enum class ConstantKind : uint8_t {
+    kBool,
+    kI32,
+    kU32,
+    kF32,
+    kF16,
+    kComposite,
+    kSplat,
+};
+
+/// The kind of a value definition.
+enum class ValueKind : uint8_t {
+    kInstructionResult,
+    kFunctionParam,
+    kBlockParam,
+    kFunction,
+    kConstant,
+};
+
+/// The kind of an instruction.
+enum class InstructionKind : uint8_t {
+    kAccess,
+    kBreakIf,
+    kCoreBinary,
+    kCoreBuiltinCall,
+    kCoreUnary,
+    kConstExprIf,
+    kConstruct,
+    kContinue,
+    kConvert,
+    kDiscard,
+    kExitIf,
+    kExitLoop,
+    kExitSwitch,
+    kIf,
+    kLet,
+    kLoad,
+    kLoadVectorElement,
+    kLoop,
+    kNextIteration,
+    kOverride,
+    kReturn,
+    kStore,
+    kStoreVectorElement,
+    kSwitch,
+    kSwizzle,
+    kUserCall,
+    kVar,
+    kUnreachable,
+};
+
+/// The kind of an explicit builtin call template parameter.
+enum class TemplateParamKind : uint8_t {
+    kType,
+    kMajorness,
+};
+
+/// Bit flags for the optional attributes of struct members and function parameters.
+enum AttributeFlags : uint8_t {
+    kAttrLocation = 1 << 0,
+    kAttrBlendSrc = 1 << 1,
+    kAttrColor = 1 << 2,
+    kAttrBuiltin = 1 << 3,
+    kAttrInterpolation = 1 << 4,
+    kAttrInvariant = 1 << 5,
+    kAttrBindingPoint = 1 << 6,
+};
+
+/// Bit flags for the optional fields of a function.
+enum FunctionFlags : uint8_t {
+    kFnWorkgroupSize = 1 << 0,
+    kFnSubgroupSize = 1 << 1,
+    kFnReturnLocation = 1 << 2,
+    kFnReturnInterpolation = 1 << 3,
+    kFnReturnBuiltin = 1 << 4,
+    kFnReturnInvariant = 1 << 5,
+};
+
+/// Bit flags for the optional blocks and fields of instructions.
+enum InstructionFlags : uint8_t {
+    kInstTrue = 1 << 0,
+    kInstFalse = 1 << 1,
+    kInstInitializer = 1 << 2,
+    kInstContinuing = 1 << 3,
+    kInstOverrideId = 1 << 4,
+    kInstBindingPoint = 1 << 5,
+    kInstInputAttachmentIndex = 1 << 6,
+};
+
+}  // namespace tint::core::ir::binary::flat
+
+#endif  // SRC_TINT_LANG_CORE_IR_BINARY_FLAT_H_
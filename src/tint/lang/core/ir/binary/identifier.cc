@@ -0,0 +1,85 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/binary/identifier.h"
+
+#include "src/tint/lang/core/enums.h"
+#include "src/tint/utils/text/unicode.h"
+#include "src/utils/compiler.h"
+
+namespace tint::core::ir::binary {
+
+std::string_view CheckIdentifier(std::string_view name) {
+    if (DAWN_UNLIKELY(name.find('\0') != std::string_view::npos)) {
+        return "contains '\\0' before end of the string";
+    }
+
+    // Reject excessively long names as they cause problems in some backends.
+    if (DAWN_UNLIKELY(name.length() > 16384)) {
+        return "is longer than 16384 characters";
+    }
+
+    if (DAWN_UNLIKELY(!tint::utf8::IsWGSLIdentifier(name))) {
+        // Check if this is an internal frexp or modf result identifier.
+        switch (core::ParseBuiltinType(name)) {
+            case core::BuiltinType::kAtomicCompareExchangeResultI32:
+            case core::BuiltinType::kAtomicCompareExchangeResultU32:
+            case core::BuiltinType::kFrexpResultAbstract:
+            case core::BuiltinType::kFrexpResultF16:
+            case core::BuiltinType::kFrexpResultF32:
+            case core::BuiltinType::kFrexpResultVec2Abstract:
+            case core::BuiltinType::kFrexpResultVec2F16:
+            case core::BuiltinType::kFrexpResultVec2F32:
+            case core::BuiltinType::kFrexpResultVec3Abstract:
+            case core::BuiltinType::kFrexpResultVec3F16:
+            case core::BuiltinType::kFrexpResultVec3F32:
+            case core::BuiltinType::kFrexpResultVec4Abstract:
+            case core::BuiltinType::kFrexpResultVec4F16:
+            case core::BuiltinType::kFrexpResultVec4F32:
+            case core::BuiltinType::kModfResultAbstract:
+            case core::BuiltinType::kModfResultF16:
+            case core::BuiltinType::kModfResultF32:
+            case core::BuiltinType::kModfResultVec2Abstract:
+            case core::BuiltinType::kModfResultVec2F16:
+            case core::BuiltinType::kModfResultVec2F32:
+            case core::BuiltinType::kModfResultVec3Abstract:
+            case core::BuiltinType::kModfResultVec3F16:
+            case core::BuiltinType::kModfResultVec3F32:
+            case core::BuiltinType::kModfResultVec4Abstract:
+            case core::BuiltinType::kModfResultVec4F16:
+            case core::BuiltinType::kModfResultVec4F32:
+                return {};
+            default:
+                break;
+        }
+        return "is not a valid WGSL identifier";
+    }
+
+    return {};
+}
+
+}  // namespace tint::core::ir::binary
@@ -25,6 +25,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <string>
+
 #include "src/tint/cmd/fuzz/common/ir_fuzzer.h"
 #include "src/tint/lang/core/ir/binary/decode.h"
 #include "src/tint/lang/core/ir/binary/encode.h"
@@ -33,6 +35,19 @@
 namespace tint::core::ir::binary {
 namespace {
 
+void CheckRoundtrip(const std::string& in, const std::string& out) {
+    TINT_ASSERT(in == out) << "Roundtrip produced different disassembly\n"
+                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
+                           << "-=                     In                      =-\n"
+                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
+                           << in << "\n"
+                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
+                           << "-=                     Out                     =-\n"
+                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
+                           << out << "\n"
+                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n";
+}
+
 Result<SuccessType> IRBinaryRoundtripFuzzer(core::ir::Module& module, const fuzz::ir::Context&) {
     auto encoded = EncodeToBinary(module);
     if (encoded != Success) {
@@ -48,16 +63,18 @@ Result<SuccessType> IRBinaryRoundtripFuzzer(core::ir::Module& module, const fuzz
 
     auto in = Disassembler(module).Plain();
     auto out = Disassembler(decoded.Get()).Plain();
-    TINT_ASSERT(in == out) << "Roundtrip produced different disassembly\n"
-                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
-                           << "-=                     In                      =-\n"
-                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
-                           << in << "\n"
-                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
-                           << "-=                     Out                     =-\n"
-                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n"
-                           << out << "\n"
-                           << "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-\n";
+    CheckRoundtrip(in, out);
+
+    // The flat encoding shares the internal limits of the protobuf encoding, so must succeed.
+    auto flat_encoded = EncodeToFlatBinary(module);
+    TINT_ASSERT(flat_encoded == Success) << "EncodeToFlatBinary() failed\n"
+                                         << flat_encoded.Failure();
+
+    auto flat_decoded = DecodeFlatBinary(flat_encoded->AsSpan());
+    TINT_ASSERT(flat_decoded == Success) << "DecodeFlatBinary() failed\n"
+                                         << flat_decoded.Failure();
+
+    CheckRoundtrip(in, Disassembler(flat_decoded.Get()).Plain());
     return Success;
 }
 
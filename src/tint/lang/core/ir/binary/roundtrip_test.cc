@@ -61,13 +61,29 @@ class IRBinaryRoundtripTestBase : public IRTestParamHelper<T> {
         auto post = Disassembler(decoded.Get()).Plain();
         return {pre, post};
     }
+
+    std::pair<std::string, std::string> RoundtripFlat() {
+        auto pre = Disassembler(this->mod).Plain();
+        auto encoded = EncodeToFlatBinary(this->mod);
+        if (encoded != Success) {
+            return {pre, encoded.Failure().reason};
+        }
+        auto decoded = DecodeFlatBinary(encoded->AsSpan());
+        if (decoded != Success) {
+            return {pre, decoded.Failure().reason};
+        }
+        auto post = Disassembler(decoded.Get()).Plain();
+        return {pre, post};
+    }
 };
 
-#define RUN_TEST()                      \
-    {                                   \
-        auto [pre, post] = Roundtrip(); \
-        EXPECT_EQ(pre, post);           \
-    }                                   \
+#define RUN_TEST()                                    \
+    {                                                 \
+        auto [pre, post] = Roundtrip();               \
+        EXPECT_EQ(pre, post);                         \
+        auto [flat_pre, flat_post] = RoundtripFlat(); \
+        EXPECT_EQ(flat_pre, flat_post);               \
+    }                                                 \
     TINT_REQUIRE_SEMICOLON
 
 using IRBinaryRoundtripTest = IRBinaryRoundtripTestBase<>;
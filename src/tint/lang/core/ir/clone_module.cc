@@ -0,0 +1,144 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/clone_module.h"
+
+#include <utility>
+
+#include "src/tint/lang/core/constant/clone_context.h"
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/call.h"
+#include "src/tint/lang/core/ir/clone_context.h"
+#include "src/tint/lang/core/ir/switch.h"
+#include "src/tint/lang/core/type/clone_context.h"
+
+namespace tint::core::ir {
+
+Module CloneModule(Module& src) {
+    Module dst;
+    dst.properties = src.properties;
+    dst.enable_validation_asserts = src.enable_validation_asserts;
+    dst.dump_ir_when_validating = src.dump_ir_when_validating;
+    dst.ice_callback = src.ice_callback;
+
+    Builder b{dst};
+    CloneContext ctx{dst};
+    core::type::CloneContext type_ctx{{&src.symbols}, {&dst.symbols, &dst.Types()}};
+    core::constant::CloneContext const_ctx{type_ctx, dst.constant_values};
+
+    Hashmap<const core::type::Type*, const core::type::Type*, 32> types;
+    auto clone_type = [&](const core::type::Type* ty) -> const core::type::Type* {
+        if (!ty) {
+            return nullptr;
+        }
+        return types.GetOrAdd(ty, [&] { return ty->Clone(type_ctx); });
+    };
+
+    // Instruction and value cloning shares constants between the source and destination. Register
+    // a replacement for each constant referenced by the source module, so that the clone only
+    // references constants held by the destination module.
+    auto clone_constant = [&](Value* value) {
+        if (auto* constant = value ? value->As<Constant>() : nullptr) {
+            if (ctx.Remap(constant) == constant) {
+                ctx.Replace(constant, b.Constant(constant->Value()->Clone(const_ctx)));
+            }
+        }
+    };
+    for (auto* inst : src.Instructions()) {
+        for (auto* operand : inst->Operands()) {
+            clone_constant(operand);
+        }
+        if (auto* swtch = inst->As<Switch>()) {
+            for (auto& c : swtch->Cases()) {
+                for (auto& selector : c.selectors) {
+                    clone_constant(selector.val);
+                }
+            }
+        }
+    }
+    for (auto* func : src.functions) {
+        if (auto wg_size = func->WorkgroupSize()) {
+            for (auto* value : *wg_size) {
+                clone_constant(value);
+            }
+        }
+    }
+
+    // Clone the module-scope instructions, then the functions in dependency order, so that callees
+    // have been cloned before the calls to them.
+    src.root_block->CloneInto(ctx, dst.root_block);
+    for (auto* func : src.DependencyOrderedFunctions()) {
+        auto* new_func = ctx.Clone(func);
+        if (auto wg_size = func->WorkgroupSize()) {
+            new_func->SetWorkgroupSize(ctx.Remap((*wg_size)[0]), ctx.Remap((*wg_size)[1]),
+                                       ctx.Remap((*wg_size)[2]));
+        }
+        new_func->SetReturnType(clone_type(func->ReturnType()));
+    }
+    for (auto* func : src.functions) {
+        dst.functions.Push(ctx.Remap(func));
+    }
+
+    // Transfer the names and sources of the cloned values.
+    for (auto* value : src.Values()) {
+        auto* new_value = ctx.Remap(value);
+        if (new_value == value) {
+            continue;
+        }
+        if (auto name = src.NameOf(value)) {
+            dst.SetName(new_value, name.NameView());
+        }
+        if (auto source = src.SourceOf(value); source.file || source.range != Source::Range{}) {
+            dst.SetSource(new_value, std::move(source));
+        }
+    }
+
+    // The cloned values and instructions still reference the types of the source module. Replace
+    // these with the equivalent types of the destination module.
+    for (auto* value : dst.Values()) {
+        if (!value->Is<Constant>()) {
+            value->SetType(clone_type(value->Type()));
+        }
+    }
+    for (auto* inst : dst.Instructions()) {
+        if (auto* call = inst->As<Call>(); call && !call->ExplicitTemplateParams().IsEmpty()) {
+            Vector<TemplateParameter, 1> params;
+            for (auto& param : call->ExplicitTemplateParams()) {
+                if (auto* ty = std::get_if<const core::type::Type*>(&param)) {
+                    params.Push(clone_type(*ty));
+                } else {
+                    params.Push(param);
+                }
+            }
+            call->SetExplicitTemplateParams(std::move(params));
+        }
+    }
+
+    return dst;
+}
+
+}  // namespace tint::core::ir
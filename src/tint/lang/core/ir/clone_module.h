@@ -0,0 +1,74 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_CLONE_MODULE_H_
+#define SRC_TINT_LANG_CORE_IR_CLONE_MODULE_H_
+
+#include <type_traits>
+
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/system/parallel.h"
+
+namespace tint::core::ir {
+
+/// CloneModule creates a deep copy of the module @p src.
+/// The returned module has its own types, constants, symbols, functions and instructions, and can
+/// be transformed independently of @p src, including on another thread.
+/// @p src is cloned with the non-const Clone() methods of its values and instructions, so it must
+/// not be used by another thread during the call.
+/// @param src the module to clone
+/// @returns the cloned module
+Module CloneModule(Module& src);
+
+/// GenerateForEachClone clones @p src once for each element of @p options, and then calls
+/// @p generate with each clone and its options on a thread pool.
+/// All the clones are made before the first call to @p generate, as @p generate may modify the
+/// module it is given.
+/// @param src the module to clone
+/// @param options the options for each call to @p generate
+/// @param generate the function to call with each cloned module and its options. Must be safe to
+/// call concurrently.
+/// @returns the result of each call to @p generate, in the same order as @p options
+template <typename OPTIONS, typename GENERATE>
+auto GenerateForEachClone(Module& src, VectorRef<OPTIONS> options, GENERATE&& generate) {
+    using ResultType = std::invoke_result_t<GENERATE&, Module&, const OPTIONS&>;
+
+    Vector<Module, 4> modules;
+    for (size_t i = 0; i < options.Length(); i++) {
+        modules.Push(CloneModule(src));
+    }
+
+    Vector<ResultType, 4> results;
+    results.Resize(options.Length());
+    ParallelFor(options.Length(), [&](size_t i) { results[i] = generate(modules[i], options[i]); });
+    return results;
+}
+
+}  // namespace tint::core::ir
+
+#endif  // SRC_TINT_LANG_CORE_IR_CLONE_MODULE_H_
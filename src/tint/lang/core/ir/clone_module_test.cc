@@ -0,0 +1,143 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/clone_module.h"
+
+#include <string>
+
+#include "src/tint/lang/core/ir/ir_helper_test.h"
+#include "src/tint/lang/core/ir/validator.h"
+#include "src/tint/lang/core/type/struct.h"
+
+namespace tint::core::ir {
+namespace {
+
+using namespace tint::core::fluent_types;     // NOLINT
+using namespace tint::core::number_suffixes;  // NOLINT
+
+using IR_CloneModuleTest = IRTestHelper;
+
+TEST_F(IR_CloneModuleTest, Empty) {
+    auto clone = CloneModule(mod);
+    EXPECT_EQ(Disassembler(clone).Plain(), Disassembler(mod).Plain());
+}
+
+TEST_F(IR_CloneModuleTest, Module) {
+    auto* str_ty = ty.Struct(mod.symbols.New("MyStruct"), {
+                                                              {mod.symbols.New("a"), ty.i32()},
+                                                              {mod.symbols.New("b"), ty.u32()},
+                                                          });
+    auto* buffer = b.Var("buffer", ty.ptr<storage>(str_ty));
+    buffer->SetBindingPoint(0, 1);
+    mod.root_block->Append(buffer);
+    auto* counter = b.Var<private_>("counter", 3_i);
+    mod.root_block->Append(counter);
+
+    auto* helper = b.Function("helper", ty.i32());
+    auto* param = b.FunctionParam("p", ty.i32());
+    helper->SetParams({param});
+    b.Append(helper->Block(), [&] {
+        auto* swtch = b.Switch(param);
+        b.Append(b.Case(swtch, {b.Constant(1_i), b.Constant(2_i)}), [&] { b.Return(helper, 4_i); });
+        b.Append(b.DefaultCase(swtch), [&] { b.ExitSwitch(swtch); });
+        b.Return(helper, b.Load(counter));
+    });
+
+    auto* ep = b.ComputeFunction("main", 8_u, 2_u, 1_u);
+    b.Append(ep->Block(), [&] {
+        auto* a = b.Load(b.Access(ty.ptr<storage, i32>(), buffer, 0_u));
+        auto* res = b.Call(helper, a);
+        b.Store(b.Access(ty.ptr<storage, i32>(), buffer, 0_u), res);
+        b.Return(ep);
+    });
+
+    auto expect = Disassembler(mod).Plain();
+
+    std::string got;
+    {
+        auto clone = CloneModule(mod);
+        ASSERT_EQ(Validate(clone), Success);
+        EXPECT_EQ(clone.functions.Length(), 2u);
+        EXPECT_EQ(clone.NameOf(clone.functions[0]).NameView(), "helper");
+        EXPECT_EQ(clone.functions[0]->ReturnType(), clone.Types().i32());
+        EXPECT_NE(clone.functions[0], helper);
+        auto wg_size = clone.functions[1]->WorkgroupSizeAsConst();
+        ASSERT_TRUE(wg_size.has_value());
+        EXPECT_EQ((*wg_size)[0], 8u);
+
+        // Destroy the source module, to check that the clone doesn't reference it.
+        mod = Module{};
+        got = Disassembler(clone).Plain();
+    }
+    EXPECT_EQ(got, expect);
+}
+
+TEST_F(IR_CloneModuleTest, SourceUnmodified) {
+    auto* ep = b.ComputeFunction("main");
+    b.Append(ep->Block(), [&] {
+        b.Let("x", 1_i);
+        b.Return(ep);
+    });
+
+    auto expect = str();
+
+    auto clone = CloneModule(mod);
+    Builder cb{clone};
+    auto* let = clone.functions[0]->Block()->Front();
+    cb.InsertBefore(let, [&] { cb.Let("y", 2_u); });
+    let->Destroy();
+
+    EXPECT_EQ(str(), expect);
+    EXPECT_NE(Disassembler(clone).Plain(), Disassembler(mod).Plain());
+}
+
+TEST_F(IR_CloneModuleTest, GenerateForEachClone) {
+    auto* ep = b.ComputeFunction("main");
+    b.Append(ep->Block(), [&] {
+        b.Let("x", 1_i);
+        b.Return(ep);
+    });
+
+    auto expect = str();
+
+    // Each call gets its own clone, so each can rename the function without affecting the others.
+    Vector<std::string, 4> names{"a", "b", "c", "d"};
+    auto results = GenerateForEachClone(
+        mod, VectorRef<std::string>{names}, [](Module& clone, const std::string& name) {
+            clone.SetName(clone.functions[0], name);
+            return Disassembler(clone).Plain();
+        });
+
+    ASSERT_EQ(results.Length(), names.Length());
+    for (size_t i = 0; i < names.Length(); i++) {
+        EXPECT_NE(results[i].find("%" + names[i] + " = @compute"), std::string::npos) << results[i];
+    }
+    EXPECT_EQ(str(), expect);
+}
+
+}  // namespace
+}  // namespace tint::core::ir
@@ -32,6 +32,7 @@
 #include <utility>
 
 #include "src/tint/lang/core/ir/control_instruction.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/user_call.h"
 #include "src/tint/utils/containers/unique_vector.h"
 #include "src/tint/utils/ice/ice.h"
@@ -191,4 +192,45 @@ void Module::Destroy(Function* func) {
     func->Destroy();
 }
 
+void Module::Compact() {
+    PassScope pass_scope(*this, "core.Compact");
+
+    // Detach the live objects that still point back to a destroyed owner.
+    for (auto* inst : allocators_.instructions.Objects()) {
+        if (auto* control = inst->As<ControlInstruction>(); control && !control->Alive()) {
+            control->ForeachBlock([&](ir::Block* blk) {
+                if (blk->Parent() == control) {
+                    blk->SetParent(nullptr);
+                }
+            });
+        }
+    }
+    for (auto* value : allocators_.values.Objects()) {
+        if (auto* func = value->As<Function>(); func && !func->Alive()) {
+            for (auto* param : func->Params()) {
+                if (param->Function() == func) {
+                    param->SetFunction(nullptr);
+                }
+            }
+        }
+    }
+
+    reclaimed_instructions_ +=
+        allocators_.instructions.Reclaim([](Instruction* inst) { return !inst->Alive(); });
+
+    reclaimed_values_ += allocators_.values.Reclaim([&](Value* value) {
+        if (value->Alive() || value->IsUsed()) {
+            return false;
+        }
+        value_to_name_.Remove(value);
+        value_to_source_.Remove(value);
+        if (auto* constant = value->As<Constant>()) {
+            if (constants.GetOr(constant->Value(), nullptr) == constant) {
+                constants.Remove(constant->Value());
+            }
+        }
+        return true;
+    });
+}
+
 }  // namespace tint::core::ir
@@ -44,6 +44,11 @@
 #include "src/tint/utils/memory/block_allocator.h"
 #include "src/tint/utils/symbol/symbol_table.h"
 
+// Forward declarations
+namespace tint::core::ir {
+class PassTimer;
+}
+
 namespace tint::core::ir {
 
 // Wrappers around the base TINT_ICE() macros that use the ice_callback attached to the module.
@@ -276,6 +281,24 @@ class Module {
         return {allocators_.values.Objects()};
     }
 
+    /// @returns the total number of instructions allocated by the module, including those that have
+    /// since been destroyed
+    size_t AllocatedInstructionCount() const {
+        return allocators_.instructions.Count() + reclaimed_instructions_;
+    }
+
+    /// @returns the total number of values allocated by the module, including those that have since
+    /// been destroyed
+    size_t AllocatedValueCount() const { return allocators_.values.Count() + reclaimed_values_; }
+
+    /// Frees the instructions and values that have been destroyed.
+    /// Destroyed objects are otherwise held by the module until it is destructed, and are skipped
+    /// over by every walk of Instructions() and Values(). The memory of the freed objects is reused
+    /// for newly created instructions and values.
+    /// @warning Compact() must only be called between transforms, as any pointer to a destroyed
+    /// instruction or value is left dangling. Destroyed values that are still used are kept.
+    void Compact();
+
     /// @returns the functions in the module, in dependency order
     Vector<Function*, 16> DependencyOrderedFunctions();
     /// @returns the functions in the module, in dependency order
@@ -312,6 +335,10 @@ class Module {
     /// If true, dump the IR whenever validation is performed.
     bool dump_ir_when_validating = false;
 
+    /// An optional timer that records the cost of each transform run on the module.
+    /// Not copied by CloneModule().
+    PassTimer* pass_timer = nullptr;
+
     /// An optional callback to receive an ICE generated while processing this module.
     InternalCompilerErrorCallback ice_callback;
 
@@ -329,6 +356,12 @@ class Module {
     } allocators_;
 
     Instruction::Id next_instruction_id_ = 0;
+
+    /// The number of instructions freed by Compact()
+    size_t reclaimed_instructions_ = 0;
+
+    /// The number of values freed by Compact()
+    size_t reclaimed_values_ = 0;
 };
 
 }  // namespace tint::core::ir
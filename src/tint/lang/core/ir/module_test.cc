@@ -27,10 +27,12 @@
 
 #include "src/tint/lang/core/ir/module.h"
 
+#include <cstdint>
 #include <string>
 
 #include "gmock/gmock.h"
 #include "src/tint/lang/core/ir/ir_helper_test.h"
+#include "src/tint/lang/core/ir/validator.h"
 #include "src/tint/lang/core/ir/var.h"
 
 using ::testing::ElementsAre;
@@ -105,6 +107,78 @@ TEST_F(IR_ModuleTest, DependencyOrderedFunctions) {
     EXPECT_THAT(const_mod.DependencyOrderedFunctions(), ElementsAre(fd, fc, fb, fa));
 }
 
+TEST_F(IR_ModuleTest, Compact) {
+    auto* func = b.Function("f", ty.i32());
+    auto* param = b.FunctionParam("p", ty.i32());
+    func->SetParams({param});
+    CoreBinary* dead_add = nullptr;
+    b.Append(func->Block(), [&] {
+        dead_add = b.Add(param, 1_i);
+        mod.SetName(dead_add, "dead");
+        auto* live_add = b.Add(param, 2_i);
+        b.Return(func, live_add);
+    });
+    dead_add->Destroy();
+
+    size_t live_instructions = 0;
+    for (auto* inst : mod.Instructions()) {
+        (void)inst;
+        live_instructions++;
+    }
+    size_t allocated_instructions = mod.AllocatedInstructionCount();
+    size_t allocated_values = mod.AllocatedValueCount();
+
+    mod.Compact();
+
+    size_t instructions = 0;
+    for (auto* inst : mod.Instructions()) {
+        EXPECT_TRUE(inst->Alive());
+        instructions++;
+    }
+    EXPECT_EQ(instructions, live_instructions);
+    EXPECT_EQ(mod.AllocatedInstructionCount(), allocated_instructions);
+    EXPECT_EQ(mod.AllocatedValueCount(), allocated_values);
+    EXPECT_EQ(Validate(mod), Success);
+
+    // An instruction of the same type reuses the memory of the reclaimed instruction.
+    auto dead_addr = reinterpret_cast<uintptr_t>(dead_add);
+    auto* add = b.Add(param, 3_i);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(add), dead_addr);
+    EXPECT_FALSE(mod.NameOf(add).IsValid());
+}
+
+TEST_F(IR_ModuleTest, Compact_DestroyedFunction) {
+    auto* func = b.Function("f", ty.void_());
+    auto* param = b.FunctionParam("p", ty.i32());
+    func->SetParams({param});
+    b.Append(func->Block(), [&] { b.Return(func); });
+
+    mod.Destroy(func);
+    mod.Compact();
+
+    EXPECT_EQ(param->Function(), nullptr);
+    EXPECT_TRUE(mod.functions.IsEmpty());
+}
+
+TEST_F(IR_ModuleTest, Compact_DestroyedControlInstruction) {
+    auto* func = b.Function("f", ty.void_());
+    If* ifelse = nullptr;
+    b.Append(func->Block(), [&] {
+        ifelse = b.If(true);
+        b.Append(ifelse->True(), [&] { b.ExitIf(ifelse); });
+        b.Return(func);
+    });
+    auto* true_block = ifelse->True();
+    auto* false_block = ifelse->False();
+
+    ifelse->Destroy();
+    mod.Compact();
+
+    EXPECT_EQ(true_block->Parent(), nullptr);
+    EXPECT_EQ(false_block->Parent(), nullptr);
+    EXPECT_EQ(Validate(mod), Success);
+}
+
 TEST_F(IR_ModuleDeathTest, IR_ASSERT_WithoutCallback) {
     EXPECT_DEATH_IF_SUPPORTED(
         {
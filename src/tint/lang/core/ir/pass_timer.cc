@@ -0,0 +1,109 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/pass_timer.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "src/tint/lang/core/ir/module.h"
+
+namespace tint::core::ir {
+
+PassTimer::PassTimer() = default;
+
+PassTimer::~PassTimer() = default;
+
+void PassTimer::Begin(const Module& mod, std::string_view name) {
+    End(mod);
+
+    // Count before starting the clock, as counting the live objects walks the whole module.
+    auto& current = current_.emplace();
+    current.timing.name = std::string(name);
+    current.counts = CountsOf(mod);
+    current.start = Clock::now();
+}
+
+void PassTimer::End(const Module& mod) {
+    if (!current_) {
+        return;
+    }
+    auto elapsed = Clock::now() - current_->start;
+
+    auto& timing = current_->timing;
+    timing.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+    timing.duration -= std::min(timing.duration, timing.validation_duration);
+
+    auto before = current_->counts;
+    auto after = CountsOf(mod);
+    timing.instructions_allocated = after.instructions_allocated - before.instructions_allocated;
+    timing.values_allocated = after.values_allocated - before.values_allocated;
+    timing.instruction_delta = static_cast<int64_t>(after.live_instructions) -
+                               static_cast<int64_t>(before.live_instructions);
+    timing.value_delta =
+        static_cast<int64_t>(after.live_values) - static_cast<int64_t>(before.live_values);
+
+    timings_.push_back(std::move(timing));
+    current_.reset();
+}
+
+void PassTimer::AddValidationTime(std::chrono::nanoseconds duration) {
+    if (current_) {
+        current_->timing.validation_duration += duration;
+    }
+}
+
+PassTimer::Counts PassTimer::CountsOf(const Module& mod) {
+    Counts counts;
+    counts.instructions_allocated = mod.AllocatedInstructionCount();
+    counts.values_allocated = mod.AllocatedValueCount();
+    for (auto* inst : mod.Instructions()) {
+        (void)inst;
+        counts.live_instructions++;
+    }
+    for (auto* value : mod.Values()) {
+        (void)value;
+        counts.live_values++;
+    }
+    return counts;
+}
+
+PassScope::PassScope(const Module& mod, std::string_view name) : mod_(mod) {
+    if (mod_.pass_timer && !mod_.pass_timer->Running()) {
+        mod_.pass_timer->Begin(mod_, name);
+        timing_ = true;
+    }
+}
+
+PassScope::~PassScope() {
+    if (timing_) {
+        mod_.pass_timer->End(mod_);
+    }
+}
+
+}  // namespace tint::core::ir
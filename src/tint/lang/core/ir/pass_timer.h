@@ -0,0 +1,144 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_PASS_TIMER_H_
+#define SRC_TINT_LANG_CORE_IR_PASS_TIMER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include "src/tint/api/common/pass_timing.h"
+#include "src/tint/utils/result.h"
+
+// Forward declarations
+namespace tint::core::ir {
+class Module;
+}
+
+namespace tint::core::ir {
+
+/// PassTimer records the cost of each transform run on a module.
+///
+/// A PassTimer is attached to a module by setting Module::pass_timer. Each pass is timed by a
+/// PassScope, which the backends create around each transform with TINT_CHECK_PASS(). Time spent
+/// in the IR validator is recorded separately from the time spent in the transform itself.
+///
+/// A PassTimer is not thread-safe, and must not be shared between modules that are transformed
+/// concurrently.
+class PassTimer {
+  public:
+    /// Constructor
+    PassTimer();
+
+    /// Destructor
+    ~PassTimer();
+
+    /// Ends the current pass, if there is one, then begins timing the pass @p name.
+    /// @param mod the module being transformed
+    /// @param name the name of the pass
+    void Begin(const Module& mod, std::string_view name);
+
+    /// Ends the current pass, if there is one.
+    /// @param mod the module being transformed
+    void End(const Module& mod);
+
+    /// Adds @p duration to the validation time of the current pass.
+    /// Validation time is not counted as part of the pass duration.
+    /// @param duration the time spent validating the module
+    void AddValidationTime(std::chrono::nanoseconds duration);
+
+    /// @returns true if a pass is currently being timed
+    bool Running() const { return current_.has_value(); }
+
+    /// @returns the timings of all the completed passes, in the order that they ran
+    const PassTimings& Timings() const { return timings_; }
+
+  private:
+    /// The clock used for timing passes
+    using Clock = std::chrono::steady_clock;
+
+    /// Snapshot of the module's instruction and value counts
+    struct Counts {
+        size_t instructions_allocated = 0;
+        size_t values_allocated = 0;
+        size_t live_instructions = 0;
+        size_t live_values = 0;
+    };
+
+    /// @returns the current counts of @p mod
+    static Counts CountsOf(const Module& mod);
+
+    /// The state of the pass currently being timed
+    struct Current {
+        PassTiming timing;
+        Counts counts;
+        Clock::time_point start;
+    };
+
+    std::optional<Current> current_;
+    PassTimings timings_;
+};
+
+/// PassScope times a pass with the module's pass timer, from its construction to its destruction.
+/// Nothing is timed if the module has no pass timer, or if a pass is already being timed, in which
+/// case the cost of the nested pass is charged to the enclosing one.
+class PassScope {
+  public:
+    /// Constructor
+    /// @param mod the module being transformed
+    /// @param name the name of the pass
+    PassScope(const Module& mod, std::string_view name);
+
+    /// Destructor
+    ~PassScope();
+
+  private:
+    const Module& mod_;
+    bool timing_ = false;
+};
+
+/// Runs the transform call @p result as the pass @p name of the module @p mod, then checks that it
+/// succeeded and propagates the failure if not, like TINT_CHECK_RESULT().
+#define TINT_CHECK_PASS(mod, name, result)                        \
+    TINT_CHECK_RESULT(([&] {                                      \
+        tint::core::ir::PassScope tint_pass_scope((mod), (name)); \
+        return result;                                            \
+    }()))
+
+/// Runs the transform call @p result as the pass @p name of the module @p mod, then checks that it
+/// succeeded and propagates the failure if not, like TINT_CHECK_RESULT_UNWRAP().
+#define TINT_CHECK_PASS_UNWRAP(to, mod, name, result)             \
+    TINT_CHECK_RESULT_UNWRAP(to, ([&] {                           \
+        tint::core::ir::PassScope tint_pass_scope((mod), (name)); \
+        return result;                                            \
+    }()))
+
+}  // namespace tint::core::ir
+
+#endif  // SRC_TINT_LANG_CORE_IR_PASS_TIMER_H_
@@ -0,0 +1,142 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/pass_timer.h"
+
+#include "gtest/gtest.h"
+#include "src/tint/lang/core/ir/ir_helper_test.h"
+#include "src/tint/lang/core/ir/validator.h"
+
+namespace tint::core::ir {
+namespace {
+
+using namespace tint::core::number_suffixes;  // NOLINT
+
+using IR_PassTimerTest = IRTestHelper;
+
+TEST_F(IR_PassTimerTest, NoPasses) {
+    PassTimer timer;
+    timer.End(mod);
+    EXPECT_TRUE(timer.Timings().empty());
+}
+
+TEST_F(IR_PassTimerTest, RecordsPassScopes) {
+    PassTimer timer;
+    mod.pass_timer = &timer;
+
+    auto* func = b.Function("f", ty.void_());
+    b.Append(func->Block(), [&] { b.Return(func); });
+
+    {
+        PassScope scope(mod, "test.A");
+        b.InsertBefore(func->Block()->Terminator(), [&] {
+            b.Let("x", 1_i);
+            b.Let("y", 2_i);
+        });
+    }
+    {
+        PassScope scope(mod, "test.B");
+        func->Block()->Front()->Destroy();
+    }
+
+    // Validation does not start a new pass.
+    AssertValid(mod, "before test.C");
+    mod.pass_timer = nullptr;
+
+    auto& timings = timer.Timings();
+    ASSERT_EQ(timings.size(), 2u);
+
+    EXPECT_EQ(timings[0].name, "test.A");
+    EXPECT_EQ(timings[0].instructions_allocated, 2u);
+    EXPECT_EQ(timings[0].instruction_delta, 2);
+    EXPECT_GE(timings[0].values_allocated, 2u);
+
+    EXPECT_EQ(timings[1].name, "test.B");
+    EXPECT_EQ(timings[1].instructions_allocated, 0u);
+    EXPECT_EQ(timings[1].values_allocated, 0u);
+    EXPECT_EQ(timings[1].instruction_delta, -1);
+}
+
+TEST_F(IR_PassTimerTest, NestedPassScopeIsChargedToEnclosingPass) {
+    PassTimer timer;
+    mod.pass_timer = &timer;
+    {
+        PassScope outer(mod, "test.A");
+        {
+            PassScope inner(mod, "test.B");
+        }
+        EXPECT_TRUE(timer.Running());
+    }
+    EXPECT_FALSE(timer.Running());
+    mod.pass_timer = nullptr;
+
+    auto& timings = timer.Timings();
+    ASSERT_EQ(timings.size(), 1u);
+    EXPECT_EQ(timings[0].name, "test.A");
+}
+
+Result<SuccessType> Fail() {
+    return Failure{"failed"};
+}
+
+Result<SuccessType> RunPasses(Module& mod) {
+    TINT_CHECK_PASS(mod, "test.A", Result<SuccessType>{Success});
+    TINT_CHECK_PASS(mod, "test.B", Fail());
+    TINT_CHECK_PASS(mod, "test.C", Result<SuccessType>{Success});
+    return Success;
+}
+
+TEST_F(IR_PassTimerTest, CheckPassEndsFailingPass) {
+    PassTimer timer;
+    mod.pass_timer = &timer;
+    EXPECT_NE(RunPasses(mod), Success);
+    EXPECT_FALSE(timer.Running());
+    mod.pass_timer = nullptr;
+
+    auto& timings = timer.Timings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_EQ(timings[0].name, "test.A");
+    EXPECT_EQ(timings[1].name, "test.B");
+}
+
+TEST_F(IR_PassTimerTest, BeginEndsPreviousPass) {
+    PassTimer timer;
+    timer.Begin(mod, "test.A");
+    timer.AddValidationTime(std::chrono::nanoseconds(0));
+    timer.Begin(mod, "test.B");
+    EXPECT_EQ(timer.Timings().size(), 1u);
+    timer.End(mod);
+    timer.End(mod);
+
+    auto& timings = timer.Timings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_EQ(timings[0].name, "test.A");
+    EXPECT_EQ(timings[1].name, "test.B");
+}
+
+}  // namespace
+}  // namespace tint::core::ir
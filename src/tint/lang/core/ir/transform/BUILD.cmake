@@ -58,7 +58,9 @@ tint_add_target(tint_lang_core_ir_transform lib
   lang/core/ir/transform/collapse_subgroup_min_max.cc
   lang/core/ir/transform/collapse_subgroup_min_max.h
   lang/core/ir/transform/combine_access_instructions.cc
+  lang/core/ir/transform/common_subexpression_elimination.cc
   lang/core/ir/transform/combine_access_instructions.h
+  lang/core/ir/transform/common_subexpression_elimination.h
   lang/core/ir/transform/conversion_polyfill.cc
   lang/core/ir/transform/conversion_polyfill.h
   lang/core/ir/transform/dead_code_elimination.cc
@@ -69,6 +71,8 @@ tint_add_target(tint_lang_core_ir_transform lib
   lang/core/ir/transform/demote_to_helper.h
   lang/core/ir/transform/direct_variable_access.cc
   lang/core/ir/transform/direct_variable_access.h
+  lang/core/ir/transform/loop_invariant_code_motion.cc
+  lang/core/ir/transform/loop_invariant_code_motion.h
   lang/core/ir/transform/lower_swizzle_view.cc
   lang/core/ir/transform/lower_swizzle_view.h
   lang/core/ir/transform/multiplanar_external_texture.cc
@@ -158,12 +162,14 @@ tint_add_target(tint_lang_core_ir_transform_test test
   lang/core/ir/transform/change_immediate_to_uniform_test.cc
   lang/core/ir/transform/collapse_subgroup_min_max_test.cc
   lang/core/ir/transform/combine_access_instructions_test.cc
+  lang/core/ir/transform/common_subexpression_elimination_test.cc
   lang/core/ir/transform/conversion_polyfill_test.cc
   lang/core/ir/transform/dead_code_elimination_test.cc
   lang/core/ir/transform/decompose_access_test.cc
   lang/core/ir/transform/demote_to_helper_test.cc
   lang/core/ir/transform/direct_variable_access_test.cc
   lang/core/ir/transform/helper_test.h
+  lang/core/ir/transform/loop_invariant_code_motion_test.cc
   lang/core/ir/transform/lower_swizzle_view_test.cc
   lang/core/ir/transform/multiplanar_external_texture_test.cc
   lang/core/ir/transform/prepare_immediate_data_test.cc
@@ -227,10 +233,12 @@ tint_add_target(tint_lang_core_ir_transform_fuzz fuzz
   lang/core/ir/transform/block_decorated_structs_fuzz.cc
   lang/core/ir/transform/builtin_polyfill_fuzz.cc
   lang/core/ir/transform/combine_access_instructions_fuzz.cc
+  lang/core/ir/transform/common_subexpression_elimination_fuzz.cc
   lang/core/ir/transform/conversion_polyfill_fuzz.cc
   lang/core/ir/transform/dead_code_elimination_fuzz.cc
   lang/core/ir/transform/demote_to_helper_fuzz.cc
   lang/core/ir/transform/direct_variable_access_fuzz.cc
+  lang/core/ir/transform/loop_invariant_code_motion_fuzz.cc
   lang/core/ir/transform/multiplanar_external_texture_fuzz.cc
   lang/core/ir/transform/preserve_padding_fuzz.cc
   lang/core/ir/transform/remove_terminator_args_fuzz.cc
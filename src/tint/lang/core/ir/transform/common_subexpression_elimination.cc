@@ -0,0 +1,210 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/common_subexpression_elimination.h"
+
+#include <optional>
+
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/validator.h"
+#include "src/tint/utils/containers/scope_stack.h"
+#include "src/tint/utils/rtti/switch.h"
+
+namespace tint::core::ir::transform {
+
+namespace {
+
+/// Key describes the value computed by an instruction. Two instructions with equal keys compute
+/// the same value.
+struct Key {
+    /// The kind of the instruction
+    const tint::TypeInfo* kind = nullptr;
+    /// The operator or builtin function of the instruction, if it has one
+    uint32_t op = 0;
+    /// The type of the instruction result
+    const core::type::Type* type = nullptr;
+    /// The operands of the instruction
+    Vector<const Value*, 4> operands;
+    /// The swizzle indices, if the instruction is a swizzle
+    Vector<uint32_t, 4> indices;
+    /// The memory epoch, if the instruction reads from memory
+    uint32_t epoch = 0;
+
+    /// @returns the hash code of the key
+    tint::HashCode HashCode() const {
+        auto hash = Hash(kind, op, type, epoch, operands.Length(), indices.Length());
+        for (auto* operand : operands) {
+            hash = HashCombine(hash, operand);
+        }
+        for (auto index : indices) {
+            hash = HashCombine(hash, index);
+        }
+        return hash;
+    }
+
+    /// Equality operator
+    /// @param other the key to compare against
+    /// @returns true if this key is equal to @p other
+    bool operator==(const Key& other) const {
+        return kind == other.kind && op == other.op && type == other.type &&
+               epoch == other.epoch && operands == other.operands && indices == other.indices;
+    }
+};
+
+/// PIMPL state for the transform.
+struct State {
+    /// The IR module.
+    Module& ir;
+
+    /// The instructions available at the current point of the walk, scoped by block.
+    ScopeStack<Key, Instruction*> available{};
+
+    /// The current memory epoch. This is incremented whenever memory may be written, so that loads
+    /// on either side of the write are not considered equal.
+    uint32_t epoch = 0;
+
+    /// Process the module.
+    void Process() {
+        for (auto& func : ir.functions) {
+            available.Clear();
+            Visit(func->Block());
+        }
+    }
+
+    /// Replaces the redundant instructions of @p block and its nested blocks.
+    /// In the structured IR, an instruction dominates the instructions that follow it in its block,
+    /// and the instructions of the blocks nested under those. The scopes of #available therefore
+    /// follow the block nesting.
+    /// @param block the block
+    void Visit(Block* block) {
+        available.Push();
+        for (auto* inst = block->Front(); inst;) {
+            auto* next = inst->next;
+            if (auto* control = inst->As<ControlInstruction>()) {
+                bool is_loop = control->Is<Loop>();
+                control->ForeachBlock([&](Block* child) {
+                    if (is_loop) {
+                        // A load in a loop may observe a store made by a previous iteration.
+                        epoch++;
+                    }
+                    Visit(child);
+                });
+            } else if (auto key = KeyOf(inst)) {
+                if (auto* existing = available.Get(*key)) {
+                    inst->Result()->ReplaceAllUsesWith(existing->Result());
+                    inst->Destroy();
+                } else {
+                    available.Set(*key, inst);
+                }
+            } else if (inst->GetSideEffects().Contains(Instruction::Access::kStore)) {
+                epoch++;
+            }
+            inst = next;
+        }
+        available.Pop();
+    }
+
+    /// @param inst the instruction
+    /// @returns the key of the value computed by @p inst, or std::nullopt if the instruction
+    /// cannot be replaced by an equivalent instruction.
+    std::optional<Key> KeyOf(Instruction* inst) {
+        if (inst->Results().Length() != 1) {
+            return std::nullopt;
+        }
+
+        Key key;
+        key.kind = &inst->TypeInfo();
+        key.type = inst->Result()->Type();
+        bool eligible = tint::Switch(
+            inst,  //
+            [&](CoreBinary* binary) {
+                key.op = static_cast<uint32_t>(binary->Op());
+                return true;
+            },
+            [&](CoreUnary* unary) {
+                key.op = static_cast<uint32_t>(unary->Op());
+                return true;
+            },
+            // Core and dialect builtins use the kind of the instruction to tell their function IDs
+            // apart.
+            [&](BuiltinCall* call) {
+                key.op = static_cast<uint32_t>(call->FuncId());
+                return IsPure(call);
+            },
+            [&](MemberBuiltinCall* call) {
+                key.op = static_cast<uint32_t>(call->FuncId());
+                return IsPure(call);
+            },
+            [&](Swizzle* swizzle) {
+                for (auto index : swizzle->Indices()) {
+                    key.indices.Push(index);
+                }
+                return true;
+            },
+            [&](Load*) {
+                key.epoch = epoch;
+                return true;
+            },
+            [&](LoadVectorElement*) {
+                key.epoch = epoch;
+                return true;
+            },
+            [&](Access*) { return true; },     //
+            [&](Construct*) { return true; },  //
+            [&](Convert*) { return true; },    //
+            [&](Default) { return false; });
+        if (!eligible) {
+            return std::nullopt;
+        }
+
+        for (auto* operand : inst->Operands()) {
+            key.operands.Push(operand);
+        }
+        return key;
+    }
+
+    /// @param call the builtin call
+    /// @returns true if @p call returns a value that only depends on its arguments
+    bool IsPure(const Call* call) {
+        // Void calls are only made for their effect on their arguments, like `GetDimensions`.
+        return call->GetSideEffects().Empty() && call->ExplicitTemplateParams().IsEmpty() &&
+               !call->Result()->Type()->Is<core::type::Void>();
+    }
+};
+
+}  // namespace
+
+Result<SuccessType> CommonSubexpressionElimination(Module& ir) {
+    core::ir::AssertValid(ir, "before core.CommonSubexpressionElimination");
+
+    State{ir}.Process();
+
+    return Success;
+}
+
+}  // namespace tint::core::ir::transform
@@ -0,0 +1,527 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/common_subexpression_elimination.h"
+
+#include "src/tint/lang/core/ir/transform/helper_test.h"
+
+namespace tint::core::ir::transform {
+namespace {
+
+using namespace tint::core::fluent_types;     // NOLINT
+using namespace tint::core::number_suffixes;  // NOLINT
+
+using IR_CommonSubexpressionEliminationTest = TransformTest;
+
+TEST_F(IR_CommonSubexpressionEliminationTest, ConstructAndSwizzle) {
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.i32());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* x = b.Add(p, 1_i);
+        auto* y = b.Add(p, 2_i);
+        auto* z = b.Subtract(p, 1_i);
+        auto* w = b.Swizzle(ty.vec2i(), b.Construct(ty.vec3i(), x, y, z), {0u, 1u});
+        auto* v = b.Swizzle(ty.vec2i(), b.Construct(ty.vec3i(), x, y, z), {1u, 0u});
+        b.Return(func, b.Access(ty.i32(), b.Add(w, v), 0_u));
+    });
+
+    auto* src = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:i32 = add %p, 1i
+    %4:i32 = add %p, 2i
+    %5:i32 = sub %p, 1i
+    %6:vec3<i32> = construct %3, %4, %5
+    %7:vec2<i32> = swizzle %6, xy
+    %8:vec3<i32> = construct %3, %4, %5
+    %9:vec2<i32> = swizzle %8, yx
+    %10:vec2<i32> = add %7, %9
+    %11:i32 = access %10, 0u
+    ret %11
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:i32 = add %p, 1i
+    %4:i32 = add %p, 2i
+    %5:i32 = sub %p, 1i
+    %6:vec3<i32> = construct %3, %4, %5
+    %7:vec2<i32> = swizzle %6, xy
+    %8:vec2<i32> = swizzle %6, yx
+    %9:vec2<i32> = add %7, %8
+    %10:i32 = access %9, 0u
+    ret %10
+  }
+}
+)";
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, SameBlock) {
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.i32());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* x = b.Multiply(b.Add(p, 1_i), 2_i);
+        auto* y = b.Multiply(b.Add(p, 1_i), 2_i);
+        b.Return(func, b.Add(x, y));
+    });
+
+    auto* src = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:i32 = add %p, 1i
+    %4:i32 = mul %3, 2i
+    %5:i32 = add %p, 1i
+    %6:i32 = mul %5, 2i
+    %7:i32 = add %4, %6
+    ret %7
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:i32 = add %p, 1i
+    %4:i32 = mul %3, 2i
+    %5:i32 = add %4, %4
+    ret %5
+  }
+}
+)";
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, DominatingBlock) {
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.i32());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* x = b.Add(p, 1_i);
+        auto* ifelse = b.If(b.Equal(x, 0_i));
+        ifelse->SetResult(b.InstructionResult(ty.i32()));
+        b.Append(ifelse->True(), [&] { b.ExitIf(ifelse, b.Add(p, 1_i)); });
+        b.Append(ifelse->False(), [&] { b.ExitIf(ifelse, 0_i); });
+        b.Return(func, ifelse->Result());
+    });
+
+    auto* src = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:i32 = add %p, 1i
+    %4:bool = eq %3, 0i
+    %5:i32 = if %4 [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        %6:i32 = add %p, 1i
+        exit_if %6  # if_1
+      }
+      $B3: {  # false
+        exit_if 0i  # if_1
+      }
+    }
+    ret %5
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:i32 = add %p, 1i
+    %4:bool = eq %3, 0i
+    %5:i32 = if %4 [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        exit_if %3  # if_1
+      }
+      $B3: {  # false
+        exit_if 0i  # if_1
+      }
+    }
+    ret %5
+  }
+}
+)";
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, NoModify_SiblingBlocks) {
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.i32());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* ifelse = b.If(b.Equal(p, 0_i));
+        ifelse->SetResult(b.InstructionResult(ty.i32()));
+        b.Append(ifelse->True(), [&] { b.ExitIf(ifelse, b.Add(p, 1_i)); });
+        b.Append(ifelse->False(), [&] { b.ExitIf(ifelse, b.Add(p, 1_i)); });
+        b.Return(func, b.Add(ifelse->Result(), b.Add(p, 1_i)));
+    });
+
+    auto* src = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:bool = eq %p, 0i
+    %4:i32 = if %3 [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        %5:i32 = add %p, 1i
+        exit_if %5  # if_1
+      }
+      $B3: {  # false
+        %6:i32 = add %p, 1i
+        exit_if %6  # if_1
+      }
+    }
+    %7:i32 = add %p, 1i
+    %8:i32 = add %4, %7
+    ret %8
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, PureBuiltinCall) {
+    auto* buffer = b.Var("buffer", ty.ptr(storage, ty.array<i32>(), read));
+    buffer->SetBindingPoint(0, 0);
+    mod.root_block->Append(buffer);
+
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.u32());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* len_a = b.Call(ty.u32(), BuiltinFn::kArrayLength, buffer);
+        auto* idx_a = b.Call(ty.u32(), BuiltinFn::kMin, p, b.Subtract(len_a, 1_u));
+        auto* a = b.Load(b.Access(ty.ptr(storage, ty.i32(), read), buffer, idx_a));
+        auto* len_b = b.Call(ty.u32(), BuiltinFn::kArrayLength, buffer);
+        auto* idx_b = b.Call(ty.u32(), BuiltinFn::kMin, p, b.Subtract(len_b, 1_u));
+        auto* c = b.Load(b.Access(ty.ptr(storage, ty.i32(), read), buffer, idx_b));
+        b.Return(func, b.Add(a, c));
+    });
+
+    auto* src = R"(
+$B1: {  # root
+  %buffer:ptr<storage, array<i32>, read> = var undef @binding_point(0, 0)
+}
+
+%foo = func(%p:u32):i32 {
+  $B2: {
+    %4:u32 = arrayLength %buffer
+    %5:u32 = sub %4, 1u
+    %6:u32 = min %p, %5
+    %7:ptr<storage, i32, read> = access %buffer, %6
+    %8:i32 = load %7
+    %9:u32 = arrayLength %buffer
+    %10:u32 = sub %9, 1u
+    %11:u32 = min %p, %10
+    %12:ptr<storage, i32, read> = access %buffer, %11
+    %13:i32 = load %12
+    %14:i32 = add %8, %13
+    ret %14
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+$B1: {  # root
+  %buffer:ptr<storage, array<i32>, read> = var undef @binding_point(0, 0)
+}
+
+%foo = func(%p:u32):i32 {
+  $B2: {
+    %4:u32 = arrayLength %buffer
+    %5:u32 = sub %4, 1u
+    %6:u32 = min %p, %5
+    %7:ptr<storage, i32, read> = access %buffer, %6
+    %8:i32 = load %7
+    %9:i32 = add %8, %8
+    ret %9
+  }
+}
+)";
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, Load_NoInterveningStore) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, i32>());
+        auto* w = b.Var("w", ty.ptr<function, i32>());
+        auto* x = b.Load(v);
+        b.Load(w);
+        auto* y = b.Load(v);
+        b.Return(func, b.Add(x, y));
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    %w:ptr<function, i32, read_write> = var undef
+    %4:i32 = load %v
+    %5:i32 = load %w
+    %6:i32 = load %v
+    %7:i32 = add %4, %6
+    ret %7
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():i32 {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    %w:ptr<function, i32, read_write> = var undef
+    %4:i32 = load %v
+    %5:i32 = load %w
+    %6:i32 = add %4, %4
+    ret %6
+  }
+}
+)";
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, NoModify_Load_InterveningStore) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, i32>());
+        auto* w = b.Var("w", ty.ptr<function, i32>());
+        auto* x = b.Load(v);
+        b.Store(w, 1_i);
+        auto* y = b.Load(v);
+        b.Return(func, b.Add(x, y));
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    %w:ptr<function, i32, read_write> = var undef
+    %4:i32 = load %v
+    store %w, 1i
+    %5:i32 = load %v
+    %6:i32 = add %4, %5
+    ret %6
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, NoModify_Load_InterveningCall) {
+    auto* bar = b.Function("bar", ty.void_());
+    b.Append(bar->Block(), [&] { b.Return(bar); });
+
+    auto* v = b.Var("v", ty.ptr<private_, i32>());
+    mod.root_block->Append(v);
+
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* x = b.Load(v);
+        b.Call(bar);
+        auto* y = b.Load(v);
+        b.Return(func, b.Add(x, y));
+    });
+
+    auto* src = R"(
+$B1: {  # root
+  %v:ptr<private, i32, read_write> = var undef
+}
+
+%bar = func():void {
+  $B2: {
+    ret
+  }
+}
+%foo = func():i32 {
+  $B3: {
+    %4:i32 = load %v
+    %5:void = call %bar
+    %6:i32 = load %v
+    %7:i32 = add %4, %6
+    ret %7
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, NoModify_Load_InterveningStoreInIf) {
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.bool_());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, i32>());
+        auto* x = b.Load(v);
+        auto* ifelse = b.If(p);
+        b.Append(ifelse->True(), [&] {
+            b.Store(v, 1_i);
+            b.ExitIf(ifelse);
+        });
+        auto* y = b.Load(v);
+        b.Return(func, b.Add(x, y));
+    });
+
+    auto* src = R"(
+%foo = func(%p:bool):i32 {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    %4:i32 = load %v
+    if %p [t: $B2] {  # if_1
+      $B2: {  # true
+        store %v, 1i
+        exit_if  # if_1
+      }
+    }
+    %5:i32 = load %v
+    %6:i32 = add %4, %5
+    ret %6
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_CommonSubexpressionEliminationTest, Load_InLoop) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, i32>());
+        auto* x = b.Load(v);
+        auto* loop = b.Loop();
+        b.Append(loop->Body(), [&] {
+            // Must not be replaced with the load before the loop.
+            auto* y = b.Load(v);
+            // Can be replaced with the load above.
+            auto* z = b.Load(v);
+            b.Store(v, b.Add(b.Add(x, y), z));
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] { b.BreakIf(loop, true); });
+        b.Return(func, x);
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    %3:i32 = load %v
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        %4:i32 = load %v
+        %5:i32 = load %v
+        %6:i32 = add %3, %4
+        %7:i32 = add %6, %5
+        store %v, %7
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():i32 {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    %3:i32 = load %v
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        %4:i32 = load %v
+        %5:i32 = add %3, %4
+        %6:i32 = add %5, %4
+        store %v, %6
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret %3
+  }
+}
+)";
+
+    Run(CommonSubexpressionElimination);
+
+    EXPECT_EQ(expect, str());
+}
+
+}  // namespace
+}  // namespace tint::core::ir::transform
@@ -0,0 +1,356 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/loop_invariant_code_motion.h"
+
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/validator.h"
+#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/rtti/switch.h"
+
+namespace tint::core::ir::transform {
+
+namespace {
+
+/// PIMPL state for the transform.
+struct State {
+    /// The IR module.
+    Module& ir;
+
+    /// The blocks of the loop currently being processed, including nested blocks.
+    Hashset<const Block*, 16> loop_blocks{};
+
+    /// The root variables that are stored to by the loop currently being processed.
+    Hashset<const Var*, 8> stored_vars{};
+
+    /// True if the loop currently being processed may write to memory that cannot be attributed to
+    /// a root variable, for example through a function call, an atomic or a pointer parameter.
+    bool stores_unknown = false;
+
+    /// Process the module.
+    void Process() {
+        // Collect the loops in post-order, so that inner loops are processed before the loops that
+        // contain them. An instruction hoisted out of an inner loop can then be hoisted further.
+        Vector<Loop*, 8> loops;
+        for (auto& func : ir.functions) {
+            CollectLoops(func->Block(), loops);
+        }
+        for (auto* loop : loops) {
+            Process(loop);
+        }
+    }
+
+    /// Appends the loops nested in @p block to @p loops, in post-order.
+    /// @param block the block
+    /// @param loops the list of loops
+    void CollectLoops(Block* block, Vector<Loop*, 8>& loops) {
+        for (auto* inst : *block) {
+            if (auto* control = inst->As<ControlInstruction>()) {
+                control->ForeachBlock([&](Block* child) { CollectLoops(child, loops); });
+                if (auto* loop = control->As<Loop>()) {
+                    loops.Push(loop);
+                }
+            }
+        }
+    }
+
+    /// Hoists the invariant instructions out of @p loop.
+    /// @param loop the loop
+    void Process(Loop* loop) {
+        loop_blocks.Clear();
+        stored_vars.Clear();
+        stores_unknown = false;
+        loop->ForeachBlock([&](Block* block) { Scan(block); });
+
+        // The body always runs once the loop has been entered, unless the initializer branches
+        // elsewhere. Loads can only be hoisted if they are certain to run.
+        bool body_runs = true;
+        if (loop->HasInitializer()) {
+            for (auto* inst : *loop->Initializer()) {
+                if (inst->Is<ControlInstruction>()) {
+                    body_runs = false;
+                    break;
+                }
+            }
+        }
+
+        // Instructions at the top of the body run on every iteration, up to the first control
+        // instruction, which may exit the loop.
+        bool runs_every_iteration = body_runs;
+        for (auto* inst = loop->Body()->Front(); inst;) {
+            auto* next = inst->next;
+            if (auto* control = inst->As<ControlInstruction>()) {
+                runs_every_iteration = false;
+                control->ForeachBlock([&](Block* block) { Hoist(loop, block); });
+            } else {
+                TryHoist(loop, inst, runs_every_iteration);
+            }
+            inst = next;
+        }
+        Hoist(loop, loop->Continuing());
+    }
+
+    /// Records the blocks and memory writes of @p block and its nested blocks.
+    /// @param block the block
+    void Scan(Block* block) {
+        loop_blocks.Add(block);
+        for (auto* inst : *block) {
+            if (auto* control = inst->As<ControlInstruction>()) {
+                control->ForeachBlock([&](Block* child) { Scan(child); });
+                continue;
+            }
+            if (!inst->GetSideEffects().Contains(Instruction::Access::kStore)) {
+                continue;
+            }
+            const Var* root = tint::Switch(
+                inst,  //
+                [&](Store* store) { return RootVarOf(store->To()); },
+                [&](StoreVectorElement* store) { return RootVarOf(store->To()); },
+                [&](Default) -> const Var* { return nullptr; });
+            if (root) {
+                stored_vars.Add(root);
+            } else {
+                stores_unknown = true;
+            }
+        }
+    }
+
+    /// Hoists the invariant side-effect free instructions of @p block and its nested blocks out of
+    /// @p loop.
+    /// @param loop the loop
+    /// @param block the block
+    void Hoist(Loop* loop, Block* block) {
+        for (auto* inst = block->Front(); inst;) {
+            auto* next = inst->next;
+            if (auto* control = inst->As<ControlInstruction>()) {
+                control->ForeachBlock([&](Block* child) { Hoist(loop, child); });
+            } else {
+                TryHoist(loop, inst, /* runs_every_iteration */ false);
+            }
+            inst = next;
+        }
+    }
+
+    /// Moves @p inst to before @p loop if it computes the same value on every iteration.
+    /// @param loop the loop
+    /// @param inst the instruction in the loop
+    /// @param runs_every_iteration true if @p inst is certain to run whenever the loop is entered
+    void TryHoist(Loop* loop, Instruction* inst, bool runs_every_iteration) {
+        bool hoistable = tint::Switch(
+            inst,  //
+            [&](CoreBinary* binary) {
+                bool is_div =
+                    binary->Op() == BinaryOp::kDivide || binary->Op() == BinaryOp::kModulo;
+                if (!is_div || !binary->Result()->Type()->IsIntegerScalarOrVector()) {
+                    return true;
+                }
+                // Integer division and modulo may be undefined for operands that the loop would
+                // not have used, so only hoist them when the divisor is a safe constant.
+                auto* rhs = binary->RHS()->As<Constant>();
+                return rhs && IsSafeDivisor(rhs->Value());
+            },
+            [&](CoreBuiltinCall* call) { return call->GetSideEffects().Empty(); },
+            [&](Load* load) { return runs_every_iteration && IsReadOnlyInLoop(load->From()); },
+            [&](LoadVectorElement* load) {
+                return runs_every_iteration && IsReadOnlyInLoop(load->From());
+            },
+            [&](CoreUnary*) { return true; },  //
+            [&](Access*) { return true; },     //
+            [&](Construct*) { return true; },  //
+            [&](Convert*) { return true; },    //
+            [&](Swizzle*) { return true; },    //
+            [&](Default) { return false; });
+        if (!hoistable) {
+            return;
+        }
+        // Instructions that may not run on any iteration are executed speculatively once hoisted,
+        // so they must not be able to fault.
+        if (!runs_every_iteration && !CanSpeculate(inst)) {
+            return;
+        }
+        for (auto* operand : inst->Operands()) {
+            if (IsDefinedInLoop(operand)) {
+                return;
+            }
+        }
+
+        inst->Remove();
+        inst->InsertBefore(loop);
+    }
+
+    /// @param inst the hoistable instruction
+    /// @returns true if @p inst can be executed even when the loop would not have executed it
+    bool CanSpeculate(Instruction* inst) {
+        return tint::Switch(
+            inst,  //
+            [&](CoreBinary* binary) {
+                if (binary->Op() != BinaryOp::kShiftLeft && binary->Op() != BinaryOp::kShiftRight) {
+                    return true;
+                }
+                // Shifting by at least the bit width is undefined once the shifts are lowered to
+                // the backend, so only speculate shifts by a constant that is in range.
+                auto* rhs = binary->RHS()->As<Constant>();
+                return rhs && IsSafeShift(rhs->Value(), binary->LHS()->Type());
+            },
+            [&](Access* access) {
+                // Without robustness, a dynamic index may be out of bounds.
+                return IsInBounds(access);
+            },
+            [&](Default) { return true; });
+    }
+
+    /// @param value the constant shift amount
+    /// @param type the type of the shifted value
+    /// @returns true if every element of @p value is smaller than the bit width of @p type
+    bool IsSafeShift(const core::constant::Value* value, const core::type::Type* type) {
+        const AInt width(type->DeepestElement()->Size() * 8);
+        auto in_range = [&](const core::constant::Value* amount) {
+            return amount->ValueAs<AInt>() >= 0 && amount->ValueAs<AInt>() < width;
+        };
+        if (value->Type()->IsScalar()) {
+            return in_range(value);
+        }
+        for (size_t i = 0; i < value->NumElements(); i++) {
+            if (!in_range(value->Index(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @param access the access instruction
+    /// @returns true if all the indices of @p access are constants that are known to be in bounds
+    bool IsInBounds(const Access* access) {
+        const core::type::Type* type = access->Object()->Type()->UnwrapPtrOrRef();
+        for (auto* index : access->Indices()) {
+            auto* constant = index->As<Constant>();
+            if (!constant) {
+                return false;
+            }
+            // Runtime-sized arrays have a count of 0, so any index into them is rejected.
+            auto idx = constant->Value()->ValueAs<AInt>();
+            auto count = type->Elements(nullptr, 0).count;
+            if (idx < 0 || idx >= AInt(count)) {
+                return false;
+            }
+            type = type->Element(static_cast<uint32_t>(idx));
+            if (!type) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @param value the value
+    /// @returns true if @p value is defined by an instruction or block parameter of the loop
+    bool IsDefinedInLoop(const Value* value) {
+        return tint::Switch(
+            value,  //
+            [&](const InstructionResult* result) {
+                auto* inst = result->Instruction();
+                return inst && inst->Block() && loop_blocks.Contains(inst->Block());
+            },
+            [&](const BlockParam* param) { return loop_blocks.Contains(param->Block()); },
+            [&](Default) { return false; });
+    }
+
+    /// @param value the constant divisor
+    /// @returns true if integer division by @p value is defined for any dividend
+    bool IsSafeDivisor(const core::constant::Value* value) {
+        if (value->AnyZero()) {
+            return false;
+        }
+        if (!value->Type()->IsSignedIntegerScalarOrVector()) {
+            return true;
+        }
+        // Dividing the most negative integer by -1 overflows.
+        if (value->Type()->IsSignedIntegerScalar()) {
+            return value->ValueAs<AInt>() != -1;
+        }
+        for (size_t i = 0; i < value->NumElements(); i++) {
+            if (value->Index(i)->ValueAs<AInt>() == -1) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @param ptr the pointer value
+    /// @returns true if the memory pointed to by @p ptr cannot be modified by the loop
+    bool IsReadOnlyInLoop(const Value* ptr) {
+        auto* view = ptr->Type()->As<core::type::MemoryView>();
+        if (!view) {
+            return false;
+        }
+        switch (view->AddressSpace()) {
+            case AddressSpace::kUniform:
+            case AddressSpace::kImmediate:
+            case AddressSpace::kHandle:
+                return true;
+            case AddressSpace::kStorage:
+                return view->Access() == core::Access::kRead;
+            case AddressSpace::kFunction:
+            case AddressSpace::kPrivate: {
+                // Only the invocation itself can write to these address spaces.
+                auto* root = RootVarOf(ptr);
+                return root && !stores_unknown && !stored_vars.Contains(root);
+            }
+            default:
+                // Memory in other address spaces may be written by other invocations.
+                return false;
+        }
+    }
+
+    /// @param ptr the pointer value
+    /// @returns the variable that @p ptr points into, or nullptr if it cannot be determined
+    const Var* RootVarOf(const Value* ptr) {
+        while (auto* result = ptr->As<InstructionResult>()) {
+            auto* inst = result->Instruction();
+            if (auto* access = inst->As<Access>()) {
+                ptr = access->Object();
+            } else if (auto* let = inst->As<Let>()) {
+                ptr = let->Value();
+            } else {
+                return inst->As<Var>();
+            }
+        }
+        return nullptr;
+    }
+};
+
+}  // namespace
+
+Result<SuccessType> LoopInvariantCodeMotion(Module& ir) {
+    core::ir::AssertValid(ir, "before core.LoopInvariantCodeMotion");
+
+    State{ir}.Process();
+
+    return Success;
+}
+
+}  // namespace tint::core::ir::transform
@@ -0,0 +1,61 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_TRANSFORM_LOOP_INVARIANT_CODE_MOTION_H_
+#define SRC_TINT_LANG_CORE_IR_TRANSFORM_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/tint/utils/result.h"
+
+// Forward declarations.
+namespace tint::core::ir {
+class Module;
+}
+
+namespace tint::core::ir::transform {
+
+/// LoopInvariantCodeMotion is a transform that moves instructions that compute the same value on
+/// every iteration of a loop to just before the loop.
+///
+/// The transform hoists:
+///  * Side-effect free core instructions (arithmetic, conversions, constructors, swizzles,
+///    accesses and pure builtin calls such as `arrayLength`) whose operands are all defined
+///    outside of the loop. Integer division and modulo are only hoisted when the divisor is a
+///    constant that cannot make them undefined.
+///  * Loads at the start of the loop body that read memory the loop cannot modify. This is
+///    read-only memory, or a `function` or `private` variable that is not written to by the loop.
+///
+/// Instructions that may not run on every iteration, like those in an `if` or in the continuing
+/// block, run speculatively once hoisted. They are only hoisted if they cannot fault, so accesses
+/// must use constant indices that are in bounds, and shifts a constant amount that is in range.
+///
+/// @param module the module to transform
+/// @returns success or failure
+Result<SuccessType> LoopInvariantCodeMotion(Module& module);
+
+}  // namespace tint::core::ir::transform
+
+#endif  // SRC_TINT_LANG_CORE_IR_TRANSFORM_LOOP_INVARIANT_CODE_MOTION_H_
@@ -0,0 +1,796 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/loop_invariant_code_motion.h"
+
+#include "src/tint/lang/core/ir/transform/helper_test.h"
+
+namespace tint::core::ir::transform {
+namespace {
+
+using namespace tint::core::fluent_types;     // NOLINT
+using namespace tint::core::number_suffixes;  // NOLINT
+
+using IR_LoopInvariantCodeMotionTest = TransformTest;
+
+TEST_F(IR_LoopInvariantCodeMotionTest, NoModify_NoLoop) {
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.i32());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] { b.Return(func, b.Multiply(p, 2_i)); });
+
+    auto* src = R"(
+%foo = func(%p:i32):i32 {
+  $B1: {
+    %3:i32 = mul %p, 2i
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, ArrayLengthAndClamp) {
+    auto* buffer = b.Var("buffer", ty.ptr<storage, array<i32>, read_write>());
+    buffer->SetBindingPoint(0, 0);
+    mod.root_block->Append(buffer);
+
+    auto* func = b.Function("foo", ty.void_());
+    b.Append(func->Block(), [&] {
+        auto* loop = b.Loop();
+        b.Append(loop->Initializer(), [&] { b.NextIteration(loop, 0_u); });
+        auto* i = b.BlockParam<u32>("i");
+        loop->Body()->SetParams({i});
+        b.Append(loop->Body(), [&] {
+            auto* len = b.Call<u32>(BuiltinFn::kArrayLength, buffer);
+            auto* limit = b.Subtract(len, 1_u);
+            auto* index = b.Call<u32>(BuiltinFn::kMin, i, limit);
+            b.Store(b.Access(ty.ptr<storage, i32>(), buffer, index), 1_i);
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] {
+            auto* next = b.Add(i, 1_u);
+            b.BreakIf(loop, b.GreaterThanEqual(next, 16_u), next, Empty);
+        });
+        b.Return(func);
+    });
+
+    auto* src = R"(
+$B1: {  # root
+  %buffer:ptr<storage, array<i32>, read_write> = var undef @binding_point(0, 0)
+}
+
+%foo = func():void {
+  $B2: {
+    loop [i: $B3, b: $B4, c: $B5] {  # loop_1
+      $B3: {  # initializer
+        next_iteration 0u  # -> $B4
+      }
+      $B4 (%i:u32): {  # body
+        %4:u32 = arrayLength %buffer
+        %5:u32 = sub %4, 1u
+        %6:u32 = min %i, %5
+        %7:ptr<storage, i32, read_write> = access %buffer, %6
+        store %7, 1i
+        continue  # -> $B5
+      }
+      $B5: {  # continuing
+        %8:u32 = add %i, 1u
+        %9:bool = gte %8, 16u
+        break_if %9 next_iteration: [ %8 ]  # -> [t: exit_loop loop_1, f: $B4]
+      }
+    }
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+$B1: {  # root
+  %buffer:ptr<storage, array<i32>, read_write> = var undef @binding_point(0, 0)
+}
+
+%foo = func():void {
+  $B2: {
+    %3:u32 = arrayLength %buffer
+    %4:u32 = sub %3, 1u
+    loop [i: $B3, b: $B4, c: $B5] {  # loop_1
+      $B3: {  # initializer
+        next_iteration 0u  # -> $B4
+      }
+      $B4 (%i:u32): {  # body
+        %6:u32 = min %i, %4
+        %7:ptr<storage, i32, read_write> = access %buffer, %6
+        store %7, 1i
+        continue  # -> $B5
+      }
+      $B5: {  # continuing
+        %8:u32 = add %i, 1u
+        %9:bool = gte %8, 16u
+        break_if %9 next_iteration: [ %8 ]  # -> [t: exit_loop loop_1, f: $B4]
+      }
+    }
+    ret
+  }
+}
+)";
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, NoModify_LoopVariantOperand) {
+    auto* func = b.Function("foo", ty.void_());
+    b.Append(func->Block(), [&] {
+        auto* loop = b.Loop();
+        b.Append(loop->Initializer(), [&] { b.NextIteration(loop, 0_i); });
+        auto* i = b.BlockParam<i32>("i");
+        loop->Body()->SetParams({i});
+        b.Append(loop->Body(), [&] {
+            auto* x = b.Multiply(i, 2_i);
+            b.Continue(loop, x);
+        });
+        auto* x = b.BlockParam<i32>("x");
+        loop->Continuing()->SetParams({x});
+        b.Append(loop->Continuing(), [&] {
+            b.BreakIf(loop, b.GreaterThan(x, 16_i), Vector{x}, Empty);
+        });
+        b.Return(func);
+    });
+
+    auto* src = R"(
+%foo = func():void {
+  $B1: {
+    loop [i: $B2, b: $B3, c: $B4] {  # loop_1
+      $B2: {  # initializer
+        next_iteration 0i  # -> $B3
+      }
+      $B3 (%i:i32): {  # body
+        %3:i32 = mul %i, 2i
+        continue %3  # -> $B4
+      }
+      $B4 (%x:i32): {  # continuing
+        %5:bool = gt %x, 16i
+        break_if %5 next_iteration: [ %x ]  # -> [t: exit_loop loop_1, f: $B3]
+      }
+    }
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, UniformLoad) {
+    auto* size = b.Var("size", ty.ptr<uniform, u32, read>());
+    size->SetBindingPoint(0, 0);
+    mod.root_block->Append(size);
+
+    auto* func = b.Function("foo", ty.u32());
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, u32>());
+        auto* loop = b.Loop();
+        b.Append(loop->Body(), [&] {
+            auto* n = b.Load(size);
+            auto* m = b.Add(n, 1_u);
+            b.Store(v, m);
+            auto* ifelse = b.If(b.GreaterThan(b.Load(v), 4_u));
+            b.Append(ifelse->True(), [&] { b.ExitLoop(loop); });
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] { b.NextIteration(loop); });
+        b.Return(func, b.Load(v));
+    });
+
+    auto* src = R"(
+$B1: {  # root
+  %size:ptr<uniform, u32, read> = var undef @binding_point(0, 0)
+}
+
+%foo = func():u32 {
+  $B2: {
+    %v:ptr<function, u32, read_write> = var undef
+    loop [b: $B3, c: $B4] {  # loop_1
+      $B3: {  # body
+        %4:u32 = load %size
+        %5:u32 = add %4, 1u
+        store %v, %5
+        %6:u32 = load %v
+        %7:bool = gt %6, 4u
+        if %7 [t: $B5] {  # if_1
+          $B5: {  # true
+            exit_loop  # loop_1
+          }
+        }
+        continue  # -> $B4
+      }
+      $B4: {  # continuing
+        next_iteration  # -> $B3
+      }
+    }
+    %8:u32 = load %v
+    ret %8
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+$B1: {  # root
+  %size:ptr<uniform, u32, read> = var undef @binding_point(0, 0)
+}
+
+%foo = func():u32 {
+  $B2: {
+    %v:ptr<function, u32, read_write> = var undef
+    %4:u32 = load %size
+    %5:u32 = add %4, 1u
+    loop [b: $B3, c: $B4] {  # loop_1
+      $B3: {  # body
+        store %v, %5
+        %6:u32 = load %v
+        %7:bool = gt %6, 4u
+        if %7 [t: $B5] {  # if_1
+          $B5: {  # true
+            exit_loop  # loop_1
+          }
+        }
+        continue  # -> $B4
+      }
+      $B4: {  # continuing
+        next_iteration  # -> $B3
+      }
+    }
+    %8:u32 = load %v
+    ret %8
+  }
+}
+)";
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, FunctionVarLoad_NotStoredInLoop) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* a = b.Var("a", ty.ptr<function, i32>());
+        auto* v = b.Var("v", ty.ptr<function, i32>());
+        auto* loop = b.Loop();
+        b.Append(loop->Body(), [&] {
+            auto* x = b.Load(a);
+            auto* y = b.Load(v);
+            b.Store(v, b.Add(y, x));
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] { b.BreakIf(loop, true); });
+        b.Return(func, b.Load(v));
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %a:ptr<function, i32, read_write> = var undef
+    %v:ptr<function, i32, read_write> = var undef
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        %4:i32 = load %a
+        %5:i32 = load %v
+        %6:i32 = add %5, %4
+        store %v, %6
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    %7:i32 = load %v
+    ret %7
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():i32 {
+  $B1: {
+    %a:ptr<function, i32, read_write> = var undef
+    %v:ptr<function, i32, read_write> = var undef
+    %4:i32 = load %a
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        %5:i32 = load %v
+        %6:i32 = add %5, %4
+        store %v, %6
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    %7:i32 = load %v
+    ret %7
+  }
+}
+)";
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, NoModify_FunctionVarLoad_StoredInLoop) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, vec2<i32>>());
+        auto* loop = b.Loop();
+        b.Append(loop->Body(), [&] {
+            auto* x = b.Load(v);
+            b.Continue(loop, b.Access(ty.i32(), x, 1_u));
+        });
+        auto* elem = b.BlockParam<i32>("elem");
+        loop->Continuing()->SetParams({elem});
+        b.Append(loop->Continuing(), [&] {
+            b.StoreVectorElement(v, 0_u, elem);
+            b.BreakIf(loop, true);
+        });
+        b.Return(func, b.LoadVectorElement(v, 0_u));
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %v:ptr<function, vec2<i32>, read_write> = var undef
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        %3:vec2<i32> = load %v
+        %4:i32 = access %3, 1u
+        continue %4  # -> $B3
+      }
+      $B3 (%elem:i32): {  # continuing
+        store_vector_element %v, 0u, %elem
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    %6:i32 = load_vector_element %v, 0u
+    ret %6
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, NoModify_FunctionVarLoad_UserCallInLoop) {
+    auto* callee = b.Function("bar", ty.void_());
+    b.Append(callee->Block(), [&] { b.Return(callee); });
+
+    auto* func = b.Function("foo", ty.i32());
+    auto* p = b.FunctionParam("p", ty.ptr<function, i32>());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* loop = b.Loop();
+        b.Append(loop->Body(), [&] {
+            b.Load(p);
+            b.Call(callee);
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] { b.BreakIf(loop, true); });
+        b.Return(func, b.Load(p));
+    });
+
+    auto* src = R"(
+%bar = func():void {
+  $B1: {
+    ret
+  }
+}
+%foo = func(%p:ptr<function, i32, read_write>):i32 {
+  $B2: {
+    loop [b: $B3, c: $B4] {  # loop_1
+      $B3: {  # body
+        %4:i32 = load %p
+        %5:void = call %bar
+        continue  # -> $B4
+      }
+      $B4: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B3]
+      }
+    }
+    %6:i32 = load %p
+    ret %6
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, NoModify_LoadAfterIf) {
+    auto* size = b.Var("size", ty.ptr<uniform, u32, read>());
+    size->SetBindingPoint(0, 0);
+    mod.root_block->Append(size);
+
+    auto* func = b.Function("foo", ty.u32());
+    auto* p = b.FunctionParam("p", ty.bool_());
+    func->SetParams({p});
+    b.Append(func->Block(), [&] {
+        auto* loop = b.Loop();
+        loop->SetResults(b.InstructionResult<u32>());
+        b.Append(loop->Body(), [&] {
+            auto* ifelse = b.If(p);
+            b.Append(ifelse->True(), [&] { b.ExitLoop(loop, 0_u); });
+            b.ExitLoop(loop, b.Load(size));
+        });
+        b.Return(func, loop->Result());
+    });
+
+    auto* src = R"(
+$B1: {  # root
+  %size:ptr<uniform, u32, read> = var undef @binding_point(0, 0)
+}
+
+%foo = func(%p:bool):u32 {
+  $B2: {
+    %4:u32 = loop [b: $B3] {  # loop_1
+      $B3: {  # body
+        if %p [t: $B4] {  # if_1
+          $B4: {  # true
+            exit_loop 0u  # loop_1
+          }
+        }
+        %5:u32 = load %size
+        exit_loop %5  # loop_1
+      }
+    }
+    ret %4
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, IntegerDivide) {
+    auto* func = b.Function("foo", ty.void_());
+    auto* p = b.FunctionParam("p", ty.i32());
+    auto* q = b.FunctionParam("q", ty.i32());
+    func->SetParams({p, q});
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, i32>());
+        auto* loop = b.Loop();
+        b.Append(loop->Body(), [&] {
+            // Can be hoisted.
+            auto* x = b.Divide(p, 4_i);
+            // Cannot be hoisted, as the divisor may be zero.
+            auto* y = b.Divide(p, q);
+            // Cannot be hoisted, as the modulo may overflow.
+            auto* z = b.Modulo(p, -1_i);
+            // Can be hoisted, as float division is always defined.
+            auto* w = b.Divide(1_f, b.Convert<f32>(q));
+            auto* xy = b.Add(x, y);
+            auto* zw = b.Add(z, b.Convert<i32>(w));
+            b.Store(v, b.Add(xy, zw));
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] { b.BreakIf(loop, true); });
+        b.Return(func);
+    });
+
+    auto* src = R"(
+%foo = func(%p:i32, %q:i32):void {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        %5:i32 = div %p, 4i
+        %6:i32 = div %p, %q
+        %7:i32 = mod %p, -1i
+        %8:f32 = convert %q
+        %9:f32 = div 1.0f, %8
+        %10:i32 = add %5, %6
+        %11:i32 = convert %9
+        %12:i32 = add %7, %11
+        %13:i32 = add %10, %12
+        store %v, %13
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%p:i32, %q:i32):void {
+  $B1: {
+    %v:ptr<function, i32, read_write> = var undef
+    %5:i32 = div %p, 4i
+    %6:f32 = convert %q
+    %7:f32 = div 1.0f, %6
+    %8:i32 = convert %7
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        %9:i32 = div %p, %q
+        %10:i32 = mod %p, -1i
+        %11:i32 = add %5, %9
+        %12:i32 = add %10, %8
+        %13:i32 = add %11, %12
+        store %v, %13
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret
+  }
+}
+)";
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, ConditionalInstructions) {
+    auto* func = b.Function("foo", ty.void_());
+    auto* p = b.FunctionParam("p", ty.bool_());
+    auto* q = b.FunctionParam("q", ty.u32());
+    auto* a = b.FunctionParam("a", ty.array<u32, 4>());
+    func->SetParams({p, q, a});
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, u32>());
+        auto* loop = b.Loop();
+        b.Append(loop->Body(), [&] {
+            auto* ifelse = b.If(p);
+            b.Append(ifelse->True(), [&] {
+                // Cannot be hoisted, as the index may be out of bounds.
+                auto* x = b.Access(ty.u32(), a, q);
+                // Can be hoisted, as the index is a constant in bounds.
+                auto* y = b.Access(ty.u32(), a, 1_u);
+                // Cannot be hoisted, as the shift amount may be too large.
+                auto* z = b.ShiftLeft(q, q);
+                // Can be hoisted, as the shift amount is a constant in range.
+                auto* w = b.ShiftLeft(q, 3_u);
+                auto* xy = b.Add(x, y);
+                auto* zw = b.Add(z, w);
+                b.Store(v, b.Add(xy, zw));
+                b.ExitIf(ifelse);
+            });
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] { b.BreakIf(loop, true); });
+        b.Return(func);
+    });
+
+    auto* src = R"(
+%foo = func(%p:bool, %q:u32, %a:array<u32, 4>):void {
+  $B1: {
+    %v:ptr<function, u32, read_write> = var undef
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        if %p [t: $B4] {  # if_1
+          $B4: {  # true
+            %6:u32 = access %a, %q
+            %7:u32 = access %a, 1u
+            %8:u32 = shl %q, %q
+            %9:u32 = shl %q, 3u
+            %10:u32 = add %6, %7
+            %11:u32 = add %8, %9
+            %12:u32 = add %10, %11
+            store %v, %12
+            exit_if  # if_1
+          }
+        }
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%p:bool, %q:u32, %a:array<u32, 4>):void {
+  $B1: {
+    %v:ptr<function, u32, read_write> = var undef
+    %6:u32 = access %a, 1u
+    %7:u32 = shl %q, 3u
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        if %p [t: $B4] {  # if_1
+          $B4: {  # true
+            %8:u32 = access %a, %q
+            %9:u32 = shl %q, %q
+            %10:u32 = add %8, %6
+            %11:u32 = add %9, %7
+            %12:u32 = add %10, %11
+            store %v, %12
+            exit_if  # if_1
+          }
+        }
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret
+  }
+}
+)";
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_LoopInvariantCodeMotionTest, NestedLoops) {
+    auto* buffer = b.Var("buffer", ty.ptr<storage, array<u32>, read>());
+    buffer->SetBindingPoint(0, 0);
+    mod.root_block->Append(buffer);
+
+    auto* func = b.Function("foo", ty.void_());
+    b.Append(func->Block(), [&] {
+        auto* v = b.Var("v", ty.ptr<function, u32>());
+        auto* outer = b.Loop();
+        b.Append(outer->Body(), [&] {
+            auto* inner = b.Loop();
+            b.Append(inner->Body(), [&] {
+                auto* len = b.Call<u32>(BuiltinFn::kArrayLength, buffer);
+                auto* limit = b.Subtract(len, 1_u);
+                auto* index = b.Call<u32>(BuiltinFn::kMin, b.Load(v), limit);
+                auto* elem = b.Load(b.Access(ty.ptr<storage, u32, read>(), buffer, index));
+                b.Store(v, elem);
+                b.Continue(inner);
+            });
+            b.Append(inner->Continuing(), [&] { b.BreakIf(inner, true); });
+            b.Continue(outer);
+        });
+        b.Append(outer->Continuing(), [&] { b.BreakIf(outer, true); });
+        b.Return(func);
+    });
+
+    auto* src = R"(
+$B1: {  # root
+  %buffer:ptr<storage, array<u32>, read> = var undef @binding_point(0, 0)
+}
+
+%foo = func():void {
+  $B2: {
+    %v:ptr<function, u32, read_write> = var undef
+    loop [b: $B3, c: $B4] {  # loop_1
+      $B3: {  # body
+        loop [b: $B5, c: $B6] {  # loop_2
+          $B5: {  # body
+            %4:u32 = arrayLength %buffer
+            %5:u32 = sub %4, 1u
+            %6:u32 = load %v
+            %7:u32 = min %6, %5
+            %8:ptr<storage, u32, read> = access %buffer, %7
+            %9:u32 = load %8
+            store %v, %9
+            continue  # -> $B6
+          }
+          $B6: {  # continuing
+            break_if true  # -> [t: exit_loop loop_2, f: $B5]
+          }
+        }
+        continue  # -> $B4
+      }
+      $B4: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B3]
+      }
+    }
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+$B1: {  # root
+  %buffer:ptr<storage, array<u32>, read> = var undef @binding_point(0, 0)
+}
+
+%foo = func():void {
+  $B2: {
+    %v:ptr<function, u32, read_write> = var undef
+    %4:u32 = arrayLength %buffer
+    %5:u32 = sub %4, 1u
+    loop [b: $B3, c: $B4] {  # loop_1
+      $B3: {  # body
+        loop [b: $B5, c: $B6] {  # loop_2
+          $B5: {  # body
+            %6:u32 = load %v
+            %7:u32 = min %6, %5
+            %8:ptr<storage, u32, read> = access %buffer, %7
+            %9:u32 = load %8
+            store %v, %9
+            continue  # -> $B6
+          }
+          $B6: {  # continuing
+            break_if true  # -> [t: exit_loop loop_2, f: $B5]
+          }
+        }
+        continue  # -> $B4
+      }
+      $B4: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B3]
+      }
+    }
+    ret
+  }
+}
+)";
+
+    Run(LoopInvariantCodeMotion);
+
+    EXPECT_EQ(expect, str());
+}
+
+}  // namespace
+}  // namespace tint::core::ir::transform
@@ -27,12 +27,15 @@
 
 #include "src/tint/lang/core/ir/validator.h"
 
+#include <chrono>
+
 #if TINT_ENABLE_IR_DUMPING
 #include <iostream>
 #endif
 
 #include "src/tint/lang/core/ir/disassembler.h"
 #include "src/tint/lang/core/ir/functional_validator.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/structural_validator.h"
 #include "src/tint/utils/text/styled_text_printer.h"
 
@@ -92,12 +95,23 @@ class Validator {
     diag::List diagnostics_;
 };
 
+/// Runs the validator on @p mod, recording the time spent with the module's pass timer, if any.
+Result<SuccessType> RunValidator(const Module& mod) {
+    if (!mod.pass_timer) {
+        return Validator(mod).Run();
+    }
+    auto start = std::chrono::steady_clock::now();
+    auto result = Validator(mod).Run();
+    mod.pass_timer->AddValidationTime(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start));
+    return result;
+}
+
 }  // namespace
 
 Result<SuccessType> Validate(const Module& mod, std::string_view msg) {
     DumpIRIfEnabled(mod, msg);
-    Validator v(mod);
-    return v.Run();
+    return RunValidator(mod);
 }
 
 void AssertValid(const Module& mod, std::string_view msg) {
@@ -105,8 +119,7 @@ void AssertValid(const Module& mod, std::string_view msg) {
 
 #if TINT_ENABLE_IR_VALIDATION_ASSERTS
     if (mod.enable_validation_asserts) {
-        Validator v(mod);
-        auto result = v.Run();
+        auto result = RunValidator(mod);
         if (result != Success) {
             TINT_ICE() << "\n========================================================="
                        << "\n== IR validation failed " << msg << ":"
@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <string>
 
+#include "src/tint/api/common/pass_timing.h"
 #include "src/tint/api/common/workgroup_info.h"
 
 namespace tint::glsl::writer {
@@ -53,6 +54,9 @@ struct Output {
 
     /// The workgroup size information, if the entry point was a compute shader
     WorkgroupInfo workgroup_info{};
+
+    /// The cost of each transform that ran, if the module had a pass timer attached
+    PassTimings pass_timings;
 };
 
 }  // namespace tint::glsl::writer
@@ -30,16 +30,19 @@
 #include <unordered_map>
 
 #include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/transform/array_length_from.h"
 #include "src/tint/lang/core/ir/transform/bgra8unorm_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binary_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binding_remapper.h"
 #include "src/tint/lang/core/ir/transform/block_decorated_structs.h"
 #include "src/tint/lang/core/ir/transform/builtin_polyfill.h"
+#include "src/tint/lang/core/ir/transform/common_subexpression_elimination.h"
 #include "src/tint/lang/core/ir/transform/conversion_polyfill.h"
 #include "src/tint/lang/core/ir/transform/decompose_access.h"
 #include "src/tint/lang/core/ir/transform/demote_to_helper.h"
 #include "src/tint/lang/core/ir/transform/direct_variable_access.h"
+#include "src/tint/lang/core/ir/transform/loop_invariant_code_motion.h"
 #include "src/tint/lang/core/ir/transform/multiplanar_external_texture.h"
 #include "src/tint/lang/core/ir/transform/prepare_immediate_data.h"
 #include "src/tint/lang/core/ir/transform/preserve_padding.h"
@@ -71,21 +74,25 @@
 namespace tint::glsl::writer {
 
 Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
-    TINT_CHECK_RESULT(core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
+    TINT_CHECK_PASS(module, "core.SingleEntryPoint",
+                    core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
 
-    TINT_CHECK_RESULT(
+    TINT_CHECK_PASS(
+        module, "core.SubstituteOverrides",
         core::ir::transform::SubstituteOverrides(module, options.substitute_overrides_config));
 
     // Must come before robustness.
-    TINT_CHECK_RESULT(core::ir::transform::PropagateBufferSizes(module));
+    TINT_CHECK_PASS(module, "core.PropagateBufferSizes",
+                    core::ir::transform::PropagateBufferSizes(module));
 
     // Must come before TextureBuiltinsFromUniform as it may add `textureNumLevels` calls.
     if (!options.disable_robustness) {
         core::ir::transform::RobustnessConfig config{};
         config.use_integer_range_analysis = !options.disable_integer_range_analysis;
-        TINT_CHECK_RESULT(core::ir::transform::Robustness(module, config));
+        TINT_CHECK_PASS(module, "core.Robustness", core::ir::transform::Robustness(module, config));
 
-        TINT_CHECK_RESULT(core::ir::transform::PreventInfiniteLoops(module));
+        TINT_CHECK_PASS(module, "core.PreventInfiniteLoops",
+                        core::ir::transform::PreventInfiniteLoops(module));
     }
 
     // PrepareImmediateData must come before any transform that needs internal immediate data.
@@ -108,19 +115,22 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
             options.depth_range_offsets.value().max, module.symbols.New("tint_frag_depth_max"),
             module.Types().f32()));
     }
-    TINT_CHECK_RESULT_UNWRAP(immediate_data_layout, core::ir::transform::PrepareImmediateData(
-                                                        module, immediate_data_config));
+    TINT_CHECK_PASS_UNWRAP(
+        immediate_data_layout, module, "core.PrepareImmediateData",
+        core::ir::transform::PrepareImmediateData(module, immediate_data_config));
 
     tint::transform::multiplanar::BindingsMap multiplanar_map{};
     RemapperData remapper_data{};
     PopulateBindingInfo(options, remapper_data, multiplanar_map);
-    TINT_CHECK_RESULT(core::ir::transform::BindingRemapper(module, remapper_data));
+    TINT_CHECK_PASS(module, "core.BindingRemapper",
+                    core::ir::transform::BindingRemapper(module, remapper_data));
 
     {
         core::ir::transform::BinaryPolyfillConfig binary_polyfills{};
         binary_polyfills.int_div_mod = !options.disable_polyfill_integer_div_mod;
         binary_polyfills.bitshift_modulo = true;  // crbug.com/tint/1543
-        TINT_CHECK_RESULT(core::ir::transform::BinaryPolyfill(module, binary_polyfills));
+        TINT_CHECK_PASS(module, "core.BinaryPolyfill",
+                        core::ir::transform::BinaryPolyfill(module, binary_polyfills));
     }
 
     {
@@ -138,21 +148,29 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         core_polyfills.pack_unpack_4x8 = true;
         core_polyfills.pack_4xu8_clamp = true;
         core_polyfills.abs_signed_int = true;
-        TINT_CHECK_RESULT(core::ir::transform::BuiltinPolyfill(module, core_polyfills));
+        TINT_CHECK_PASS(module, "core.BuiltinPolyfill",
+                        core::ir::transform::BuiltinPolyfill(module, core_polyfills));
     }
 
-    TINT_CHECK_RESULT(core::ir::transform::Bgra8UnormPolyfill(module));
+    TINT_CHECK_PASS(module, "core.Bgra8UnormPolyfill",
+                    core::ir::transform::Bgra8UnormPolyfill(module));
 
     {
         core::ir::transform::ConversionPolyfillConfig conversion_polyfills;
         conversion_polyfills.ftoi = true;
-        TINT_CHECK_RESULT(core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
+        TINT_CHECK_PASS(module, "core.ConversionPolyfill",
+                        core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
     }
 
-    TINT_CHECK_RESULT(core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
+    // The core polyfills destroy many of the instructions they replace. Free them before the
+    // backend-specific lowering walks the module.
+    module.Compact();
+
+    TINT_CHECK_PASS(module, "core.MultiplanarExternalTexture",
+                    core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
 
     // `PreservePadding` must run before `DirectVariableAccess`.
-    TINT_CHECK_RESULT(core::ir::transform::PreservePadding(module));
+    TINT_CHECK_PASS(module, "core.PreservePadding", core::ir::transform::PreservePadding(module));
 
     {
         // This must come after `MultiplanarExternalTexture` as it will insert functions with
@@ -160,7 +178,8 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         // buffer parameters.
         core::ir::transform::DirectVariableAccessConfig dva_config{};
         dva_config.transform_handle = core::ir::transform::HandleTransformLevel::kFull;
-        TINT_CHECK_RESULT(core::ir::transform::DirectVariableAccess(module, dva_config));
+        TINT_CHECK_PASS(module, "core.DirectVariableAccess",
+                        core::ir::transform::DirectVariableAccess(module, dva_config));
     }
 
     // DecomposeAccess must come before BlockDecoratedStructs, which will wrap the
@@ -170,9 +189,10 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
     // uniform buffer standard layout. Otherwise, only buffer type variables are decomposed.
     core::ir::transform::DecomposeAccessConfig decompose_config{.uniform =
                                                                     !options.use_uniform_buffers};
-    TINT_CHECK_RESULT(core::ir::transform::DecomposeAccess(module, decompose_config));
+    TINT_CHECK_PASS(module, "core.DecomposeAccess",
+                    core::ir::transform::DecomposeAccess(module, decompose_config));
     if (options.use_uniform_buffers) {
-        TINT_CHECK_RESULT(core::ir::transform::Std140(module));
+        TINT_CHECK_PASS(module, "core.Std140", core::ir::transform::Std140(module));
     }
 
     // Note, this must come after DecomposeAccess to support buffer_view.
@@ -200,71 +220,101 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
                 size_indices[bp] = index;
             }
         }
-        TINT_CHECK_RESULT(
+        TINT_CHECK_PASS(
+            module, "core.ArrayLengthFromUniform",
             core::ir::transform::ArrayLengthFromUniform(module, length_binding, size_indices));
     }
-    TINT_CHECK_RESULT(core::ir::transform::BlockDecoratedStructs(module));
+
+    // LoopInvariantCodeMotion must come straight after Robustness and the array length
+    // transforms, which emit clamps and buffer length queries inside loops, and before the backend
+    // polyfills replace them with dialect instructions that it does not hoist.
+    if (options.enable_loop_invariant_code_motion) {
+        TINT_CHECK_PASS(module, "core.LoopInvariantCodeMotion",
+                        core::ir::transform::LoopInvariantCodeMotion(module));
+    }
+
+    TINT_CHECK_PASS(module, "core.BlockDecoratedStructs",
+                    core::ir::transform::BlockDecoratedStructs(module));
 
     // RemoveUniformVectorComponentLoads is used to work around a Qualcomm driver bug.
     // See crbug.com/452350626.
-    TINT_CHECK_RESULT(core::ir::transform::RemoveUniformVectorComponentLoads(module));
+    TINT_CHECK_PASS(module, "core.RemoveUniformVectorComponentLoads",
+                    core::ir::transform::RemoveUniformVectorComponentLoads(module));
 
     // Note, this must come after remapping as it uses post-remapping indices for its options.
     // Note, this must come after DirectVariableAccess as it doesn't handle tracing through function
     // calls.
-    TINT_CHECK_RESULT(
+    TINT_CHECK_PASS(
+        module, "glsl.TextureBuiltinsFromUniform",
         raise::TextureBuiltinsFromUniform(module, options.texture_builtins_from_uniform));
 
     if (!options.disable_workgroup_init) {
-        TINT_CHECK_RESULT(core::ir::transform::ZeroInitWorkgroupMemory(module));
+        TINT_CHECK_PASS(module, "core.ZeroInitWorkgroupMemory",
+                        core::ir::transform::ZeroInitWorkgroupMemory(module));
     }
 
     // DemoteToHelper must come before any transform that introduces non-core instructions.
-    TINT_CHECK_RESULT(core::ir::transform::DemoteToHelper(module));
+    TINT_CHECK_PASS(module, "core.DemoteToHelper", core::ir::transform::DemoteToHelper(module));
 
-    TINT_CHECK_RESULT(raise::BinaryPolyfill(module));
+    TINT_CHECK_PASS(module, "glsl.BinaryPolyfill", raise::BinaryPolyfill(module));
     // Must come after zero-init as it will add builtins
-    TINT_CHECK_RESULT(raise::BuiltinPolyfill(module));
+    TINT_CHECK_PASS(module, "glsl.BuiltinPolyfill", raise::BuiltinPolyfill(module));
 
     {
         // Must come after DirectVariableAccess
         raise::TexturePolyfillConfig tex_config;
         tex_config.placeholder_sampler_bind_point = options.placeholder_sampler_bind_point;
-        TINT_CHECK_RESULT(raise::TexturePolyfill(module, tex_config));
+        TINT_CHECK_PASS(module, "glsl.TexturePolyfill", raise::TexturePolyfill(module, tex_config));
     }
 
     // must come before 'BitcastPolyfill' as this adds bitcasts
     core::ir::transform::SignedIntegerPolyfillConfig signed_integer_cfg{
         .signed_negation = true, .signed_arithmetic = true, .signed_shiftleft = true};
-    TINT_CHECK_RESULT(core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
+    TINT_CHECK_PASS(module, "core.SignedIntegerPolyfill",
+                    core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
 
-    TINT_CHECK_RESULT(core::ir::transform::VectorizeScalarMatrixConstructors(module));
-    TINT_CHECK_RESULT(core::ir::transform::RemoveContinueInSwitch(module));
+    TINT_CHECK_PASS(module, "core.VectorizeScalarMatrixConstructors",
+                    core::ir::transform::VectorizeScalarMatrixConstructors(module));
+    TINT_CHECK_PASS(module, "core.RemoveContinueInSwitch",
+                    core::ir::transform::RemoveContinueInSwitch(module));
 
-    TINT_CHECK_RESULT(raise::ShaderIO(
-        module, raise::ShaderIOConfig{immediate_data_layout, options.depth_range_offsets,
-                                      options.bgra_swizzle_locations}));
+    TINT_CHECK_PASS(module, "glsl.ShaderIO",
+                    raise::ShaderIO(module, raise::ShaderIOConfig{immediate_data_layout,
+                                                                  options.depth_range_offsets,
+                                                                  options.bgra_swizzle_locations}));
 
     // Must come after ShaderIO as it operates on module-scope `in` variables.
-    TINT_CHECK_RESULT(raise::OffsetFirstIndex(
-        module, raise::OffsetFirstIndexConfig{immediate_data_layout, options.first_vertex_offset,
-                                              options.first_instance_offset}));
+    TINT_CHECK_PASS(module, "glsl.OffsetFirstIndex",
+                    raise::OffsetFirstIndex(
+                        module, raise::OffsetFirstIndexConfig{immediate_data_layout,
+                                                              options.first_vertex_offset,
+                                                              options.first_instance_offset}));
 
-    TINT_CHECK_RESULT(core::ir::transform::DecomposeAccess(
-        module, {.immediate = true, .minimum_array_size = options.minimum_immediate_size}));
+    TINT_CHECK_PASS(
+        module, "core.DecomposeAccess",
+        core::ir::transform::DecomposeAccess(
+            module, {.immediate = true, .minimum_array_size = options.minimum_immediate_size}));
 
     // Must come after DecomposeImmediateAccess and BuiltinPolyfill as those can add bitcasts.
-    TINT_CHECK_RESULT(raise::BitcastPolyfill(module));
+    TINT_CHECK_PASS(module, "glsl.BitcastPolyfill", raise::BitcastPolyfill(module));
+
+    // CommonSubexpressionElimination must come after the polyfills and robustness, which emit
+    // redundant address and bounds arithmetic.
+    if (options.enable_common_subexpression_elimination) {
+        TINT_CHECK_PASS(module, "core.CommonSubexpressionElimination",
+                        core::ir::transform::CommonSubexpressionElimination(module));
+    }
 
     // These transforms need to be run last as various transforms introduce terminator arguments,
     // naming conflicts, and expressions that need to be explicitly not inlined.
-    TINT_CHECK_RESULT(core::ir::transform::RemoveTerminatorArgs(module));
-    TINT_CHECK_RESULT(core::ir::transform::RenameConflicts(module));
+    TINT_CHECK_PASS(module, "core.RemoveTerminatorArgs",
+                    core::ir::transform::RemoveTerminatorArgs(module));
+    TINT_CHECK_PASS(module, "core.RenameConflicts", core::ir::transform::RenameConflicts(module));
 
     {
         core::ir::transform::ValueToLetConfig cfg;
         cfg.replace_pointer_lets = true;
-        TINT_CHECK_RESULT(core::ir::transform::ValueToLet(module, cfg));
+        TINT_CHECK_PASS(module, "core.ValueToLet", core::ir::transform::ValueToLet(module, cfg));
     }
 
     return Success;
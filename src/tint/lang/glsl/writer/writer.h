@@ -32,6 +32,7 @@
 
 #include "src/tint/lang/glsl/writer/common/options.h"
 #include "src/tint/lang/glsl/writer/common/output.h"
+#include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/result.h"
 
 // Forward declarations
@@ -49,6 +50,14 @@ namespace tint::glsl::writer {
 /// @returns the resulting GLSL and supplementary information, or failure
 Result<Output> Generate(core::ir::Module& ir, const Options& options);
 
+/// Generate GLSL for each of the entry points named by @p options, concurrently.
+/// A clone of @p ir is made for each element of @p options, which is then raised and printed on a
+/// thread pool.
+/// @param ir the IR module to translate to GLSL
+/// @param options the configuration options for each of the entry points to generate
+/// @returns the result of generating each entry point, in the same order as @p options
+Vector<Result<Output>, 4> GenerateEntryPoints(core::ir::Module& ir, VectorRef<Options> options);
+
 }  // namespace tint::glsl::writer
 
 #endif  // SRC_TINT_LANG_GLSL_WRITER_WRITER_H_
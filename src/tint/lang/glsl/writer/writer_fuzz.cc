@@ -51,6 +51,8 @@ struct FuzzedOptions {
     bool use_array_length_from_uniform;
     std::unordered_set<uint32_t> bgra_swizzle_locations;
     SubstituteOverridesConfig substitute_overrides_config;
+    bool enable_common_subexpression_elimination;
+    bool enable_loop_invariant_code_motion;
 
     /// Reflect the fields of this class so that it can be used by tint::ForeachField()
     TINT_REFLECT(FuzzedOptions,
@@ -61,7 +63,9 @@ struct FuzzedOptions {
                  disable_polyfill_integer_div_mod,
                  use_array_length_from_uniform,
                  bgra_swizzle_locations,
-                 substitute_overrides_config);
+                 substitute_overrides_config,
+                 enable_common_subexpression_elimination,
+                 enable_loop_invariant_code_motion);
     TINT_REFLECT_HASH_CODE(FuzzedOptions);
 };
 
@@ -99,6 +103,9 @@ Result<SuccessType> IRFuzzer(core::ir::Module& module,
     options.strip_all_names = fuzzed_options.strip_all_names;
     options.disable_robustness = fuzzed_options.disable_robustness;
     options.disable_integer_range_analysis = !fuzzed_options.enable_integer_range_analysis;
+    options.enable_common_subexpression_elimination =
+        fuzzed_options.enable_common_subexpression_elimination;
+    options.enable_loop_invariant_code_motion = fuzzed_options.enable_loop_invariant_code_motion;
     options.disable_workgroup_init = fuzzed_options.disable_workgroup_init;
     options.disable_polyfill_integer_div_mod = fuzzed_options.disable_polyfill_integer_div_mod;
     options.use_array_length_from_uniform = fuzzed_options.use_array_length_from_uniform;
@@ -211,6 +211,12 @@ struct Options {
     /// Set to `true` to enable integer range analysis in robustness transform.
     bool disable_integer_range_analysis = false;
 
+    /// Set to `true` to remove redundant computation with common subexpression elimination.
+    bool enable_common_subexpression_elimination = false;
+
+    /// Set to `true` to hoist loop-invariant computation out of loops.
+    bool enable_loop_invariant_code_motion = false;
+
     /// Set to `true` to disable workgroup memory zero initialization
     bool disable_workgroup_init = false;
 
@@ -281,6 +287,8 @@ struct Options {
                  strip_all_names,
                  disable_robustness,
                  disable_integer_range_analysis,
+                 enable_common_subexpression_elimination,
+                 enable_loop_invariant_code_motion,
                  disable_workgroup_init,
                  truncate_interstage_variables,
                  disable_polyfill_integer_div_mod,
@@ -32,6 +32,7 @@
 #include <string>
 #include <unordered_set>
 
+#include "src/tint/api/common/pass_timing.h"
 #include "src/tint/api/common/workgroup_info.h"
 #include "src/tint/lang/core/ir/function.h"
 
@@ -72,6 +73,9 @@ struct Output {
 
     /// True if the shader uses instance_index
     bool has_instance_index = false;
+
+    /// The cost of each transform that ran, if the module had a pass timer attached
+    PassTimings pass_timings;
 };
 
 }  // namespace tint::hlsl::writer
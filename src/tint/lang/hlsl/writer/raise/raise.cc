@@ -32,6 +32,7 @@
 #include <utility>
 
 #include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/transform/array_length_from.h"
 #include "src/tint/lang/core/ir/transform/binary_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binding_remapper.h"
@@ -39,10 +40,12 @@
 #include "src/tint/lang/core/ir/transform/builtin_scalarize.h"
 #include "src/tint/lang/core/ir/transform/change_immediate_to_uniform.h"
 #include "src/tint/lang/core/ir/transform/collapse_subgroup_min_max.h"
+#include "src/tint/lang/core/ir/transform/common_subexpression_elimination.h"
 #include "src/tint/lang/core/ir/transform/conversion_polyfill.h"
 #include "src/tint/lang/core/ir/transform/decompose_access.h"
 #include "src/tint/lang/core/ir/transform/demote_to_helper.h"
 #include "src/tint/lang/core/ir/transform/direct_variable_access.h"
+#include "src/tint/lang/core/ir/transform/loop_invariant_code_motion.h"
 #include "src/tint/lang/core/ir/transform/multiplanar_external_texture.h"
 #include "src/tint/lang/core/ir/transform/prevent_infinite_loops.h"
 #include "src/tint/lang/core/ir/transform/propagate_buffer_sizes.h"
@@ -82,12 +85,15 @@
 namespace tint::hlsl::writer {
 
 Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
-    TINT_CHECK_RESULT(core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
+    TINT_CHECK_PASS(module, "core.SingleEntryPoint",
+                    core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
 
-    TINT_CHECK_RESULT(
+    TINT_CHECK_PASS(
+        module, "core.SubstituteOverrides",
         core::ir::transform::SubstituteOverrides(module, options.substitute_overrides_config));
 
-    TINT_CHECK_RESULT(core::ir::transform::PropagateBufferSizes(module));
+    TINT_CHECK_PASS(module, "core.PropagateBufferSizes",
+                    core::ir::transform::PropagateBufferSizes(module));
 
     // PopulateBindingRelatedOptions must come before PrepareImmediateData so that
     // buffer_sizes_offset is available when configuring immediate data.
@@ -161,18 +167,23 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
             module.Types().array(module.Types().u32(), buffer_offsets_array_elements_num)));
     }
 
-    TINT_CHECK_RESULT_UNWRAP(immediate_data_layout, core::ir::transform::PrepareImmediateData(
-                                                        module, immediate_data_config));
+    TINT_CHECK_PASS_UNWRAP(
+        immediate_data_layout, module, "core.PrepareImmediateData",
+        core::ir::transform::PrepareImmediateData(module, immediate_data_config));
 
-    TINT_CHECK_RESULT(core::ir::transform::BindingRemapper(module, remapper_data));
-    TINT_CHECK_RESULT(core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
+    TINT_CHECK_PASS(module, "core.BindingRemapper",
+                    core::ir::transform::BindingRemapper(module, remapper_data));
+    TINT_CHECK_PASS(module, "core.MultiplanarExternalTexture",
+                    core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
 
     // `LocalizeStructArrayAssignment` and `ReplaceNonIndexableMatVecStores` may insert additional
     // expressions before the assignments to arrays or vectors so it is better to add them before
     // `Robustness`.
     if (options.compiler == Options::Compiler::kFXC) {
-        TINT_CHECK_RESULT(raise::LocalizeStructArrayAssignment(module));
-        TINT_CHECK_RESULT(raise::ReplaceNonIndexableMatVecStores(module));
+        TINT_CHECK_PASS(module, "hlsl.LocalizeStructArrayAssignment",
+                        raise::LocalizeStructArrayAssignment(module));
+        TINT_CHECK_PASS(module, "hlsl.ReplaceNonIndexableMatVecStores",
+                        raise::ReplaceNonIndexableMatVecStores(module));
     }
 
     if (!options.disable_robustness) {
@@ -188,14 +199,16 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
 
         config.use_integer_range_analysis = !options.disable_integer_range_analysis;
 
-        TINT_CHECK_RESULT(core::ir::transform::Robustness(module, config));
+        TINT_CHECK_PASS(module, "core.Robustness", core::ir::transform::Robustness(module, config));
 
-        TINT_CHECK_RESULT(core::ir::transform::PreventInfiniteLoops(module));
+        TINT_CHECK_PASS(module, "core.PreventInfiniteLoops",
+                        core::ir::transform::PreventInfiniteLoops(module));
     }
 
     if (options.resource_table.has_value()) {
         hlsl::writer::raise::ResourceTableHelper helper;
-        TINT_CHECK_RESULT(
+        TINT_CHECK_PASS(
+            module, "core.ResourceTable",
             core::ir::transform::ResourceTable(module, options.resource_table.value(), &helper));
     }
 
@@ -203,7 +216,8 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         core::ir::transform::BinaryPolyfillConfig binary_polyfills{};
         binary_polyfills.int_div_mod = !options.disable_polyfill_integer_div_mod;
         binary_polyfills.bitshift_modulo = true;
-        TINT_CHECK_RESULT(core::ir::transform::BinaryPolyfill(module, binary_polyfills));
+        TINT_CHECK_PASS(module, "core.BinaryPolyfill",
+                        core::ir::transform::BinaryPolyfill(module, binary_polyfills));
     }
 
     {
@@ -232,17 +246,24 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         core_polyfills.texture_sample_base_clamp_to_edge_2d_f32 = true;
         core_polyfills.abs_signed_int = true;
         core_polyfills.subgroup_broadcast_f16 = options.workarounds.polyfill_subgroup_broadcast_f16;
-        TINT_CHECK_RESULT(core::ir::transform::BuiltinPolyfill(module, core_polyfills));
+        TINT_CHECK_PASS(module, "core.BuiltinPolyfill",
+                        core::ir::transform::BuiltinPolyfill(module, core_polyfills));
     }
 
     {
         core::ir::transform::ConversionPolyfillConfig conversion_polyfills{};
         conversion_polyfills.ftoi = true;
-        TINT_CHECK_RESULT(core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
+        TINT_CHECK_PASS(module, "core.ConversionPolyfill",
+                        core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
     }
 
+    // The core polyfills destroy many of the instructions they replace. Free them before the
+    // backend-specific lowering walks the module.
+    module.Compact();
+
     if (options.compiler == Options::Compiler::kFXC) {
-        TINT_CHECK_RESULT(raise::ReplaceDefaultOnlySwitch(module));
+        TINT_CHECK_PASS(module, "hlsl.ReplaceDefaultOnlySwitch",
+                        raise::ReplaceDefaultOnlySwitch(module));
     }
 
     // ArrayLength must run after Robustness, which introduces arrayLength calls.
@@ -252,25 +273,36 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         TINT_ASSERT(!array_length_from_uniform_options.ubo_binding.group &&
                     !array_length_from_uniform_options.ubo_binding.binding);
 
-        TINT_CHECK_RESULT(core::ir::transform::ArrayLengthFromImmediates(
-            module, immediate_data_layout,
-            array_length_from_uniform_options.buffer_sizes_offset.value(),
-            buffer_sizes_array_elements_num,
-            array_length_from_uniform_options.bindpoint_to_size_index));
+        TINT_CHECK_PASS(module, "core.ArrayLengthFromImmediates",
+                        core::ir::transform::ArrayLengthFromImmediates(
+                            module, immediate_data_layout,
+                            array_length_from_uniform_options.buffer_sizes_offset.value(),
+                            buffer_sizes_array_elements_num,
+                            array_length_from_uniform_options.bindpoint_to_size_index));
     } else {
         // Always fall back to ArrayLengthFromUniform when buffer_sizes_offset is not provided.
         // This preserves the behavior from before ArrayLengthFromImmediates was introduced,
         // ensuring that arrayLength() calls are properly handled even without explicit options.
-        TINT_CHECK_RESULT(core::ir::transform::ArrayLengthFromUniform(
-            module,
-            BindingPoint{array_length_from_uniform_options.ubo_binding.group,
-                         array_length_from_uniform_options.ubo_binding.binding},
-            array_length_from_uniform_options.bindpoint_to_size_index));
+        TINT_CHECK_PASS(module, "core.ArrayLengthFromUniform",
+                        core::ir::transform::ArrayLengthFromUniform(
+                            module,
+                            BindingPoint{array_length_from_uniform_options.ubo_binding.group,
+                                         array_length_from_uniform_options.ubo_binding.binding},
+                            array_length_from_uniform_options.bindpoint_to_size_index));
+    }
+
+    // LoopInvariantCodeMotion must come straight after Robustness and the array length
+    // transforms, which emit clamps and buffer length queries inside loops, and before the backend
+    // polyfills replace them with dialect instructions that it does not hoist.
+    if (options.enable_loop_invariant_code_motion) {
+        TINT_CHECK_PASS(module, "core.LoopInvariantCodeMotion",
+                        core::ir::transform::LoopInvariantCodeMotion(module));
     }
 
     if (!options.disable_workgroup_init) {
         // Must run before ShaderIO as it may introduce a builtin parameter (local_invocation_index)
-        TINT_CHECK_RESULT(core::ir::transform::ZeroInitWorkgroupMemory(module));
+        TINT_CHECK_PASS(module, "core.ZeroInitWorkgroupMemory",
+                        core::ir::transform::ZeroInitWorkgroupMemory(module));
     }
 
     const bool pixel_local_enabled = !options.pixel_local.attachments.empty();
@@ -290,32 +322,35 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
             .num_workgroups_start_offset = options.num_workgroups_start_offset,
         };
 
-        TINT_CHECK_RESULT(raise::ShaderIO(module, config));
+        TINT_CHECK_PASS(module, "hlsl.ShaderIO", raise::ShaderIO(module, config));
     }
 
-    TINT_CHECK_RESULT(raise::DecomposeSnorm10_10_10_2(module, options.snorm10_10_10_2_locations));
+    TINT_CHECK_PASS(module, "hlsl.DecomposeSnorm10_10_10_2",
+                    raise::DecomposeSnorm10_10_10_2(module, options.snorm10_10_10_2_locations));
 
     // DemoteToHelper must come before any transform that introduces non-core instructions.
     // Run after ShaderIO to ensure the discards are added to the entry point it introduces.
     // TODO(crbug.com/42250787): This is only necessary when FXC is being used.
     if (options.compiler == tint::hlsl::writer::Options::Compiler::kFXC) {
-        TINT_CHECK_RESULT(core::ir::transform::DemoteToHelper(module));
+        TINT_CHECK_PASS(module, "core.DemoteToHelper", core::ir::transform::DemoteToHelper(module));
     }
-    TINT_CHECK_RESULT(core::ir::transform::DirectVariableAccess(
-        module, core::ir::transform::DirectVariableAccessConfig{}));
+    TINT_CHECK_PASS(module, "core.DirectVariableAccess",
+                    core::ir::transform::DirectVariableAccess(
+                        module, core::ir::transform::DirectVariableAccessConfig{}));
 
     // Split workgroup variables that contain atomics into separate data and atomic variables.
     // Must run after DirectVariableAccess and before DecomposeAccess.
     if (options.workarounds.d3d12_decompose_workgroup_access) {
-        TINT_CHECK_RESULT(raise::SplitWorkgroupAtomics(module));
+        TINT_CHECK_PASS(module, "hlsl.SplitWorkgroupAtomics", raise::SplitWorkgroupAtomics(module));
     }
 
     // DecomposeStorageAccess must come after Robustness and DirectVariableAccess
-    TINT_CHECK_RESULT(raise::DecomposeStorageAccess(module));
+    TINT_CHECK_PASS(module, "hlsl.DecomposeStorageAccess", raise::DecomposeStorageAccess(module));
 
     // DecomposeAccess must come after DecomposeStorageAccess. No address spaces enabled. Just
     // decompose buffers.
-    TINT_CHECK_RESULT(core::ir::transform::DecomposeAccess(module, {}));
+    TINT_CHECK_PASS(module, "core.DecomposeAccess",
+                    core::ir::transform::DecomposeAccess(module, {}));
 
     // ArrayOffsetFrom* transforms must come after both DirectVariableAccess and
     // DecomposeStorageAccess, and BEFORE ChangeImmediateToUniform.
@@ -325,11 +360,12 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         TINT_ASSERT(!array_offset_from_uniform_options.ubo_binding.group &&
                     !array_offset_from_uniform_options.ubo_binding.binding);
 
-        TINT_CHECK_RESULT(raise::ArrayOffsetFromImmediates(
-            module, immediate_data_layout,
-            array_offset_from_uniform_options.buffer_offsets_offset.value(),
-            buffer_offsets_array_elements_num,
-            array_offset_from_uniform_options.bindpoint_to_offset_index));
+        TINT_CHECK_PASS(module, "hlsl.ArrayOffsetFromImmediates",
+                        raise::ArrayOffsetFromImmediates(
+                            module, immediate_data_layout,
+                            array_offset_from_uniform_options.buffer_offsets_offset.value(),
+                            buffer_offsets_array_elements_num,
+                            array_offset_from_uniform_options.bindpoint_to_offset_index));
     } else if (array_offset_from_uniform_options.ubo_binding.group ||
                array_offset_from_uniform_options.ubo_binding.binding) {
         // Fall back to ArrayOffsetFromUniform when UBO binding is provided.
@@ -343,18 +379,20 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         core::ir::transform::ChangeImmediateToUniformConfig config = {
             .immediate_binding_point = options.immediate_binding_point,
         };
-        TINT_CHECK_RESULT(core::ir::transform::ChangeImmediateToUniform(module, config));
+        TINT_CHECK_PASS(module, "core.ChangeImmediateToUniform",
+                        core::ir::transform::ChangeImmediateToUniform(module, config));
     }
 
     // ArrayOffsetFromUniform must come after ChangeImmediateToUniform, DirectVariableAccess, and
     // DecomposeStorageAccess.
     if (array_offset_from_uniform_options.ubo_binding.group ||
         array_offset_from_uniform_options.ubo_binding.binding) {
-        TINT_CHECK_RESULT(raise::ArrayOffsetFromUniform(
-            module,
-            BindingPoint{array_offset_from_uniform_options.ubo_binding.group,
-                         array_offset_from_uniform_options.ubo_binding.binding},
-            array_offset_from_uniform_options.bindpoint_to_offset_index));
+        TINT_CHECK_PASS(module, "hlsl.ArrayOffsetFromUniform",
+                        raise::ArrayOffsetFromUniform(
+                            module,
+                            BindingPoint{array_offset_from_uniform_options.ubo_binding.group,
+                                         array_offset_from_uniform_options.ubo_binding.binding},
+                            array_offset_from_uniform_options.bindpoint_to_offset_index));
     }
 
     // DecomposeAccess must come after DecomposeStorageAccess, ChangeImmediateToUniform, and
@@ -363,25 +401,28 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
     decompose_config.uniform = true;
     decompose_config.workgroup_subgroup_matrix = true;
     decompose_config.workgroup = options.workarounds.d3d12_decompose_workgroup_access;
-    TINT_CHECK_RESULT(core::ir::transform::DecomposeAccess(module, decompose_config));
+    TINT_CHECK_PASS(module, "core.DecomposeAccess",
+                    core::ir::transform::DecomposeAccess(module, decompose_config));
 
     // PixelLocal must run after DirectVariableAccess to avoid chasing pointer parameters.
     if (pixel_local_enabled) {
         raise::PixelLocalConfig config;
         config.options = options.pixel_local;
-        TINT_CHECK_RESULT(raise::PixelLocal(module, config));
+        TINT_CHECK_PASS(module, "hlsl.PixelLocal", raise::PixelLocal(module, config));
     }
 
     if (options.workarounds.collapse_subgroup_min_max) {
-        TINT_CHECK_RESULT(core::ir::transform::CollapseSubgroupMinMax(module));
+        TINT_CHECK_PASS(module, "core.CollapseSubgroupMinMax",
+                        core::ir::transform::CollapseSubgroupMinMax(module));
     }
 
-    TINT_CHECK_RESULT(raise::BinaryPolyfill(module));
+    TINT_CHECK_PASS(module, "hlsl.BinaryPolyfill", raise::BinaryPolyfill(module));
 
     // Avoid potential UB (aka signed overflow) by performing unsigned integer arithmetic.
     core::ir::transform::SignedIntegerPolyfillConfig signed_integer_cfg{
         .signed_negation = true, .signed_arithmetic = true, .signed_shiftleft = true};
-    TINT_CHECK_RESULT(core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
+    TINT_CHECK_PASS(module, "core.SignedIntegerPolyfill",
+                    core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
 
     // BuiltinPolyfill must come after BinaryPolyfill and DecomposeStorageAccess as they add
     // builtins
@@ -389,34 +430,46 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         raise::BuiltinPolyfillConfig config;
         config.polyfill_trunc = (options.compiler == Options::Compiler::kFXC);
         config.use_hlsl_2021_select = (options.compiler == Options::Compiler::kDXC_2021);
-        TINT_CHECK_RESULT(raise::BuiltinPolyfill(module, config));
+        TINT_CHECK_PASS(module, "hlsl.BuiltinPolyfill", raise::BuiltinPolyfill(module, config));
     }
-    TINT_CHECK_RESULT(core::ir::transform::VectorizeScalarMatrixConstructors(module));
-    TINT_CHECK_RESULT(core::ir::transform::RemoveContinueInSwitch(module));
+    TINT_CHECK_PASS(module, "core.VectorizeScalarMatrixConstructors",
+                    core::ir::transform::VectorizeScalarMatrixConstructors(module));
+    TINT_CHECK_PASS(module, "core.RemoveContinueInSwitch",
+                    core::ir::transform::RemoveContinueInSwitch(module));
 
     // ExtractTernaryValues must come after BuiltinPolyfill because that's what introduces the
     // ternary builtins.
-    TINT_CHECK_RESULT(raise::ExtractTernaryValues(module));
+    TINT_CHECK_PASS(module, "hlsl.ExtractTernaryValues", raise::ExtractTernaryValues(module));
 
-    TINT_CHECK_RESULT(raise::ReplaceSubgroupMatrixInit(module));
+    TINT_CHECK_PASS(module, "hlsl.ReplaceSubgroupMatrixInit",
+                    raise::ReplaceSubgroupMatrixInit(module));
 
     core::ir::transform::BuiltinScalarizeConfig scalarize_config{
         .scalarize_min_max_clamp = options.workarounds.scalarize_max_min_clamp,
     };
-    TINT_CHECK_RESULT(core::ir::transform::BuiltinScalarize(module, scalarize_config));
+    TINT_CHECK_PASS(module, "core.BuiltinScalarize",
+                    core::ir::transform::BuiltinScalarize(module, scalarize_config));
+
+    // CommonSubexpressionElimination must come after the polyfills and robustness, which emit
+    // redundant address and bounds arithmetic.
+    if (options.enable_common_subexpression_elimination) {
+        TINT_CHECK_PASS(module, "core.CommonSubexpressionElimination",
+                        core::ir::transform::CommonSubexpressionElimination(module));
+    }
 
     // These transforms need to be run last as various transforms introduce terminator arguments,
     // naming conflicts, and expressions that need to be explicitly not inlined.
-    TINT_CHECK_RESULT(core::ir::transform::RemoveTerminatorArgs(module));
-    TINT_CHECK_RESULT(core::ir::transform::RenameConflicts(module));
+    TINT_CHECK_PASS(module, "core.RemoveTerminatorArgs",
+                    core::ir::transform::RemoveTerminatorArgs(module));
+    TINT_CHECK_PASS(module, "core.RenameConflicts", core::ir::transform::RenameConflicts(module));
     {
         core::ir::transform::ValueToLetConfig cfg;
         cfg.replace_pointer_lets = true;
-        TINT_CHECK_RESULT(core::ir::transform::ValueToLet(module, cfg));
+        TINT_CHECK_PASS(module, "core.ValueToLet", core::ir::transform::ValueToLet(module, cfg));
     }
 
     // Anything which runs after this needs to handle `Property::kAllowModuleScopedLets`
-    TINT_CHECK_RESULT(raise::PromoteInitializers(module));
+    TINT_CHECK_PASS(module, "hlsl.PromoteInitializers", raise::PromoteInitializers(module));
 
     return Success;
 }
@@ -27,9 +27,11 @@
 
 #include "src/tint/lang/hlsl/writer/writer.h"
 
+#include "src/tint/lang/core/ir/clone_module.h"
 #include "src/tint/lang/core/ir/core_builtin_call.h"
 #include "src/tint/lang/core/ir/function.h"
 #include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/referenced_module_vars.h"
 #include "src/tint/lang/core/ir/validator.h"
 #include "src/tint/lang/core/ir/var.h"
@@ -196,7 +198,19 @@ Result<Output> Generate(core::ir::Module& ir, const Options& options) {
     // Raise the core-dialect to HLSL-dialect
     TINT_CHECK_RESULT(Raise(ir, options));
 
-    return Print(ir, options);
+    if (ir.pass_timer) {
+        ir.pass_timer->Begin(ir, "hlsl.Print");
+    }
+    TINT_CHECK_RESULT_UNWRAP(result, Print(ir, options));
+    if (ir.pass_timer) {
+        ir.pass_timer->End(ir);
+        result.pass_timings = ir.pass_timer->Timings();
+    }
+    return result;
+}
+
+Vector<Result<Output>, 4> GenerateEntryPoints(core::ir::Module& ir, VectorRef<Options> options) {
+    return core::ir::GenerateForEachClone(ir, options, Generate);
 }
 
 }  // namespace tint::hlsl::writer
@@ -66,6 +66,8 @@ struct FuzzedOptions {
     SubstituteOverridesConfig substitute_overrides_config;
     bool d3d12_decompose_workgroup_access;
     bool collapse_subgroup_min_max;
+    bool enable_common_subexpression_elimination;
+    bool enable_loop_invariant_code_motion;
 
     /// Reflect the fields of this class so that it can be used by tint::ForeachField()
     TINT_REFLECT(FuzzedOptions,
@@ -88,7 +90,9 @@ struct FuzzedOptions {
                  ignored_by_robustness_transform,
                  substitute_overrides_config,
                  d3d12_decompose_workgroup_access,
-                 collapse_subgroup_min_max);
+                 collapse_subgroup_min_max,
+                 enable_common_subexpression_elimination,
+                 enable_loop_invariant_code_motion);
 };
 
 Result<SuccessType> IRFuzzer(core::ir::Module& module,
@@ -126,6 +130,9 @@ Result<SuccessType> IRFuzzer(core::ir::Module& module,
     options.strip_all_names = fuzzed_options.strip_all_names;
     options.disable_robustness = fuzzed_options.disable_robustness;
     options.disable_integer_range_analysis = !fuzzed_options.enable_integer_range_analysis;
+    options.enable_common_subexpression_elimination =
+        fuzzed_options.enable_common_subexpression_elimination;
+    options.enable_loop_invariant_code_motion = fuzzed_options.enable_loop_invariant_code_motion;
     options.disable_workgroup_init = fuzzed_options.disable_workgroup_init;
     options.truncate_interstage_variables = fuzzed_options.truncate_interstage_variables;
     options.disable_polyfill_integer_div_mod = fuzzed_options.disable_polyfill_integer_div_mod;
@@ -32,6 +32,7 @@
 #include <string>
 #include <vector>
 
+#include "src/tint/api/common/pass_timing.h"
 #include "src/tint/api/common/workgroup_info.h"
 
 namespace tint::msl::writer {
@@ -67,6 +68,9 @@ struct Output {
     /// Each entry in the vector is the size of the workgroup allocation that
     /// should be created for that index.
     std::vector<uint32_t> workgroup_allocations;
+
+    /// The cost of each transform that ran, if the module had a pass timer attached
+    PassTimings pass_timings;
 };
 
 }  // namespace tint::msl::writer
@@ -32,6 +32,7 @@
 
 #include "src/tint/api/common/binding_point.h"
 #include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/transform/array_length_from.h"
 #include "src/tint/lang/core/ir/transform/binary_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binding_remapper.h"
@@ -39,8 +40,10 @@
 #include "src/tint/lang/core/ir/transform/builtin_scalarize.h"
 #include "src/tint/lang/core/ir/transform/change_immediate_to_uniform.h"
 #include "src/tint/lang/core/ir/transform/collapse_subgroup_min_max.h"
+#include "src/tint/lang/core/ir/transform/common_subexpression_elimination.h"
 #include "src/tint/lang/core/ir/transform/conversion_polyfill.h"
 #include "src/tint/lang/core/ir/transform/demote_to_helper.h"
+#include "src/tint/lang/core/ir/transform/loop_invariant_code_motion.h"
 #include "src/tint/lang/core/ir/transform/multiplanar_external_texture.h"
 #include "src/tint/lang/core/ir/transform/prepare_immediate_data.h"
 #include "src/tint/lang/core/ir/transform/preserve_padding.h"
@@ -80,23 +83,26 @@
 namespace tint::msl::writer {
 
 Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
-    TINT_CHECK_RESULT(core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
+    TINT_CHECK_PASS(module, "core.SingleEntryPoint",
+                    core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
 
-    TINT_CHECK_RESULT(
+    TINT_CHECK_PASS(
+        module, "core.SubstituteOverrides",
         core::ir::transform::SubstituteOverrides(module, options.substitute_overrides_config));
 
-    TINT_CHECK_RESULT(raise::ValidateSubgroupMatrix(module));
+    TINT_CHECK_PASS(module, "msl.ValidateSubgroupMatrix", raise::ValidateSubgroupMatrix(module));
 
     if (options.workarounds.collapse_subgroup_min_max) {
-        TINT_CHECK_RESULT(core::ir::transform::CollapseSubgroupMinMax(module));
+        TINT_CHECK_PASS(module, "core.CollapseSubgroupMinMax",
+                        core::ir::transform::CollapseSubgroupMinMax(module));
     }
 
     RaiseResult raise_result;
 
     // VertexPulling must come before BindingRemapper and Robustness.
     if (options.vertex_pulling_config) {
-        TINT_CHECK_RESULT(
-            core::ir::transform::VertexPulling(module, *options.vertex_pulling_config));
+        TINT_CHECK_PASS(module, "core.VertexPulling",
+                        core::ir::transform::VertexPulling(module, *options.vertex_pulling_config));
     }
 
     // Populate binding-related options before prepare immediate data transform
@@ -135,26 +141,31 @@ Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
         options.non_constant_zero_offset, module.symbols.New("tint_non_constant_zero"),
         module.Types().u32()));
 
-    TINT_CHECK_RESULT_UNWRAP(immediate_data_layout, core::ir::transform::PrepareImmediateData(
-                                                        module, immediate_data_config));
-    TINT_CHECK_RESULT(core::ir::transform::BindingRemapper(module, remapper_data));
+    TINT_CHECK_PASS_UNWRAP(
+        immediate_data_layout, module, "core.PrepareImmediateData",
+        core::ir::transform::PrepareImmediateData(module, immediate_data_config));
+    TINT_CHECK_PASS(module, "core.BindingRemapper",
+                    core::ir::transform::BindingRemapper(module, remapper_data));
 
     // Must come before robustness.
-    TINT_CHECK_RESULT(core::ir::transform::PropagateBufferSizes(module));
+    TINT_CHECK_PASS(module, "core.PropagateBufferSizes",
+                    core::ir::transform::PropagateBufferSizes(module));
 
     if (!options.disable_robustness) {
         core::ir::transform::RobustnessConfig config{};
         config.use_integer_range_analysis = !options.disable_integer_range_analysis;
-        TINT_CHECK_RESULT(core::ir::transform::Robustness(module, config));
+        TINT_CHECK_PASS(module, "core.Robustness", core::ir::transform::Robustness(module, config));
 
-        TINT_CHECK_RESULT(core::ir::transform::PreventInfiniteLoops(module));
+        TINT_CHECK_PASS(module, "core.PreventInfiniteLoops",
+                        core::ir::transform::PreventInfiniteLoops(module));
     }
 
     {
         core::ir::transform::BinaryPolyfillConfig binary_polyfills{};
         binary_polyfills.int_div_mod = !options.disable_polyfill_integer_div_mod;
         binary_polyfills.bitshift_modulo = true;  // crbug.com/tint/1543
-        TINT_CHECK_RESULT(core::ir::transform::BinaryPolyfill(module, binary_polyfills));
+        TINT_CHECK_PASS(module, "core.BinaryPolyfill",
+                        core::ir::transform::BinaryPolyfill(module, binary_polyfills));
     }
 
     {
@@ -173,21 +184,28 @@ Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
             .pack_4xu8_clamp = true,
             .subgroup_broadcast_f16 = options.workarounds.polyfill_subgroup_broadcast_f16,
         };
-        TINT_CHECK_RESULT(core::ir::transform::BuiltinPolyfill(module, core_polyfills));
+        TINT_CHECK_PASS(module, "core.BuiltinPolyfill",
+                        core::ir::transform::BuiltinPolyfill(module, core_polyfills));
     }
 
     {
         core::ir::transform::ConversionPolyfillConfig conversion_polyfills;
         conversion_polyfills.ftoi = true;
-        TINT_CHECK_RESULT(core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
+        TINT_CHECK_PASS(module, "core.ConversionPolyfill",
+                        core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
     }
 
-    TINT_CHECK_RESULT(core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
+    // The core polyfills destroy many of the instructions they replace. Free them before the
+    // backend-specific lowering walks the module.
+    module.Compact();
+
+    TINT_CHECK_PASS(module, "core.MultiplanarExternalTexture",
+                    core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
 
     // TODO(crbug.com/366291600): Replace ArrayLengthFromUniform with ArrayLengthFromImmediates
     if (array_length_from_constants.ubo_binding) {
-        TINT_CHECK_RESULT_UNWRAP(
-            array_length_from_uniform_result,
+        TINT_CHECK_PASS_UNWRAP(
+            array_length_from_uniform_result, module, "core.ArrayLengthFromUniform",
             core::ir::transform::ArrayLengthFromUniform(
                 module, BindingPoint{0u, array_length_from_constants.ubo_binding.value()},
                 array_length_from_constants.bindpoint_to_size_index));
@@ -197,44 +215,60 @@ Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
 
     if (array_length_from_constants.buffer_sizes_offset) {
         TINT_IR_ASSERT(module, !array_length_from_constants.ubo_binding);
-        TINT_CHECK_RESULT_UNWRAP(array_length_from_immediate_result,
-                                 core::ir::transform::ArrayLengthFromImmediates(
-                                     module, immediate_data_layout,
-                                     array_length_from_constants.buffer_sizes_offset.value(),
-                                     buffer_sizes_array_elements_num,
-                                     array_length_from_constants.bindpoint_to_size_index));
+        TINT_CHECK_PASS_UNWRAP(array_length_from_immediate_result, module,
+                               "core.ArrayLengthFromImmediates",
+                               core::ir::transform::ArrayLengthFromImmediates(
+                                   module, immediate_data_layout,
+                                   array_length_from_constants.buffer_sizes_offset.value(),
+                                   buffer_sizes_array_elements_num,
+                                   array_length_from_constants.bindpoint_to_size_index));
         raise_result.needs_storage_buffer_sizes =
             array_length_from_immediate_result.needs_storage_buffer_sizes;
     }
 
-    TINT_CHECK_RESULT(raise::DecomposeBuffer(module));
+    // LoopInvariantCodeMotion must come straight after Robustness and the array length
+    // transforms, which emit clamps and buffer length queries inside loops, and before the backend
+    // polyfills replace them with dialect instructions that it does not hoist.
+    if (options.enable_loop_invariant_code_motion) {
+        TINT_CHECK_PASS(module, "core.LoopInvariantCodeMotion",
+                        core::ir::transform::LoopInvariantCodeMotion(module));
+    }
+
+    TINT_CHECK_PASS(module, "msl.DecomposeBuffer", raise::DecomposeBuffer(module));
 
     if (!options.disable_workgroup_init) {
-        TINT_CHECK_RESULT(core::ir::transform::ZeroInitWorkgroupMemory(module));
+        TINT_CHECK_PASS(module, "core.ZeroInitWorkgroupMemory",
+                        core::ir::transform::ZeroInitWorkgroupMemory(module));
     }
 
-    TINT_CHECK_RESULT(core::ir::transform::PreservePadding(module));
-    TINT_CHECK_RESULT(core::ir::transform::VectorizeScalarMatrixConstructors(module));
-    TINT_CHECK_RESULT(core::ir::transform::RemoveContinueInSwitch(module));
+    TINT_CHECK_PASS(module, "core.PreservePadding", core::ir::transform::PreservePadding(module));
+    TINT_CHECK_PASS(module, "core.VectorizeScalarMatrixConstructors",
+                    core::ir::transform::VectorizeScalarMatrixConstructors(module));
+    TINT_CHECK_PASS(module, "core.RemoveContinueInSwitch",
+                    core::ir::transform::RemoveContinueInSwitch(module));
 
     // DemoteToHelper must come before any transform that introduces non-core instructions.
     if (!options.extensions.disable_demote_to_helper) {
-        TINT_CHECK_RESULT(core::ir::transform::DemoteToHelper(module));
+        TINT_CHECK_PASS(module, "core.DemoteToHelper", core::ir::transform::DemoteToHelper(module));
     }
 
     // ConvertPrintToLog must come before ShaderIO as it may introduce entry point builtins.
-    TINT_CHECK_RESULT(raise::ConvertPrintToLog(module));
+    TINT_CHECK_PASS(module, "msl.ConvertPrintToLog", raise::ConvertPrintToLog(module));
 
-    TINT_CHECK_RESULT(raise::ShaderIO(
-        module, raise::ShaderIOConfig{immediate_data_layout, options.emit_vertex_point_size,
-                                      options.fixed_sample_mask, options.depth_range_offsets}));
+    TINT_CHECK_PASS(
+        module, "msl.ShaderIO",
+        raise::ShaderIO(module,
+                        raise::ShaderIOConfig{immediate_data_layout, options.emit_vertex_point_size,
+                                              options.fixed_sample_mask,
+                                              options.depth_range_offsets}));
 
     raise::FixTypeLayoutConfig fix_type_layout_options{
         .replace_bool_with_u32 = options.workarounds.replace_workgroup_bool_with_u32,
     };
-    TINT_CHECK_RESULT(raise::FixTypeLayout(module, fix_type_layout_options));
+    TINT_CHECK_PASS(module, "msl.FixTypeLayout",
+                    raise::FixTypeLayout(module, fix_type_layout_options));
 
-    TINT_CHECK_RESULT(raise::SimdBallot(module));
+    TINT_CHECK_PASS(module, "msl.SimdBallot", raise::SimdBallot(module));
 
     // ArgumentBuffers must come before ModuleScopeVars
     if (options.use_argument_buffers) {
@@ -262,7 +296,7 @@ Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
                 cfg.skip_bindings.insert(bp);
             }
         }
-        TINT_CHECK_RESULT(raise::ArgumentBuffers(module, cfg));
+        TINT_CHECK_PASS(module, "msl.ArgumentBuffers", raise::ArgumentBuffers(module, cfg));
     }
 
     if (options.workarounds.fix_u32_div_mod) {
@@ -271,7 +305,7 @@ Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
             .non_constant_zero_index =
                 immediate_data_layout.IndexOf(options.non_constant_zero_offset),
         };
-        TINT_CHECK_RESULT(raise::FixU32DivMod(module, config));
+        TINT_CHECK_PASS(module, "msl.FixU32DivMod", raise::FixU32DivMod(module, config));
     }
 
     // ChangeImmediateToUniform must come before ModuleScopeVars
@@ -279,46 +313,61 @@ Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
         core::ir::transform::ChangeImmediateToUniformConfig config = {
             .immediate_binding_point = options.immediate_binding_point,
         };
-        TINT_CHECK_RESULT(core::ir::transform::ChangeImmediateToUniform(module, config));
+        TINT_CHECK_PASS(module, "core.ChangeImmediateToUniform",
+                        core::ir::transform::ChangeImmediateToUniform(module, config));
     }
 
-    TINT_CHECK_RESULT(raise::ModuleScopeVars(module));
+    TINT_CHECK_PASS(module, "msl.ModuleScopeVars", raise::ModuleScopeVars(module));
 
-    TINT_CHECK_RESULT(raise::BinaryPolyfill(module));
+    TINT_CHECK_PASS(module, "msl.BinaryPolyfill", raise::BinaryPolyfill(module));
 
-    TINT_CHECK_RESULT(raise::BuiltinPolyfill(
-        module, {
-                    .polyfill_unpack_2x16_snorm = options.workarounds.polyfill_unpack_2x16_snorm,
-                    .polyfill_unpack_2x16_unorm = options.workarounds.polyfill_unpack_2x16_unorm,
-                    .polyfill_tanh_f16 = options.workarounds.polyfill_tanh_f16,
-                }));
+    {
+        raise::BuiltinPolyfillConfig config = {
+            .polyfill_unpack_2x16_snorm = options.workarounds.polyfill_unpack_2x16_snorm,
+            .polyfill_unpack_2x16_unorm = options.workarounds.polyfill_unpack_2x16_unorm,
+            .polyfill_tanh_f16 = options.workarounds.polyfill_tanh_f16,
+        };
+        TINT_CHECK_PASS(module, "msl.BuiltinPolyfill", raise::BuiltinPolyfill(module, config));
+    }
     // After 'BuiltinPolyfill' as that transform can introduce signed dot products.
     core::ir::transform::SignedIntegerPolyfillConfig signed_integer_cfg{
         .signed_negation = true, .signed_arithmetic = true, .signed_shiftleft = true};
-    TINT_CHECK_RESULT(core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
+    TINT_CHECK_PASS(module, "core.SignedIntegerPolyfill",
+                    core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
 
     core::ir::transform::BuiltinScalarizeConfig scalarize_config{
         .scalarize_min_max_clamp = options.workarounds.scalarize_max_min_clamp,
     };
-    TINT_CHECK_RESULT(core::ir::transform::BuiltinScalarize(module, scalarize_config));
+    TINT_CHECK_PASS(module, "core.BuiltinScalarize",
+                    core::ir::transform::BuiltinScalarize(module, scalarize_config));
 
     raise::ModuleConstantConfig module_const_config{
         options.workarounds.disable_module_constant_f16};
-    TINT_CHECK_RESULT(raise::ModuleConstant(module, module_const_config));
+    TINT_CHECK_PASS(module, "msl.ModuleConstant",
+                    raise::ModuleConstant(module, module_const_config));
 
-    TINT_CHECK_RESULT(raise::SwitchReturn(module));
+    TINT_CHECK_PASS(module, "msl.SwitchReturn", raise::SwitchReturn(module));
 
     if (options.workarounds.polyfill_bool_vec_dynamic_store) {
-        TINT_CHECK_RESULT(raise::PolyfillBoolVectorDynamicStores(module));
+        TINT_CHECK_PASS(module, "msl.PolyfillBoolVectorDynamicStores",
+                        raise::PolyfillBoolVectorDynamicStores(module));
+    }
+
+    // CommonSubexpressionElimination must come after the polyfills and robustness, which emit
+    // redundant address and bounds arithmetic.
+    if (options.enable_common_subexpression_elimination) {
+        TINT_CHECK_PASS(module, "core.CommonSubexpressionElimination",
+                        core::ir::transform::CommonSubexpressionElimination(module));
     }
 
     // These transforms need to be run last as various transforms introduce terminator arguments,
     // naming conflicts, and expressions that need to be explicitly not inlined.
-    TINT_CHECK_RESULT(core::ir::transform::RemoveTerminatorArgs(module));
-    TINT_CHECK_RESULT(core::ir::transform::RenameConflicts(module));
+    TINT_CHECK_PASS(module, "core.RemoveTerminatorArgs",
+                    core::ir::transform::RemoveTerminatorArgs(module));
+    TINT_CHECK_PASS(module, "core.RenameConflicts", core::ir::transform::RenameConflicts(module));
     {
         core::ir::transform::ValueToLetConfig cfg;
-        TINT_CHECK_RESULT(core::ir::transform::ValueToLet(module, cfg));
+        TINT_CHECK_PASS(module, "core.ValueToLet", core::ir::transform::ValueToLet(module, cfg));
     }
 
     return raise_result;
@@ -27,8 +27,10 @@
 
 #include "src/tint/lang/msl/writer/writer.h"
 
+#include "src/tint/lang/core/ir/clone_module.h"
 #include "src/tint/lang/core/ir/core_builtin_call.h"
 #include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/referenced_module_vars.h"
 #include "src/tint/lang/core/ir/validator.h"
 #include "src/tint/lang/core/ir/var.h"
@@ -225,10 +227,21 @@ Result<Output> Generate(core::ir::Module& ir, const Options& options) {
 
     // Raise from core-dialect to MSL-dialect.
     TINT_CHECK_RESULT_UNWRAP(raise_result, Raise(ir, options));
+    if (ir.pass_timer) {
+        ir.pass_timer->Begin(ir, "msl.Print");
+    }
     TINT_CHECK_RESULT_UNWRAP(result, Print(ir, options));
+    if (ir.pass_timer) {
+        ir.pass_timer->End(ir);
+        result.pass_timings = ir.pass_timer->Timings();
+    }
 
     result.needs_storage_buffer_sizes = raise_result.needs_storage_buffer_sizes;
     return result;
 }
 
+Vector<Result<Output>, 4> GenerateEntryPoints(core::ir::Module& ir, VectorRef<Options> options) {
+    return core::ir::GenerateForEachClone(ir, options, Generate);
+}
+
 }  // namespace tint::msl::writer
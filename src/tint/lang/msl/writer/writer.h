@@ -32,6 +32,7 @@
 
 #include "src/tint/lang/msl/writer/common/options.h"
 #include "src/tint/lang/msl/writer/common/output.h"
+#include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/result.h"
 
 // Forward declarations
@@ -48,6 +49,14 @@ namespace tint::msl::writer {
 /// @returns the resulting MSL and supplementary information, or failure
 Result<Output> Generate(core::ir::Module& ir, const Options& options);
 
+/// Generate MSL for each of the entry points named by @p options, concurrently.
+/// A clone of @p ir is made for each element of @p options, which is then raised and printed on a
+/// thread pool.
+/// @param ir the IR module to translate to MSL
+/// @param options the configuration options for each of the entry points to generate
+/// @returns the result of generating each entry point, in the same order as @p options
+Vector<Result<Output>, 4> GenerateEntryPoints(core::ir::Module& ir, VectorRef<Options> options);
+
 }  // namespace tint::msl::writer
 
 #endif  // SRC_TINT_LANG_MSL_WRITER_WRITER_H_
@@ -66,6 +66,8 @@ struct FuzzedOptions {
     bool fix_u32_div_mod;
     bool polyfill_bool_vec_dynamic_store;
     uint32_t non_constant_zero_offset;
+    bool enable_common_subexpression_elimination;
+    bool enable_loop_invariant_code_motion;
 
     /// Reflect the fields of this class so that it can be used by tint::ForeachField()
     TINT_REFLECT(FuzzedOptions,
@@ -91,7 +93,9 @@ struct FuzzedOptions {
                  collapse_subgroup_min_max,
                  fix_u32_div_mod,
                  polyfill_bool_vec_dynamic_store,
-                 non_constant_zero_offset);
+                 non_constant_zero_offset,
+                 enable_common_subexpression_elimination,
+                 enable_loop_invariant_code_motion);
     TINT_REFLECT_HASH_CODE(FuzzedOptions);
 };
 
@@ -130,6 +134,9 @@ Result<SuccessType> IRFuzzer(core::ir::Module& module,
     options.strip_all_names = fuzzed_options.strip_all_names;
     options.disable_robustness = fuzzed_options.disable_robustness;
     options.disable_integer_range_analysis = !fuzzed_options.enable_integer_range_analysis;
+    options.enable_common_subexpression_elimination =
+        fuzzed_options.enable_common_subexpression_elimination;
+    options.enable_loop_invariant_code_motion = fuzzed_options.enable_loop_invariant_code_motion;
     options.disable_workgroup_init = fuzzed_options.disable_workgroup_init;
     options.emit_vertex_point_size = fuzzed_options.emit_vertex_point_size;
     options.disable_polyfill_integer_div_mod = fuzzed_options.disable_polyfill_integer_div_mod;
@@ -312,6 +312,16 @@ tint::core::ir::Instruction::Accesses GetSideEffects(BuiltinFn fn) {
         case BuiltinFn::kAtomicXor:
         case BuiltinFn::kAtomicIIncrement:
         case BuiltinFn::kAtomicIDecrement:
+        case BuiltinFn::kGroupNonUniformBroadcast:
+        case BuiltinFn::kGroupNonUniformBroadcastFirst:
+        case BuiltinFn::kGroupNonUniformShuffle:
+        case BuiltinFn::kGroupNonUniformShuffleXor:
+        case BuiltinFn::kGroupNonUniformShuffleDown:
+        case BuiltinFn::kGroupNonUniformShuffleUp:
+        case BuiltinFn::kGroupNonUniformQuadBroadcast:
+        case BuiltinFn::kGroupNonUniformQuadSwap:
+        case BuiltinFn::kGroupNonUniformSMin:
+        case BuiltinFn::kGroupNonUniformSMax:
             return core::ir::Instruction::Accesses{core::ir::Instruction::Access::kLoad, core::ir::Instruction::Access::kStore};
 
         case BuiltinFn::kArrayLength:
@@ -379,16 +389,6 @@ tint::core::ir::Instruction::Accesses GetSideEffects(BuiltinFn fn) {
         case BuiltinFn::kSNegate:
         case BuiltinFn::kFMod:
         case BuiltinFn::kOuterProduct:
-        case BuiltinFn::kGroupNonUniformBroadcast:
-        case BuiltinFn::kGroupNonUniformBroadcastFirst:
-        case BuiltinFn::kGroupNonUniformShuffle:
-        case BuiltinFn::kGroupNonUniformShuffleXor:
-        case BuiltinFn::kGroupNonUniformShuffleDown:
-        case BuiltinFn::kGroupNonUniformShuffleUp:
-        case BuiltinFn::kGroupNonUniformQuadBroadcast:
-        case BuiltinFn::kGroupNonUniformQuadSwap:
-        case BuiltinFn::kGroupNonUniformSMin:
-        case BuiltinFn::kGroupNonUniformSMax:
         case BuiltinFn::kInterpolateAtOffset:
         case BuiltinFn::kSConvert:
         case BuiltinFn::kUConvert:
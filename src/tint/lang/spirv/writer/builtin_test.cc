@@ -2743,6 +2743,36 @@ TEST_F(SpirvWriterTest, Builtin_ArrayLength_WithStruct) {
     EXPECT_INST("%result = OpArrayLength %uint %var 2");
 }
 
+TEST_F(SpirvWriterTest, Builtin_ArrayLength_CommonSubexpressionElimination) {
+    auto* var = b.Var("var", ty.ptr(storage, ty.runtime_array(ty.i32())));
+    var->SetBindingPoint(0, 0);
+    mod.root_block->Append(var);
+
+    auto* eb = b.ComputeFunction("main");
+    b.Append(eb->Block(), [&] {
+        b.Let("a", b.Call(ty.u32(), core::BuiltinFn::kArrayLength, var));
+        auto* ifelse = b.If(true);
+        b.Append(ifelse->True(), [&] {
+            b.Let("b", b.Call(ty.u32(), core::BuiltinFn::kArrayLength, var));
+            b.ExitIf(ifelse);
+        });
+        b.Return(eb);
+    });
+
+    Options options;
+    options.enable_common_subexpression_elimination = true;
+    auto result = Generate(options);
+    ASSERT_EQ(result, Success) << result.Failure() << output_;
+
+    // The length query in the `if` reuses the one that dominates it.
+    size_t count = 0;
+    for (auto pos = output_.find("OpArrayLength"); pos != std::string::npos;
+         pos = output_.find("OpArrayLength", pos + 1)) {
+        count++;
+    }
+    EXPECT_EQ(count, 1u);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // DP4A builtins
 ////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +264,12 @@ struct Options {
     /// Set to `true` to enable integer range analysis in robustness transform.
     bool disable_integer_range_analysis = false;
 
+    /// Set to `true` to remove redundant computation with common subexpression elimination.
+    bool enable_common_subexpression_elimination = false;
+
+    /// Set to `true` to hoist loop-invariant computation out of loops.
+    bool enable_loop_invariant_code_motion = false;
+
     /// Set to `true` to generate a PointSize builtin and have it set to 1.0
     /// from all vertex shaders in the module.
     bool emit_vertex_point_size = true;
@@ -309,6 +315,8 @@ struct Options {
                  disable_workgroup_init,
                  disable_polyfill_integer_div_mod,
                  disable_integer_range_analysis,
+                 enable_common_subexpression_elimination,
+                 enable_loop_invariant_code_motion,
                  emit_vertex_point_size,
                  polyfill_pixel_center,
                  multisampled_framebuffer_fetch,
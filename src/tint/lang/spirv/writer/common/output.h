@@ -34,6 +34,7 @@
 #include <optional>
 #include <vector>
 
+#include "src/tint/api/common/pass_timing.h"
 #include "src/tint/api/common/subgroup_matrix.h"
 #include "src/tint/api/common/workgroup_info.h"
 
@@ -62,6 +63,9 @@ struct Output {
 
     /// The subgroup matrix information
     SubgroupMatrixInfo subgroup_matrix_info{};
+
+    /// The cost of each transform that ran, if the module had a pass timer attached
+    PassTimings pass_timings;
 };
 
 }  // namespace tint::spirv::writer
@@ -1103,5 +1103,68 @@ TEST_F(SpirvWriterTest, Loop_ExitValue_BreakIf) {
 )");
 }
 
+/// Builds a loop that stores to a runtime-sized array, which Robustness clamps with the array
+/// length.
+void BuildClampedRuntimeArrayLoop(core::ir::Builder& b, core::type::Manager& ty) {
+    auto* buffer = b.Var("buffer", ty.ptr(storage, ty.runtime_array(ty.u32())));
+    buffer->SetBindingPoint(0, 0);
+    b.ir.root_block->Append(buffer);
+
+    auto* eb = b.ComputeFunction("main");
+    b.Append(eb->Block(), [&] {
+        auto* loop = b.Loop();
+        b.Append(loop->Initializer(), [&] { b.NextIteration(loop, 0_u); });
+        auto* i = b.BlockParam(ty.u32());
+        loop->Body()->SetParams({i});
+        b.Append(loop->Body(), [&] {
+            b.Store(b.Access(ty.ptr(storage, ty.u32()), buffer, i), i);
+            b.Continue(loop);
+        });
+        b.Append(loop->Continuing(), [&] {
+            auto* next = b.Add(i, 1_u);
+            b.BreakIf(loop, b.GreaterThanEqual(next, 16_u), /* next_iter */ Vector{next},
+                      /* exit */ Empty);
+        });
+        b.Return(eb);
+    });
+}
+
+TEST_F(SpirvWriterTest, Loop_RobustnessClamp) {
+    BuildClampedRuntimeArrayLoop(b, ty);
+
+    auto result = Generate();
+    ASSERT_EQ(result, Success) << result.Failure() << output_;
+
+    // The buffer length is queried inside the loop.
+    auto loop_merge = output_.find("OpLoopMerge");
+    auto length = output_.find("OpArrayLength");
+    ASSERT_NE(loop_merge, std::string::npos);
+    ASSERT_NE(length, std::string::npos);
+    EXPECT_GT(length, loop_merge);
+}
+
+TEST_F(SpirvWriterTest, Loop_RobustnessClamp_LoopInvariantCodeMotion) {
+    BuildClampedRuntimeArrayLoop(b, ty);
+
+    Options options;
+    options.enable_loop_invariant_code_motion = true;
+    auto result = Generate(options);
+    ASSERT_EQ(result, Success) << result.Failure() << output_;
+
+    // The buffer length and the clamp limit computed from it are hoisted out of the loop. Only the
+    // `min` of the clamp remains inside it.
+    auto loop_merge = output_.find("OpLoopMerge");
+    auto length = output_.find("OpArrayLength");
+    auto limit = output_.find("OpISub %uint");
+    auto clamp = output_.find("UMin");
+    ASSERT_NE(loop_merge, std::string::npos);
+    ASSERT_NE(length, std::string::npos);
+    ASSERT_NE(limit, std::string::npos);
+    ASSERT_NE(clamp, std::string::npos);
+    EXPECT_LT(length, loop_merge);
+    EXPECT_LT(limit, loop_merge);
+    EXPECT_GT(clamp, loop_merge);
+}
+
 }  // namespace
 }  // namespace tint::spirv::writer
@@ -28,6 +28,7 @@
 #include "src/tint/lang/spirv/writer/raise/raise.h"
 
 #include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/transform/bgra8unorm_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binary_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binding_remapper.h"
@@ -36,10 +37,12 @@
 #include "src/tint/lang/core/ir/transform/builtin_scalarize.h"
 #include "src/tint/lang/core/ir/transform/collapse_subgroup_min_max.h"
 #include "src/tint/lang/core/ir/transform/combine_access_instructions.h"
+#include "src/tint/lang/core/ir/transform/common_subexpression_elimination.h"
 #include "src/tint/lang/core/ir/transform/conversion_polyfill.h"
 #include "src/tint/lang/core/ir/transform/decompose_access.h"
 #include "src/tint/lang/core/ir/transform/demote_to_helper.h"
 #include "src/tint/lang/core/ir/transform/direct_variable_access.h"
+#include "src/tint/lang/core/ir/transform/loop_invariant_code_motion.h"
 #include "src/tint/lang/core/ir/transform/multiplanar_external_texture.h"
 #include "src/tint/lang/core/ir/transform/prepare_immediate_data.h"
 #include "src/tint/lang/core/ir/transform/preserve_padding.h"
@@ -73,19 +76,23 @@
 namespace tint::spirv::writer {
 
 Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
-    TINT_CHECK_RESULT(core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
+    TINT_CHECK_PASS(module, "core.SingleEntryPoint",
+                    core::ir::transform::SingleEntryPoint(module, options.entry_point_name));
 
-    TINT_CHECK_RESULT(
+    TINT_CHECK_PASS(
+        module, "core.SubstituteOverrides",
         core::ir::transform::SubstituteOverrides(module, options.substitute_overrides_config));
 
     // Must come before robustness.
-    TINT_CHECK_RESULT(core::ir::transform::PropagateBufferSizes(module));
+    TINT_CHECK_PASS(module, "core.PropagateBufferSizes",
+                    core::ir::transform::PropagateBufferSizes(module));
 
     tint::transform::multiplanar::BindingsMap multiplanar_map{};
     RemapperData remapper_data{};
     PopulateRemapperAndMultiplanarOptions(options, remapper_data, multiplanar_map);
 
-    TINT_CHECK_RESULT(core::ir::transform::BindingRemapper(module, remapper_data));
+    TINT_CHECK_PASS(module, "core.BindingRemapper",
+                    core::ir::transform::BindingRemapper(module, remapper_data));
 
     if (!options.disable_robustness) {
         core::ir::transform::RobustnessConfig config;
@@ -95,13 +102,23 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         config.disable_runtime_sized_array_index_clamping =
             options.extensions.disable_runtime_sized_array_index_clamping;
         config.use_integer_range_analysis = !options.disable_integer_range_analysis;
-        TINT_CHECK_RESULT(core::ir::transform::Robustness(module, config));
+        TINT_CHECK_PASS(module, "core.Robustness", core::ir::transform::Robustness(module, config));
 
-        TINT_CHECK_RESULT(core::ir::transform::PreventInfiniteLoops(module));
+        TINT_CHECK_PASS(module, "core.PreventInfiniteLoops",
+                        core::ir::transform::PreventInfiniteLoops(module));
+    }
+
+    // LoopInvariantCodeMotion must come straight after Robustness, which emits clamps and buffer
+    // length queries inside loops, and before the backend polyfills replace them with dialect
+    // instructions that it does not hoist.
+    if (options.enable_loop_invariant_code_motion) {
+        TINT_CHECK_PASS(module, "core.LoopInvariantCodeMotion",
+                        core::ir::transform::LoopInvariantCodeMotion(module));
     }
 
     spirv::writer::raise::ResourceTableHelper helper;
-    TINT_CHECK_RESULT(core::ir::transform::ResourceTable(module, options.resource_table, &helper));
+    TINT_CHECK_PASS(module, "core.ResourceTable",
+                    core::ir::transform::ResourceTable(module, options.resource_table, &helper));
 
     // PrepareImmediateData must come before any transform that needs internal immediate data.
     core::ir::transform::PrepareImmediateDataConfig immediate_data_config;
@@ -113,13 +130,15 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
             options.depth_range_offsets.value().max, module.symbols.New("tint_frag_depth_max"),
             module.Types().f32()));
     }
-    TINT_CHECK_RESULT_UNWRAP(immediate_data_layout, core::ir::transform::PrepareImmediateData(
-                                                        module, immediate_data_config));
+    TINT_CHECK_PASS_UNWRAP(
+        immediate_data_layout, module, "core.PrepareImmediateData",
+        core::ir::transform::PrepareImmediateData(module, immediate_data_config));
 
     core::ir::transform::BinaryPolyfillConfig binary_polyfills;
     binary_polyfills.bitshift_modulo = true;
     binary_polyfills.int_div_mod = !options.disable_polyfill_integer_div_mod;
-    TINT_CHECK_RESULT(core::ir::transform::BinaryPolyfill(module, binary_polyfills));
+    TINT_CHECK_PASS(module, "core.BinaryPolyfill",
+                    core::ir::transform::BinaryPolyfill(module, binary_polyfills));
 
     core::ir::transform::BuiltinPolyfillConfig core_polyfills;
     core_polyfills.clamp_int = true;
@@ -140,19 +159,26 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
     core_polyfills.distance_scalar_float = options.workarounds.polyfill_distance_scalar_float;
     core_polyfills.subgroup_broadcast_f16 = options.workarounds.polyfill_subgroup_broadcast_f16;
     core_polyfills.saturate_as_min_max = options.workarounds.polyfill_saturate_as_min_max_f16;
-    TINT_CHECK_RESULT(core::ir::transform::BuiltinPolyfill(module, core_polyfills));
+    TINT_CHECK_PASS(module, "core.BuiltinPolyfill",
+                    core::ir::transform::BuiltinPolyfill(module, core_polyfills));
 
     core::ir::transform::ConversionPolyfillConfig conversion_polyfills;
     conversion_polyfills.ftoi = true;
-    TINT_CHECK_RESULT(core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
+    TINT_CHECK_PASS(module, "core.ConversionPolyfill",
+                    core::ir::transform::ConversionPolyfill(module, conversion_polyfills));
+
+    // The core polyfills destroy many of the instructions they replace. Free them before the
+    // backend-specific lowering walks the module.
+    module.Compact();
 
     if (!options.disable_workgroup_init &&
         !options.extensions.use_zero_initialize_workgroup_memory) {
-        TINT_CHECK_RESULT(core::ir::transform::ZeroInitWorkgroupMemory(module));
+        TINT_CHECK_PASS(module, "core.ZeroInitWorkgroupMemory",
+                        core::ir::transform::ZeroInitWorkgroupMemory(module));
     }
 
     // PreservePadding must come before DirectVariableAccess.
-    TINT_CHECK_RESULT(core::ir::transform::PreservePadding(module));
+    TINT_CHECK_PASS(module, "core.PreservePadding", core::ir::transform::PreservePadding(module));
 
     core::ir::transform::DirectVariableAccessConfig dva_options;
     dva_options.transform_function = true;
@@ -160,25 +186,29 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
     dva_options.transform_handle = options.workarounds.dva_transform_handle
                                        ? core::ir::transform::HandleTransformLevel::kFull
                                        : core::ir::transform::HandleTransformLevel::kExternal;
-    TINT_CHECK_RESULT(core::ir::transform::DirectVariableAccess(module, dva_options));
+    TINT_CHECK_PASS(module, "core.DirectVariableAccess",
+                    core::ir::transform::DirectVariableAccess(module, dva_options));
 
     // Must come after DirectVariableAccess as we need all ExternalTextures to have their functions
     // flattened.
-    TINT_CHECK_RESULT(core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
+    TINT_CHECK_PASS(module, "core.MultiplanarExternalTexture",
+                    core::ir::transform::MultiplanarExternalTexture(module, multiplanar_map));
 
     // Fixup loads of binding_arrays of handles that may have been introduced by
     // DirectVariableAccess (DVA). Vulkan drivers that need DVA of handle expect binding_arrays to
     // stay as pointer and many mishandle by-value binding_arrays.
     if (options.workarounds.dva_transform_handle) {
-        TINT_CHECK_RESULT(raise::KeepBindingArrayAsPointer(module));
+        TINT_CHECK_PASS(module, "spirv.KeepBindingArrayAsPointer",
+                        raise::KeepBindingArrayAsPointer(module));
     }
 
     if (options.workarounds.pass_matrix_by_pointer) {
         // PassMatrixByPointer must come after PreservePadding+DirectVariableAccess.
-        TINT_CHECK_RESULT(raise::PassMatrixByPointer(module));
+        TINT_CHECK_PASS(module, "spirv.PassMatrixByPointer", raise::PassMatrixByPointer(module));
     }
 
-    TINT_CHECK_RESULT(core::ir::transform::Bgra8UnormPolyfill(module));
+    TINT_CHECK_PASS(module, "core.Bgra8UnormPolyfill",
+                    core::ir::transform::Bgra8UnormPolyfill(module));
 
     // DecomposeAccess must come before BlockDecoratedStructs, which will wrap
     // buffer resource variables in a structure.
@@ -186,30 +216,36 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
     // uniform buffer standard layout. Otherwise, only buffer type variables are decomposed.
     core::ir::transform::DecomposeAccessConfig decompose_config{
         .uniform = !options.extensions.use_uniform_buffers};
-    TINT_CHECK_RESULT(core::ir::transform::DecomposeAccess(module, decompose_config));
+    TINT_CHECK_PASS(module, "core.DecomposeAccess",
+                    core::ir::transform::DecomposeAccess(module, decompose_config));
     if (options.extensions.use_uniform_buffers) {
-        TINT_CHECK_RESULT(core::ir::transform::Std140(module));
+        TINT_CHECK_PASS(module, "core.Std140", core::ir::transform::Std140(module));
     }
-    TINT_CHECK_RESULT(core::ir::transform::BlockDecoratedStructs(module));
+    TINT_CHECK_PASS(module, "core.BlockDecoratedStructs",
+                    core::ir::transform::BlockDecoratedStructs(module));
 
-    TINT_CHECK_RESULT(core::ir::transform::VectorizeScalarMatrixConstructors(module));
+    TINT_CHECK_PASS(module, "core.VectorizeScalarMatrixConstructors",
+                    core::ir::transform::VectorizeScalarMatrixConstructors(module));
 
     // CombineAccessInstructions must come after DirectVariableAccess and BlockDecoratedStructs.
     // We run this transform as some Qualcomm drivers struggle with partial access chains that
     // produce pointers to matrices.
-    TINT_CHECK_RESULT(core::ir::transform::CombineAccessInstructions(module));
+    TINT_CHECK_PASS(module, "core.CombineAccessInstructions",
+                    core::ir::transform::CombineAccessInstructions(module));
 
     // RemoveUniformVectorComponentLoads is used to work around a Qualcomm driver bug.
     // See crbug.com/452350626.
-    TINT_CHECK_RESULT(core::ir::transform::RemoveUniformVectorComponentLoads(module));
+    TINT_CHECK_PASS(module, "core.RemoveUniformVectorComponentLoads",
+                    core::ir::transform::RemoveUniformVectorComponentLoads(module));
 
     if (!options.extensions.use_demote_to_helper_invocation) {
         // DemoteToHelper must come before any transform that introduces non-core instructions.
-        TINT_CHECK_RESULT(core::ir::transform::DemoteToHelper(module));
+        TINT_CHECK_PASS(module, "core.DemoteToHelper", core::ir::transform::DemoteToHelper(module));
     }
 
     if (options.workarounds.collapse_subgroup_min_max) {
-        TINT_CHECK_RESULT(core::ir::transform::CollapseSubgroupMinMax(module));
+        TINT_CHECK_PASS(module, "core.CollapseSubgroupMinMax",
+                        core::ir::transform::CollapseSubgroupMinMax(module));
     }
 
     raise::PolyfillConfig config = {
@@ -224,20 +260,23 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         .replace_workgroup_atomic_store_with_exchange =
             options.workarounds.replace_workgroup_atomic_store_with_exchange,
     };
-    TINT_CHECK_RESULT(raise::BuiltinPolyfill(module, config));
-    TINT_CHECK_RESULT(raise::ExpandImplicitSplats(module));
+    TINT_CHECK_PASS(module, "spirv.BuiltinPolyfill", raise::BuiltinPolyfill(module, config));
+    TINT_CHECK_PASS(module, "spirv.ExpandImplicitSplats", raise::ExpandImplicitSplats(module));
 
     core::ir::transform::BuiltinScalarizeConfig scalarize_config{
         .scalarize_min_max_clamp = options.workarounds.scalarize_max_min_clamp,
     };
-    TINT_CHECK_RESULT(core::ir::transform::BuiltinScalarize(module, scalarize_config));
+    TINT_CHECK_PASS(module, "core.BuiltinScalarize",
+                    core::ir::transform::BuiltinScalarize(module, scalarize_config));
 
     core::ir::transform::SignedIntegerPolyfillConfig signed_integer_cfg{
         .signed_negation = true, .signed_arithmetic = true, .signed_shiftleft = true};
-    TINT_CHECK_RESULT(core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
+    TINT_CHECK_PASS(module, "core.SignedIntegerPolyfill",
+                    core::ir::transform::SignedIntegerPolyfill(module, signed_integer_cfg));
 
     if (options.workarounds.replace_unsigned_compare_zero) {
-        TINT_CHECK_RESULT(raise::ReplaceUnsignedCompareZero(module));
+        TINT_CHECK_PASS(module, "spirv.ReplaceUnsignedCompareZero",
+                        raise::ReplaceUnsignedCompareZero(module));
     }
 
     // AMD Mesa front end optimizer bug for unary f32 and f16 negation and abs.
@@ -246,47 +285,63 @@ Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
         .polyfill_float_negation = options.workarounds.polyfill_float_negation,
         .polyfill_float_abs = options.workarounds.polyfill_float_abs};
 
-    TINT_CHECK_RESULT(raise::UnaryPolyfill(module, unary_polyfill_cfg));
+    TINT_CHECK_PASS(module, "spirv.UnaryPolyfill",
+                    raise::UnaryPolyfill(module, unary_polyfill_cfg));
 
     // kAllowAnyInputAttachmentIndexType required after ExpandImplicitSplats
-    TINT_CHECK_RESULT(raise::HandleMatrixArithmetic(module));
-    TINT_CHECK_RESULT(raise::MergeReturn(module));
+    TINT_CHECK_PASS(module, "spirv.HandleMatrixArithmetic", raise::HandleMatrixArithmetic(module));
+    TINT_CHECK_PASS(module, "spirv.MergeReturn", raise::MergeReturn(module));
     if (options.workarounds.polyfill_case_switch) {
-        TINT_CHECK_RESULT(raise::CaseSwitchToIfElse(module));
+        TINT_CHECK_PASS(module, "spirv.CaseSwitchToIfElse", raise::CaseSwitchToIfElse(module));
+    }
+    TINT_CHECK_PASS(module, "spirv.RemoveUnreachableInLoopContinuing",
+                    raise::RemoveUnreachableInLoopContinuing(module));
+    {
+        raise::ShaderIOConfig shader_io_config = {
+            .immediate_data_layout = immediate_data_layout,
+            .colour_index_to_binding_point = options.colour_index_to_binding_point,
+            .emit_vertex_point_size = options.emit_vertex_point_size,
+            .polyfill_f16_io = !options.extensions.use_storage_input_output_16,
+            .polyfill_pixel_center = options.polyfill_pixel_center,
+            .multisampled_framebuffer_fetch = options.multisampled_framebuffer_fetch,
+            .depth_range_offsets = options.depth_range_offsets,
+        };
+        TINT_CHECK_PASS(module, "spirv.ShaderIO", raise::ShaderIO(module, shader_io_config));
     }
-    TINT_CHECK_RESULT(raise::RemoveUnreachableInLoopContinuing(module));
-    TINT_CHECK_RESULT(raise::ShaderIO(
-        module, raise::ShaderIOConfig{
-                    .immediate_data_layout = immediate_data_layout,
-                    .colour_index_to_binding_point = options.colour_index_to_binding_point,
-                    .emit_vertex_point_size = options.emit_vertex_point_size,
-                    .polyfill_f16_io = !options.extensions.use_storage_input_output_16,
-                    .polyfill_pixel_center = options.polyfill_pixel_center,
-                    .multisampled_framebuffer_fetch = options.multisampled_framebuffer_fetch,
-                    .depth_range_offsets = options.depth_range_offsets,
-                }));
 
     // Immediate data is decomposed after ShaderIO because ShaderIO can introduce new accesses
     // into the immediate block (frag-depth clamping). Decomposing to a u32 array lets f16
     // immediates unpack via bitcast without the optional StoragePushConstant16 capability.
-    TINT_CHECK_RESULT(core::ir::transform::DecomposeAccess(
-        module, {
-                    .immediate = true,
-                    .minimum_array_size = options.minimum_immediate_size,
-                    .allow_dynamic_immediate_indices = false,
-                }));
+    {
+        core::ir::transform::DecomposeAccessConfig immediate_config = {
+            .immediate = true,
+            .minimum_array_size = options.minimum_immediate_size,
+            .allow_dynamic_immediate_indices = false,
+        };
+        TINT_CHECK_PASS(module, "core.DecomposeAccess",
+                        core::ir::transform::DecomposeAccess(module, immediate_config));
+    }
 
     // BlockDecoratedStructs must run again to wrap the decomposed immediate array in a block
     // struct, as SPIR-V requires push constant variables to be typed as a struct. Storage and
     // uniform variables already carry a block struct from the earlier run and are left untouched.
-    TINT_CHECK_RESULT(core::ir::transform::BlockDecoratedStructs(module));
+    TINT_CHECK_PASS(module, "core.BlockDecoratedStructs",
+                    core::ir::transform::BlockDecoratedStructs(module));
 
     // ForkExplicitLayoutTypes must come after DecomposeAccess, since it rewrites
     // host-shareable array types to use the explicitly laid array type defined by the SPIR-V
     // dialect.
-    TINT_CHECK_RESULT(raise::ForkExplicitLayoutTypes(module, options.spirv_version));
+    TINT_CHECK_PASS(module, "spirv.ForkExplicitLayoutTypes",
+                    raise::ForkExplicitLayoutTypes(module, options.spirv_version));
+
+    // CommonSubexpressionElimination must come after the polyfills and robustness, which emit
+    // redundant address and bounds arithmetic.
+    if (options.enable_common_subexpression_elimination) {
+        TINT_CHECK_PASS(module, "core.CommonSubexpressionElimination",
+                        core::ir::transform::CommonSubexpressionElimination(module));
+    }
 
-    TINT_CHECK_RESULT(raise::VarForDynamicIndex(module));
+    TINT_CHECK_PASS(module, "spirv.VarForDynamicIndex", raise::VarForDynamicIndex(module));
 
     return Success;
 }
@@ -30,7 +30,9 @@
 #include <string>
 
 #include "src/tint/lang/core/ir/analysis/subgroup_matrix.h"
+#include "src/tint/lang/core/ir/clone_module.h"
 #include "src/tint/lang/core/ir/core_builtin_call.h"
+#include "src/tint/lang/core/ir/pass_timer.h"
 #include "src/tint/lang/core/ir/referenced_module_vars.h"
 #include "src/tint/lang/core/ir/validator.h"
 #include "src/tint/lang/core/ir/var.h"
@@ -172,10 +174,21 @@ Result<Output> Generate(core::ir::Module& ir, const Options& options) {
     // Raise from core-dialect to SPIR-V-dialect.
     TINT_CHECK_RESULT(Raise(ir, options));
 
+    if (ir.pass_timer) {
+        ir.pass_timer->Begin(ir, "spirv.Print");
+    }
     TINT_CHECK_RESULT_UNWRAP(res, Print(ir, options));
+    if (ir.pass_timer) {
+        ir.pass_timer->End(ir);
+        res.pass_timings = ir.pass_timer->Timings();
+    }
     res.subgroup_matrix_info = sm_info;
 
     return res;
 }
 
+Vector<Result<Output>, 4> GenerateEntryPoints(core::ir::Module& ir, VectorRef<Options> options) {
+    return core::ir::GenerateForEachClone(ir, options, Generate);
+}
+
 }  // namespace tint::spirv::writer
@@ -31,6 +31,7 @@
 #include "src/tint/lang/core/ir/module.h"
 #include "src/tint/lang/spirv/writer/common/options.h"
 #include "src/tint/lang/spirv/writer/common/output.h"
+#include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/result.h"
 
 namespace tint::spirv::writer {
@@ -42,6 +43,14 @@ namespace tint::spirv::writer {
 /// @returns the resulting SPIR-V and supplementary information, or failure.
 Result<Output> Generate(core::ir::Module& ir, const Options& options);
 
+/// Generate SPIR-V for each of the entry points named by @p options, concurrently.
+/// A clone of @p ir is made for each element of @p options, which is then raised and printed on a
+/// thread pool.
+/// @param ir the IR module to translate to SPIR-V
+/// @param options the configuration options for each of the entry points to generate
+/// @returns the result of generating each entry point, in the same order as @p options
+Vector<Result<Output>, 4> GenerateEntryPoints(core::ir::Module& ir, VectorRef<Options> options);
+
 }  // namespace tint::spirv::writer
 
 #endif  // SRC_TINT_LANG_SPIRV_WRITER_WRITER_H_
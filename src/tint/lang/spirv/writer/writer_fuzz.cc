@@ -89,6 +89,8 @@ struct FuzzedOptions {
     bool collapse_subgroup_min_max;
     bool replace_workgroup_atomic_store_with_exchange;
     bool replace_unsigned_compare_zero;
+    bool enable_common_subexpression_elimination;
+    bool enable_loop_invariant_code_motion;
 
     /// Reflect the fields of this class so that it can be used by tint::ForeachField()
     TINT_REFLECT(FuzzedOptions,
@@ -127,7 +129,9 @@ struct FuzzedOptions {
                  polyfill_distance_scalar_float,
                  collapse_subgroup_min_max,
                  replace_workgroup_atomic_store_with_exchange,
-                 replace_unsigned_compare_zero);
+                 replace_unsigned_compare_zero,
+                 enable_common_subexpression_elimination,
+                 enable_loop_invariant_code_motion);
     TINT_REFLECT_HASH_CODE(FuzzedOptions);
 };
 
@@ -316,6 +320,9 @@ Result<SuccessType> IRFuzzer(core::ir::Module& module,
     options.disable_workgroup_init = fuzzed_options.disable_workgroup_init;
     options.disable_polyfill_integer_div_mod = fuzzed_options.disable_polyfill_integer_div_mod;
     options.disable_integer_range_analysis = !fuzzed_options.enable_integer_range_analysis;
+    options.enable_common_subexpression_elimination =
+        fuzzed_options.enable_common_subexpression_elimination;
+    options.enable_loop_invariant_code_motion = fuzzed_options.enable_loop_invariant_code_motion;
     options.emit_vertex_point_size = fuzzed_options.emit_vertex_point_size;
     if (fuzzed_options.polyfill_pixel_center) {
         options.polyfill_pixel_center = 99;  // Number bigger then is normally allowed in WGSL
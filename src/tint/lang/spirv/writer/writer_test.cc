@@ -737,5 +737,45 @@ TEST_F(SpirvWriterTest, Alignment_CooperativeMatrixStore) {
     EXPECT_INST("OpCooperativeMatrixStoreKHR %28 %10 %uint_0 %26 Aligned|NonPrivatePointer 64");
 }
 
+TEST_F(SpirvWriterTest, GenerateEntryPoints) {
+    mod.properties.Add(core::ir::Property::kAllowMultipleEntryPoints);
+
+    auto* v = b.Var<private_>("v", 1_i);
+    mod.root_block->Append(v);
+
+    auto* a = b.ComputeFunction("a", 4_u, 1_u, 1_u);
+    b.Append(a->Block(), [&] {
+        b.Store(v, 2_i);
+        b.Return(a);
+    });
+    auto* c = b.ComputeFunction("c", 8_u, 1_u, 1_u);
+    b.Append(c->Block(), [&] {
+        b.Let("x", b.Load(v));
+        b.Return(c);
+    });
+    auto ir_before = IR();
+
+    Vector<Options, 3> options;
+    for (auto* name : {"c", "a", "missing"}) {
+        Options opts;
+        opts.entry_point_name = name;
+        options.Push(opts);
+    }
+
+    auto results = GenerateEntryPoints(mod, options);
+    ASSERT_EQ(results.Length(), 3u);
+    ASSERT_EQ(results[0], Success) << results[0].Failure();
+    ASSERT_EQ(results[1], Success) << results[1].Failure();
+    EXPECT_EQ(results[0]->workgroup_info.x, 8u);
+    EXPECT_EQ(results[1]->workgroup_info.x, 4u);
+    ASSERT_NE(results[2], Success);
+    EXPECT_EQ(results[2].Failure().reason, "entry point not found");
+    EXPECT_EQ(Validate(results[0]->spirv), Success);
+    EXPECT_EQ(Validate(results[1]->spirv), Success);
+
+    // The source module is not modified.
+    EXPECT_EQ(IR(), ir_before);
+}
+
 }  // namespace
 }  // namespace tint::spirv::writer
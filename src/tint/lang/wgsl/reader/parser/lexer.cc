@@ -28,6 +28,7 @@
 #include "src/tint/lang/wgsl/reader/parser/lexer.h"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <charconv>
 #include <cmath>
@@ -89,6 +90,140 @@ bool read_blankspace(std::string_view str,
     return true;
 }
 
+/// @returns true if `c` is an ASCII space or horizontal tab, the only single-byte blankspace
+/// characters that can appear within a line.
+inline bool is_ascii_blankspace(uint8_t c) {
+    return c == ' ' || c == '\t';
+}
+
+/// @returns true if `c` is an ASCII character that can start an identifier.
+inline bool is_ascii_ident_start(uint8_t c) {
+    return ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '_';
+}
+
+/// @returns true if `c` is an ASCII character that can continue an identifier.
+inline bool is_ascii_ident_continue(uint8_t c) {
+    return is_ascii_ident_start(c) || (c >= '0' && c <= '9');
+}
+
+/// @returns a word with every byte set to `c`
+constexpr uint64_t splat(uint8_t c) {
+    return 0x0101010101010101ull * c;
+}
+
+/// @returns a word with the high bit of each byte set where the corresponding byte of `word` is
+/// zero. Bytes above the lowest zero byte may report false positives, so callers must only use
+/// this to decide whether a word can be skipped.
+constexpr uint64_t zero_bytes(uint64_t word) {
+    return (word - splat(0x01)) & ~word & splat(0x80);
+}
+
+/// Skips over the bytes of a comment body that need no further inspection, starting at byte
+/// offset `i` of `str`. These are the ASCII characters other than null, and for block comments,
+/// other than '/' and '*'. The bytes are tested eight at a time, and the scan stops at the first
+/// word that holds a byte which the caller must handle one character at a time.
+/// @param str the line being lexed
+/// @param i the byte offset in `str` to start scanning
+/// @param block_comment true if scanning the body of a block comment
+/// @returns the offset of the first byte that the caller must inspect
+size_t skip_plain_comment_bytes(std::string_view str, size_t i, bool block_comment) {
+    while (i + sizeof(uint64_t) <= str.size()) {
+        uint64_t word;
+        memcpy(&word, str.substr(i, sizeof(word)).data(), sizeof(word));
+        uint64_t stop = (word & splat(0x80)) | zero_bytes(word);
+        if (block_comment) {
+            stop |= zero_bytes(word ^ splat('/')) | zero_bytes(word ^ splat('*'));
+        }
+        if (stop != 0) {
+            break;
+        }
+        i += sizeof(uint64_t);
+    }
+    while (i < str.size()) {
+        auto c = static_cast<uint8_t>(str[i]);
+        if (c == 0 || c >= 0x80 || (block_comment && (c == '/' || c == '*'))) {
+            break;
+        }
+        i++;
+    }
+    return i;
+}
+
+/// A keyword and the token type that it lexes to.
+struct Keyword {
+    std::string_view name;
+    Token::Type type = Token::Type::kUninitialized;
+};
+
+constexpr Keyword kKeywords[] = {
+    {"alias", Token::Type::kAlias},
+    {"break", Token::Type::kBreak},
+    {"case", Token::Type::kCase},
+    {"const", Token::Type::kConst},
+    {"const_assert", Token::Type::kConstAssert},
+    {"continue", Token::Type::kContinue},
+    {"continuing", Token::Type::kContinuing},
+    {"diagnostic", Token::Type::kDiagnostic},
+    {"discard", Token::Type::kDiscard},
+    {"default", Token::Type::kDefault},
+    {"else", Token::Type::kElse},
+    {"enable", Token::Type::kEnable},
+    {"fallthrough", Token::Type::kFallthrough},
+    {"false", Token::Type::kFalse},
+    {"fn", Token::Type::kFn},
+    {"for", Token::Type::kFor},
+    {"if", Token::Type::kIf},
+    {"let", Token::Type::kLet},
+    {"loop", Token::Type::kLoop},
+    {"override", Token::Type::kOverride},
+    {"return", Token::Type::kReturn},
+    {"requires", Token::Type::kRequires},
+    {"struct", Token::Type::kStruct},
+    {"switch", Token::Type::kSwitch},
+    {"true", Token::Type::kTrue},
+    {"var", Token::Type::kVar},
+    {"while", Token::Type::kWhile},
+    {"_", Token::Type::kUnderscore},
+};
+
+/// The number of slots in the keyword hash table. Must be a power of two.
+static constexpr size_t kKeywordTableSize = 64;
+
+/// The length of the longest keyword. Longer identifiers skip the keyword lookup.
+static constexpr size_t kMaxKeywordLength = 12;
+
+/// @returns the slot in the keyword hash table for the non-empty string `str`.
+/// The multipliers were chosen so that every keyword in kKeywords maps to a distinct slot, which
+/// is verified at compile time below.
+constexpr size_t keyword_hash(std::string_view str) {
+    size_t first = static_cast<uint8_t>(str[0]);
+    size_t second = str.size() > 1 ? static_cast<uint8_t>(str[1]) : 0;
+    size_t last = static_cast<uint8_t>(str[str.size() - 1]);
+    return (str.size() + first * 3 + second * 6 + last) & (kKeywordTableSize - 1);
+}
+
+/// A perfect hash table of kKeywords, indexed by keyword_hash().
+struct KeywordTable {
+    std::array<Keyword, kKeywordTableSize> slots{};
+    bool is_perfect = true;
+};
+
+constexpr KeywordTable BuildKeywordTable() {
+    KeywordTable table;
+    for (auto& keyword : kKeywords) {
+        auto& slot = table.slots[keyword_hash(keyword.name)];
+        if (!slot.name.empty() || keyword.name.size() > kMaxKeywordLength) {
+            table.is_perfect = false;
+        }
+        slot = keyword;
+    }
+    return table;
+}
+
+constexpr KeywordTable kKeywordTable = BuildKeywordTable();
+static_assert(kKeywordTable.is_perfect,
+              "keyword_hash() has collisions, or kMaxKeywordLength is too small");
+
 uint32_t dec_value(char c) {
     if (c >= '0' && c <= '9') {
         return static_cast<uint32_t>(c - '0');
@@ -289,6 +424,17 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            // Fast path for runs of ASCII blankspace, which don't need UTF-8 decoding.
+            if (is_ascii_blankspace(static_cast<uint8_t>(at(pos())))) {
+                auto l = line();
+                auto end = pos() + 1;
+                while (end < l.size() && is_ascii_blankspace(static_cast<uint8_t>(l[end]))) {
+                    end++;
+                }
+                set_pos(end);
+                continue;
+            }
+
             bool is_blankspace;
             uint32_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -328,6 +474,10 @@ std::optional<Token> Lexer::skip_comment() {
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
         while (!is_eol()) {
+            set_pos(static_cast<uint32_t>(skip_plain_comment_bytes(line(), pos(), false)));
+            if (is_eol()) {
+                break;
+            }
             if (is_null()) {
                 return Token{Token::Type::kError, begin_source(), "null character found"};
             }
@@ -365,6 +515,12 @@ std::optional<Token> Lexer::skip_comment() {
             } else if (is_null()) {
                 return Token{Token::Type::kError, begin_source(), "null character found"};
             } else {
+                // Skip runs of plain ASCII without decoding them one character at a time.
+                auto end = skip_plain_comment_bytes(line(), pos(), true);
+                if (end != pos()) {
+                    set_pos(static_cast<uint32_t>(end));
+                    continue;
+                }
                 auto n = unicode_length(line(), pos());
                 if (n == 0) {
                     return Token{Token::Type::kError, begin_source(), "invalid UTF-8"};
@@ -1020,7 +1176,13 @@ std::optional<Token> Lexer::try_ident() {
     auto start = pos();
 
     // Must begin with an XID_Source unicode character, or underscore
-    {
+    if (auto c = static_cast<uint8_t>(at(pos())); c < 0x80) {
+        // ASCII fast path: only letters and underscore can start an identifier.
+        if (!is_ascii_ident_start(c)) {
+            return {};
+        }
+        advance();
+    } else {
         auto [code_point, n] = tint::utf8::Decode(line().substr(pos()));
         if (n == 0) {
             advance();  // Skip the bad byte.
@@ -1034,6 +1196,19 @@ std::optional<Token> Lexer::try_ident() {
     }
 
     while (!is_eol()) {
+        // ASCII fast path: consume the run of ASCII identifier characters without decoding.
+        {
+            auto l = line();
+            auto end = pos();
+            while (end < l.size() && is_ascii_ident_continue(static_cast<uint8_t>(l[end]))) {
+                end++;
+            }
+            set_pos(end);
+            if (end == l.size() || static_cast<uint8_t>(l[end]) < 0x80) {
+                break;
+            }
+        }
+
         // Must continue with an XID_Continue unicode character
         auto [code_point, n] = tint::utf8::Decode(line().substr(pos()));
         if (n == 0) {
@@ -1311,89 +1486,12 @@ std::optional<Token> Lexer::try_punctuation() {
 }
 
 std::optional<Token::Type> Lexer::parse_keyword(std::string_view str) {
-    if (str == "alias") {
-        return Token::Type::kAlias;
-    }
-    if (str == "break") {
-        return Token::Type::kBreak;
-    }
-    if (str == "case") {
-        return Token::Type::kCase;
-    }
-    if (str == "const") {
-        return Token::Type::kConst;
-    }
-    if (str == "const_assert") {
-        return Token::Type::kConstAssert;
-    }
-    if (str == "continue") {
-        return Token::Type::kContinue;
-    }
-    if (str == "continuing") {
-        return Token::Type::kContinuing;
-    }
-    if (str == "diagnostic") {
-        return Token::Type::kDiagnostic;
-    }
-    if (str == "discard") {
-        return Token::Type::kDiscard;
-    }
-    if (str == "default") {
-        return Token::Type::kDefault;
-    }
-    if (str == "else") {
-        return Token::Type::kElse;
-    }
-    if (str == "enable") {
-        return Token::Type::kEnable;
-    }
-    if (str == "fallthrough") {
-        return Token::Type::kFallthrough;
-    }
-    if (str == "false") {
-        return Token::Type::kFalse;
-    }
-    if (str == "fn") {
-        return Token::Type::kFn;
-    }
-    if (str == "for") {
-        return Token::Type::kFor;
-    }
-    if (str == "if") {
-        return Token::Type::kIf;
-    }
-    if (str == "let") {
-        return Token::Type::kLet;
-    }
-    if (str == "loop") {
-        return Token::Type::kLoop;
-    }
-    if (str == "override") {
-        return Token::Type::kOverride;
-    }
-    if (str == "return") {
-        return Token::Type::kReturn;
-    }
-    if (str == "requires") {
-        return Token::Type::kRequires;
-    }
-    if (str == "struct") {
-        return Token::Type::kStruct;
-    }
-    if (str == "switch") {
-        return Token::Type::kSwitch;
-    }
-    if (str == "true") {
-        return Token::Type::kTrue;
-    }
-    if (str == "var") {
-        return Token::Type::kVar;
-    }
-    if (str == "while") {
-        return Token::Type::kWhile;
+    if (str.empty() || str.size() > kMaxKeywordLength) {
+        return std::nullopt;
     }
-    if (str == "_") {
-        return Token::Type::kUnderscore;
+    const auto& slot = kKeywordTable.slots[keyword_hash(str)];
+    if (slot.name == str) {
+        return slot.type;
     }
     return std::nullopt;
 }
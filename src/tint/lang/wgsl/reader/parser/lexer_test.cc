@@ -278,6 +278,30 @@ text */ident)");
     }
 }
 
+TEST_F(LexerTest, Skips_Comments_Block_Long) {
+    Source::File file("", R"(/* a comment long enough to be skipped eight bytes at a time
+/* nested comment with a * and / and 🙂 in it */ more text ** // */ident)");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.line, 2u);
+        EXPECT_EQ(t.source().range.begin.column, 70u);
+        EXPECT_EQ(t.source().range.end.line, 2u);
+        EXPECT_EQ(t.source().range.end.column, 75u);
+        EXPECT_EQ(t.to_str(), "ident");
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
 TEST_F(LexerTest, Skips_Comments_Block_Nested) {
     Source::File file("", R"(/* comment
 text // nested line comments are ignored /* more text
@@ -372,6 +396,40 @@ TEST_F(LexerTest, Null_InBlockComment_IsError) {
     EXPECT_EQ(t.to_str(), "null character found");
 }
 
+TEST_F(LexerTest, Null_InLongLineComment_IsError) {
+    std::string src = "// 0123456789abcdefghijklmnop";
+    src += '\0';
+    src += "qrstuvwxyz";
+    Source::File file("", src);
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(1u, list.size());
+
+    auto& t = list[0];
+    EXPECT_TRUE(t.IsError());
+    EXPECT_EQ(t.source().range.begin.line, 1u);
+    EXPECT_EQ(t.source().range.begin.column, 30u);
+    EXPECT_EQ(t.to_str(), "null character found");
+}
+
+TEST_F(LexerTest, Null_InLongBlockComment_IsError) {
+    std::string src = "/* 0123456789abcdefghijklmnop";
+    src += '\0';
+    src += "qrstuvwxyz */";
+    Source::File file("", src);
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(1u, list.size());
+
+    auto& t = list[0];
+    EXPECT_TRUE(t.IsError());
+    EXPECT_EQ(t.source().range.begin.line, 1u);
+    EXPECT_EQ(t.source().range.begin.column, 30u);
+    EXPECT_EQ(t.to_str(), "null character found");
+}
+
 TEST_F(LexerTest, Null_InIdentifier_IsError) {
     // Try inserting a null in an identifier. Other valid token
     // kinds will behave similarly, so use the identifier case
@@ -662,6 +720,19 @@ INSTANTIATE_TEST_SUITE_P(LexerTest,
                                          "abcdefghijklmnopqrstuvwxyz",
                                          "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
                                          "alldigits_0123456789"));
+INSTANTIATE_TEST_SUITE_P(NotKeywords,
+                         AsciiIdentifierTest,
+                         testing::Values("aliases",
+                                         "constant",
+                                         "const_assert_",
+                                         "continued",
+                                         "fallthroughs",
+                                         "fo",
+                                         "iff",
+                                         "True",
+                                         "vars",
+                                         "whilst",
+                                         "_a"));
 
 struct UnicodeCase {
     const char* utf8;
@@ -720,6 +791,8 @@ INSTANTIATE_TEST_SUITE_P(
                     "\xf0\x9d\x96\x99\xf0\x9d\x96\x8e\xf0\x9d\x96\x8b\xf0\x9d\x96\x8e"
                     "\xf0\x9d\x96\x8a\xf0\x9d\x96\x97\x31\x32\x33",
                     43},
+        UnicodeCase{// "ascii_prefix_𝐢𝐝"
+                    "ascii_prefix_\xf0\x9d\x90\xa2\xf0\x9d\x90\x9d", 21},
     }));
 
 using InvalidUnicodeIdentifierTest = testing::TestWithParam<const char*>;
@@ -30,6 +30,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace tint {
 
@@ -80,7 +81,15 @@ class Command {
     /// the process has returned.
     /// @param args the string arguments to pass to the process
     /// @returns the process output
-    Output Exec(std::initializer_list<std::string> args) const;
+    Output Exec(std::initializer_list<std::string> args) const {
+        return Exec(std::vector<std::string>(args));
+    }
+
+    /// Exec invokes the command with the given argument strings, blocking until
+    /// the process has returned.
+    /// @param args the string arguments to pass to the process
+    /// @returns the process output
+    Output Exec(const std::vector<std::string>& args) const;
 
     /// @param input the input data to pipe to the process's stdin
     void SetInput(const std::string& input) { input_ = input; }
@@ -41,7 +41,7 @@ bool Command::Found() const {
     return false;
 }
 
-Command::Output Command::Exec(std::initializer_list<std::string>) const {
+Command::Output Command::Exec(const std::vector<std::string>&) const {
     Output out;
     out.err = "Command not supported by this target";
     return out;
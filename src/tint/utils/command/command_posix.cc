@@ -174,7 +174,7 @@ bool Command::Found() const {
     return ExecutableExists(path_);
 }
 
-Command::Output Command::Exec(std::initializer_list<std::string> arguments) const {
+Command::Output Command::Exec(const std::vector<std::string>& arguments) const {
     if (!Found()) {
         Output out;
         out.err = "Executable not found";
@@ -27,6 +27,9 @@
 
 #include "src/tint/utils/command/command.h"
 
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace tint {
@@ -60,6 +63,19 @@ TEST(CommandTest, Echo) {
     EXPECT_EQ(res.err, "");
 }
 
+TEST(CommandTest, EchoArgumentVector) {
+    auto cmd = Command::LookPath("echo");
+    if (!cmd.Found()) {
+        GTEST_SKIP() << "echo not found on PATH";
+    }
+
+    std::vector<std::string> args{"hello", "world"};
+    auto res = cmd.Exec(args);
+    EXPECT_EQ(res.error_code, 0);
+    EXPECT_EQ(res.out, "hello world\n");
+    EXPECT_EQ(res.err, "");
+}
+
 TEST(CommandTest, Cat) {
     auto cmd = Command::LookPath("cat");
     if (!cmd.Found()) {
@@ -214,7 +214,7 @@ bool Command::Found() const {
     return ExecutableExists(path_);
 }
 
-Command::Output Command::Exec(std::initializer_list<std::string> arguments) const {
+Command::Output Command::Exec(const std::vector<std::string>& arguments) const {
     Pipe stdout_pipe(true);
     Pipe stderr_pipe(true);
     Pipe stdin_pipe(false);
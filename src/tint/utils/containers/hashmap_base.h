@@ -30,11 +30,20 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <optional>
 #include <tuple>
 #include <utility>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/ice/ice.h"
 #include "src/tint/utils/math/hash.h"
@@ -173,7 +182,155 @@ auto& operator<<(STREAM& out, const HashmapKey<T>& key) {
     }
 }
 
+namespace detail {
+
+/// HashmapCtrl is the type of the control bytes of a HashmapBase.
+/// A control byte is either kHashmapCtrlEmpty, kHashmapCtrlDeleted, or holds the 7-bit H2 hash of
+/// the entry held by the slot.
+using HashmapCtrl = int8_t;
+
+/// Control byte of a slot that has never held an entry since the last rehash.
+static constexpr HashmapCtrl kHashmapCtrlEmpty = -128;  // 0b10000000
+
+/// Control byte of a slot that held an entry that has since been removed (a tombstone).
+static constexpr HashmapCtrl kHashmapCtrlDeleted = -2;  // 0b11111110
+
+/// HashmapBitMask is the result of matching a HashmapGroup against a control byte pattern.
+/// Each slot in the group is represented by `1 << SHIFT` bits, of which at most one is set.
+template <typename T, int SHIFT>
+struct HashmapBitMask {
+    /// The bits of the mask
+    T bits;
+
+    /// @returns true if any slot matched
+    explicit operator bool() const { return bits != 0; }
+
+    /// @returns the index in the group of the lowest matching slot. The mask must not be empty.
+    size_t Lowest() const { return static_cast<size_t>(std::countr_zero(bits)) >> SHIFT; }
+
+    /// Iterator over the indices of the matching slots
+    struct Iterator {
+        /// The remaining bits
+        T bits;
+        /// @returns the index of the current matching slot
+        size_t operator*() const { return static_cast<size_t>(std::countr_zero(bits)) >> SHIFT; }
+        /// Advances to the next matching slot
+        /// @returns this iterator
+        Iterator& operator++() {
+            bits &= bits - 1;
+            return *this;
+        }
+        /// @param other the other iterator
+        /// @returns true if the iterators are not equal
+        bool operator!=(const Iterator& other) const { return bits != other.bits; }
+    };
+
+    /// @returns an iterator to the first matching slot
+    Iterator begin() const { return {bits}; }
+    /// @returns the end iterator
+    Iterator end() const { return {0}; }
+};
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+/// HashmapGroup is a group of 16 control bytes that are matched together using SSE2.
+struct HashmapGroup {
+    /// The number of slots in a group
+    static constexpr size_t kWidth = 16;
+
+    /// Constructor
+    /// @param ctrl the pointer to the first of the kWidth control bytes of the group.
+    explicit HashmapGroup(const HashmapCtrl* ctrl)
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    /// @param h2 the H2 hash to search for
+    /// @returns the mask of slots that hold @p h2
+    HashmapBitMask<uint32_t, 0> Match(HashmapCtrl h2) const {
+        return {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)))};
+    }
+
+    /// @returns the mask of empty slots
+    HashmapBitMask<uint32_t, 0> MatchEmpty() const { return Match(kHashmapCtrlEmpty); }
+
+    /// @returns the mask of slots that are empty or deleted
+    HashmapBitMask<uint32_t, 0> MatchEmptyOrDeleted() const {
+        // Full slots hold a 7-bit H2, so only empty and deleted slots have the sign bit set.
+        return {static_cast<uint32_t>(_mm_movemask_epi8(ctrl_))};
+    }
+
+  private:
+    __m128i ctrl_;
+};
+
+#else
+
+/// HashmapGroup is a group of 8 control bytes that are matched together as a single 64-bit word,
+/// using NEON for the H2 matching when available.
+struct HashmapGroup {
+    /// The number of slots in a group
+    static constexpr size_t kWidth = 8;
+
+    /// Constructor
+    /// @param ctrl the pointer to the first of the kWidth control bytes of the group.
+    explicit HashmapGroup(const HashmapCtrl* ctrl) {
+        std::memcpy(&ctrl_, ctrl, sizeof(ctrl_));
+        if constexpr (std::endian::native == std::endian::big) {
+            ctrl_ = ByteSwap(ctrl_);
+        }
+    }
+
+    /// @param h2 the H2 hash to search for
+    /// @returns the mask of slots that hold @p h2
+    HashmapBitMask<uint64_t, 3> Match(HashmapCtrl h2) const {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        uint8x8_t eq = vceq_u8(vcreate_u8(ctrl_), vdup_n_u8(static_cast<uint8_t>(h2)));
+        return {vget_lane_u64(vreinterpret_u64_u8(eq), 0) & kMsbs};
+#else
+        // Sets the high bit of the bytes that are zero after XOR-ing with the pattern. This may
+        // report false positives for bytes following a true match, which is fine as matches are
+        // always confirmed by comparing keys.
+        uint64_t x = ctrl_ ^ (kLsbs * static_cast<uint8_t>(h2));
+        return {(x - kLsbs) & ~x & kMsbs};
+#endif
+    }
+
+    /// @returns the mask of empty slots
+    HashmapBitMask<uint64_t, 3> MatchEmpty() const {
+        // Empty is the only control value with the high bit set and bit 1 clear.
+        return {(ctrl_ & ~(ctrl_ << 6)) & kMsbs};
+    }
+
+    /// @returns the mask of slots that are empty or deleted
+    HashmapBitMask<uint64_t, 3> MatchEmptyOrDeleted() const { return {ctrl_ & kMsbs}; }
+
+  private:
+    static constexpr uint64_t kLsbs = 0x0101010101010101ull;
+    static constexpr uint64_t kMsbs = 0x8080808080808080ull;
+
+    static uint64_t ByteSwap(uint64_t v) {
+        uint64_t out = 0;
+        for (size_t i = 0; i < 8; i++) {
+            out = (out << 8) | ((v >> (i * 8)) & 0xff);
+        }
+        return out;
+    }
+
+    uint64_t ctrl_;
+};
+
+#endif
+
+}  // namespace detail
+
 /// HashmapBase is the base class for Hashmap and Hashset.
+///
+/// HashmapBase is an open-addressing hash table. The table is made of a control byte and a node
+/// pointer per slot. Slots are probed a HashmapGroup at a time, comparing the 7-bit H2 hash stored
+/// in the control bytes of the whole group at once, so that the entries are only dereferenced for
+/// likely matches. Entries are held in nodes that are never moved by a rehash, so references to
+/// entries remain valid until the entry is removed, the map is cleared, or the map is destructed.
+/// The first kMinCapacity nodes, and the table required to hold them, are stored inline.
+///
 /// @tparam ENTRY is the single record in the map. The entry type must alias 'Key' to the HashmapKey
 /// type, and implement the method `static HashmapKey<...> KeyOf(ENTRY)` to return the key for the
 /// entry.
@@ -181,7 +338,8 @@ template <typename ENTRY, size_t N>
 class HashmapBase {
   protected:
     struct Node;
-    struct Slot;
+    using Ctrl = detail::HashmapCtrl;
+    using Group = detail::HashmapGroup;
 
   public:
     /// Entry is the type of a single record in the hashmap.
@@ -196,20 +354,25 @@ class HashmapBase {
     /// The minimum capacity of the map.
     static constexpr size_t kMinCapacity = std::max<size_t>(N, 8);
 
-    /// The target number of slots, expressed as a fractional percentage of the map capacity.
-    /// e.g. a kLoadFactor of 75, would mean a target slots count of (0.75 * capacity).
-    static constexpr size_t kLoadFactor = 75;
+    /// The maximum number of occupied (full or deleted) slots, expressed as a fractional
+    /// percentage of the number of slots in the table.
+    static constexpr size_t kLoadFactor = 87;
 
     /// @param capacity the capacity of the map, as total number of entries.
-    /// @returns the target slot vector size to hold @p capacity map entries.
+    /// @returns the number of table slots required to hold @p capacity map entries.
     static constexpr size_t NumSlots(size_t capacity) {
-        return (std::max<size_t>(capacity, kMinCapacity) * kLoadFactor) / 100;
+        size_t slots = Group::kWidth;
+        while (MaxLoad(slots) < capacity) {
+            slots *= 2;
+        }
+        return slots;
     }
 
     /// Constructor.
     /// Constructs an empty map.
     HashmapBase() {
-        slots_.Resize(slots_.Capacity());
+        ctrl_.Resize(ctrl_.Capacity(), detail::kHashmapCtrlEmpty);
+        slots_.Resize(slots_.Capacity(), nullptr);
         for (auto& node : fixed_) {
             free_.Add(&node);
         }
@@ -236,12 +399,9 @@ class HashmapBase {
     /// Destructor.
     ~HashmapBase() {
         // Call the destructor on all entries in the map.
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            auto* node = slots_[slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                node->Destroy();
-                node = next;
+        for (size_t i = 0; i < ctrl_.Length(); i++) {
+            if (IsFull(ctrl_[i])) {
+                slots_[i]->Destroy();
             }
         }
     }
@@ -280,17 +440,15 @@ class HashmapBase {
     /// @note the map's capacity is not reduced, as it is assumed that a reused map will likely fill
     /// to a similar size as before.
     void Clear() {
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            auto* node = slots_[slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                node->Destroy();
-                free_.Add(node);
-                node = next;
+        for (size_t i = 0; i < ctrl_.Length(); i++) {
+            if (IsFull(ctrl_[i])) {
+                slots_[i]->Destroy();
+                free_.Add(slots_[i]);
             }
-            slots_[slot_idx].nodes = nullptr;
+            ctrl_[i] = detail::kHashmapCtrlEmpty;
         }
         count_ = 0;
+        deleted_ = 0;
     }
 
     /// Ensures that the map can hold @p n entries without heap reallocation or rehashing.
@@ -302,6 +460,9 @@ class HashmapBase {
             free_.Allocate(count);
             capacity_ += count;
         }
+        if (NumSlots(n) > ctrl_.Length()) {
+            Rehash(NumSlots(n));
+        }
     }
 
     /// Looks up an entry with the given key.
@@ -312,8 +473,8 @@ class HashmapBase {
     template <typename K>
     Entry* GetEntry(K&& key) {
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        return slot.Find(hash, key);
+        size_t index = Find(hash, key);
+        return index != kNotFound ? &slots_[index]->Entry() : nullptr;
     }
 
     /// Looks up an entry with the given key.
@@ -324,8 +485,8 @@ class HashmapBase {
     template <typename K>
     const Entry* GetEntry(K&& key) const {
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        return slot.Find(hash, key);
+        size_t index = Find(hash, key);
+        return index != kNotFound ? &slots_[index]->Entry() : nullptr;
     }
 
     /// @returns true if the map contains an entry with a key that matches @p key.
@@ -341,19 +502,27 @@ class HashmapBase {
     template <typename K = Key>
     bool Remove(K&& key) {
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        Node** edge = &slot.nodes;
-        for (auto* node = *edge; node; node = node->next) {
-            if (node->Equals(hash, key)) {
-                *edge = node->next;
-                node->Destroy();
-                free_.Add(node);
-                count_--;
-                return true;
-            }
-            edge = &node->next;
+        size_t index = Find(hash, key);
+        if (index == kNotFound) {
+            return false;
         }
-        return false;
+
+        Node* node = slots_[index];
+        node->Destroy();
+        free_.Add(node);
+        count_--;
+
+        // If the group still has an empty slot then no probe sequence can have continued past this
+        // group, and the slot can be marked as empty. Otherwise a tombstone is required so that
+        // lookups continue probing past this slot.
+        size_t group_start = index & ~(Group::kWidth - 1);
+        if (Group{&ctrl_[group_start]}.MatchEmpty()) {
+            ctrl_[index] = detail::kHashmapCtrlEmpty;
+        } else {
+            ctrl_[index] = detail::kHashmapCtrlDeleted;
+            deleted_++;
+        }
+        return true;
     }
 
     /// Iterator for entries in the map.
@@ -361,19 +530,18 @@ class HashmapBase {
     class IteratorT {
       private:
         using MAP = std::conditional_t<IS_CONST, const HashmapBase, HashmapBase>;
-        using NODE = std::conditional_t<IS_CONST, const Node, Node>;
 
       public:
         /// @returns the entry pointed to by this iterator
-        auto& operator->() { return node_->Entry(); }
+        auto& operator->() { return Get(); }
 
         /// @returns a reference to the entry at the iterator
-        auto& operator*() { return node_->Entry(); }
+        auto& operator*() { return Get(); }
 
         /// Increments the iterator
         /// @returns this iterator
         IteratorT& operator++() {
-            node_ = node_->next;
+            index_++;
             SkipEmptySlots();
             return *this;
         }
@@ -381,30 +549,35 @@ class HashmapBase {
         /// Equality operator
         /// @param other the other iterator to compare this iterator to
         /// @returns true if this iterator is equal to other
-        bool operator==(const IteratorT& other) const { return node_ == other.node_; }
+        bool operator==(const IteratorT& other) const { return index_ == other.index_; }
 
         /// Inequality operator
         /// @param other the other iterator to compare this iterator to
         /// @returns true if this iterator is not equal to other
-        bool operator!=(const IteratorT& other) const { return node_ != other.node_; }
+        bool operator!=(const IteratorT& other) const { return index_ != other.index_; }
 
       private:
         /// Friend class
         friend class HashmapBase;
 
-        IteratorT(MAP& map, size_t slot, NODE* node) : map_(map), slot_(slot), node_(node) {
-            SkipEmptySlots();
+        IteratorT(MAP& map, size_t index) : map_(map), index_(index) { SkipEmptySlots(); }
+
+        auto& Get() {
+            if constexpr (IS_CONST) {
+                return std::as_const(map_.slots_[index_]->Entry());
+            } else {
+                return map_.slots_[index_]->Entry();
+            }
         }
 
         void SkipEmptySlots() {
-            while (!node_ && slot_ + 1 < map_.slots_.Length()) {
-                node_ = map_.slots_[++slot_].nodes;
+            while (index_ < map_.ctrl_.Length() && !IsFull(map_.ctrl_[index_])) {
+                index_++;
             }
         }
 
         MAP& map_;
-        size_t slot_ = 0;
-        NODE* node_ = nullptr;
+        size_t index_ = 0;
     };
 
     /// An immutable key and mutable value iterator
@@ -414,22 +587,80 @@ class HashmapBase {
     using ConstIterator = IteratorT</*IS_CONST*/ true>;
 
     /// @returns an immutable iterator to the start of the map.
-    ConstIterator begin() const { return ConstIterator{*this, 0, slots_.Front().nodes}; }
+    ConstIterator begin() const { return ConstIterator{*this, 0}; }
 
     /// @returns an immutable iterator to the end of the map.
-    ConstIterator end() const { return ConstIterator{*this, slots_.Length(), nullptr}; }
+    ConstIterator end() const { return ConstIterator{*this, ctrl_.Length()}; }
 
     /// @returns an iterator to the start of the map.
-    Iterator begin() { return Iterator{*this, 0, slots_.Front().nodes}; }
+    Iterator begin() { return Iterator{*this, 0}; }
 
     /// @returns an iterator to the end of the map.
-    Iterator end() { return Iterator{*this, slots_.Length(), nullptr}; }
+    Iterator end() { return Iterator{*this, ctrl_.Length()}; }
 
     /// STL-friendly alias to Entry. Used by gmock.
     using value_type = const Entry&;
 
   protected:
-    /// Node holds an Entry in a linked list.
+    /// The value returned by Find() when no entry was found.
+    static constexpr size_t kNotFound = ~static_cast<size_t>(0);
+
+    /// @param num_slots the number of slots in the table
+    /// @returns the maximum number of full or deleted slots for a table of @p num_slots slots
+    static constexpr size_t MaxLoad(size_t num_slots) { return (num_slots * kLoadFactor) / 100; }
+
+    /// @param ctrl the control byte
+    /// @returns true if the control byte is for a slot that holds an entry.
+    static bool IsFull(Ctrl ctrl) { return ctrl >= 0; }
+
+    /// @param hash the hash of the key
+    /// @returns @p hash with its bits mixed, so that both the H1 and H2 parts of the hash are well
+    /// distributed, even for weak hashes of integers and pointers. Multiplying alone is not enough,
+    /// as the low bits of a product only depend on the low bits of the hash, which are the same for
+    /// keys with a common power-of-two stride.
+    static uint32_t Mix(HashCode hash) {
+        // Fold the high bits in, then apply the MurmurHash3 finalizer.
+        uint64_t wide = static_cast<uint64_t>(hash);
+        uint32_t mixed = static_cast<uint32_t>(wide ^ (wide >> 32));
+        mixed ^= mixed >> 16;
+        mixed *= 0x85ebca6bu;
+        mixed ^= mixed >> 13;
+        mixed *= 0xc2b2ae35u;
+        mixed ^= mixed >> 16;
+        return mixed;
+    }
+
+    /// @param mixed the mixed hash of the key
+    /// @returns the 7-bit hash stored in the control byte
+    static Ctrl H2(uint32_t mixed) { return static_cast<Ctrl>(mixed >> 25); }
+
+    /// ProbeSeq iterates the groups of the table with a triangular sequence, which visits every
+    /// group when the number of groups is a power of two.
+    struct ProbeSeq {
+        /// Constructor
+        /// @param mixed the mixed hash of the key
+        /// @param num_slots the number of slots in the table
+        ProbeSeq(uint32_t mixed, size_t num_slots)
+            : mask(num_slots / Group::kWidth - 1), group(mixed & mask) {}
+
+        /// @returns the index of the first slot of the current group
+        size_t Offset() const { return group * Group::kWidth; }
+
+        /// Moves to the next group
+        void Next() {
+            stride++;
+            group = (group + stride) & mask;
+        }
+
+        /// The mask applied to the group index
+        size_t mask;
+        /// The current group index
+        size_t group;
+        /// The number of groups probed so far
+        size_t stride = 0;
+    };
+
+    /// Node holds an Entry.
     struct Node {
         /// Destructs the entry.
         void Destroy() { Entry().~ENTRY(); }
@@ -454,26 +685,67 @@ class HashmapBase {
         }
 
         /// storage is a buffer that has the same size and alignment as Entry.
-        /// The storage holds a constructed Entry when linked in the slots, and is destructed when
-        /// removed from slots.
+        /// The storage holds a constructed Entry when the node is in the table, and is destructed
+        /// when removed from the table.
         AlignedStorage<ENTRY> storage;
 
-        /// next is the next Node in the slot, or in the free list.
+        /// next is the next Node in the free list.
         Node* next;
     };
 
+    /// @param hash the hash of @p key
+    /// @param key the key to search for
+    /// @returns the index of the slot holding the entry with the key @p key, or kNotFound.
+    template <typename K>
+    size_t Find(HashCode hash, K&& key) const {
+        uint32_t mixed = Mix(hash);
+        Ctrl h2 = H2(mixed);
+        for (ProbeSeq seq(mixed, ctrl_.Length());; seq.Next()) {
+            size_t offset = seq.Offset();
+            Group group{&ctrl_[offset]};
+            for (size_t i : group.Match(h2)) {
+                if (slots_[offset + i]->Equals(hash, key)) {
+                    return offset + i;
+                }
+            }
+            if (group.MatchEmpty()) {
+                return kNotFound;
+            }
+        }
+    }
+
+    /// @param hash the hash of the key to insert
+    /// @returns the index of the first empty or deleted slot in the probe sequence for @p hash.
+    size_t FindInsertionSlot(HashCode hash) const {
+        for (ProbeSeq seq(Mix(hash), ctrl_.Length());; seq.Next()) {
+            if (auto mask = Group{&ctrl_[seq.Offset()]}.MatchEmptyOrDeleted()) {
+                return seq.Offset() + mask.Lowest();
+            }
+        }
+    }
+
+    /// Places @p node in the table slot at @p index.
+    /// @param index the slot index returned by FindInsertionSlot()
+    /// @param hash the hash of the node's key
+    /// @param node the node holding the entry
+    void SetSlot(size_t index, HashCode hash, Node* node) {
+        if (ctrl_[index] == detail::kHashmapCtrlDeleted) {
+            deleted_--;
+        }
+        ctrl_[index] = H2(Mix(hash));
+        slots_[index] = node;
+    }
+
     /// Copies the hashmap @p other into this empty hashmap.
     /// @note This hashmap must be empty before calling
     /// @param other the hashmap to copy
     void Copy(const HashmapBase& other) {
-        Reserve(other.capacity_);
-        slots_.Resize(other.slots_.Length());
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            for (auto* o = other.slots_[slot_idx].nodes; o; o = o->next) {
-                auto* node = free_.Take();
-                new (&node->Entry()) Entry{o->Entry()};
-                slots_[slot_idx].Add(node);
-            }
+        Reserve(other.count_);
+        for (auto& entry : other) {
+            auto hash = Entry::KeyOf(entry).hash;
+            auto* node = free_.Take();
+            new (&node->Entry()) Entry{entry};
+            SetSlot(FindInsertionSlot(hash), hash, node);
         }
         count_ = other.count_;
     }
@@ -482,14 +754,12 @@ class HashmapBase {
     /// @note This hashmap must be empty before calling
     /// @param other the hashmap to move
     void Move(HashmapBase&& other) {
-        Reserve(other.capacity_);
-        slots_.Resize(other.slots_.Length());
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            for (auto* o = other.slots_[slot_idx].nodes; o; o = o->next) {
-                auto* node = free_.Take();
-                new (&node->Entry()) Entry{std::move(o->Entry())};
-                slots_[slot_idx].Add(node);
-            }
+        Reserve(other.count_);
+        for (auto& entry : other) {
+            auto hash = Entry::KeyOf(entry).hash;
+            auto* node = free_.Take();
+            new (&node->Entry()) Entry{std::move(entry)};
+            SetSlot(FindInsertionSlot(hash), hash, node);
         }
         count_ = other.count_;
         other.Clear();
@@ -500,8 +770,8 @@ class HashmapBase {
     struct EditIndex {
         /// The HashmapBase that created this EditIndex
         HashmapBase& map;
-        /// The slot that will hold the edit.
-        Slot& slot;
+        /// The table slot that will hold an inserted entry, if #entry is nullptr.
+        size_t index;
         /// The hash of the key, passed to EditAt().
         HashCode hash;
         /// The resolved node entry, or nullptr if EditAt() did not resolve to an existing entry.
@@ -517,7 +787,7 @@ class HashmapBase {
             *entry = Entry{Key{hash, std::forward<K>(key)}, std::forward<V>(values)...};
         }
 
-        /// Insert will create a new entry using @p key and @p values and insert it into the slot.
+        /// Insert will create a new entry using @p key and @p values and insert it into the table.
         /// The created entry will be assigned to #entry before returning.
         /// @note #entry must be null before calling.
         /// @note the key must not already exist in the map.
@@ -526,7 +796,7 @@ class HashmapBase {
         template <typename K, typename... V>
         void Insert(K&& key, V&&... values) {
             auto* node = map.free_.Take();
-            slot.Add(node);
+            map.SetSlot(index, hash, node);
             map.count_++;
             entry = &node->Entry();
             new (entry) Entry{Key{hash, std::forward<K>(key)}, std::forward<V>(values)...};
@@ -534,83 +804,49 @@ class HashmapBase {
     };
 
     /// EditAt is a helper for map entry replacement and entry insertion.
-    /// Before indexing, EditAt will ensure there's at least one free node available, potentially
-    /// allocating and rehashing if there's no free nodes available.
-    /// @param key the key used to compute the hash, look up the slot and search for the existing
-    /// node.
+    /// If the key is not found, EditAt will ensure there's at least one free node and one free
+    /// table slot available for the insertion, potentially allocating and rehashing.
+    /// @param key the key used to compute the hash and search for the existing entry.
     /// @returns a EditIndex used to modify or insert a new entry into the map with the given key.
     template <typename K>
     EditIndex EditAt(K&& key) {
+        HashCode hash = Hash{}(key);
+        if (size_t index = Find(hash, key); index != kNotFound) {
+            return {*this, index, hash, &slots_[index]->Entry()};
+        }
         if (!free_.nodes_) {
             free_.Allocate(capacity_);
             capacity_ += capacity_;
-            Rehash();
         }
-        HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        auto* entry = slot.Find(hash, key);
-        return {*this, slot, hash, entry};
+        if (count_ + deleted_ + 1 > MaxLoad(ctrl_.Length())) {
+            // Rehash in place if that frees enough tombstones, otherwise grow the table.
+            Rehash(NumSlots(count_ + 1) > ctrl_.Length() / 2 ? ctrl_.Length() * 2
+                                                              : ctrl_.Length());
+        }
+        return {*this, FindInsertionSlot(hash), hash, nullptr};
     }
 
-    /// Rehash resizes the slots vector proportionally to the map capacity, and then reinserts the
-    /// nodes so they're linked in the correct slots linked lists.
-    void Rehash() {
-        size_t num_slots = NumSlots(capacity_);
+    /// Rehash resizes the table to @p num_slots slots, and then reinserts the nodes so that they're
+    /// placed in their probe sequences, removing all tombstones.
+    /// @param num_slots the new number of table slots. Must be a power of two that is a multiple
+    /// of the group width.
+    void Rehash(size_t num_slots) {
+        decltype(ctrl_) old_ctrl;
         decltype(slots_) old_slots;
+        std::swap(ctrl_, old_ctrl);
         std::swap(slots_, old_slots);
-        slots_.Resize(num_slots);
-        for (size_t old_slot_idx = 0; old_slot_idx < old_slots.Length(); old_slot_idx++) {
-            auto* node = old_slots[old_slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                size_t new_slot_idx = node->Key().hash % num_slots;
-                slots_[new_slot_idx].Add(node);
-                node = next;
+        ctrl_.Resize(num_slots, detail::kHashmapCtrlEmpty);
+        slots_.Resize(num_slots, nullptr);
+        deleted_ = 0;
+        for (size_t i = 0; i < old_ctrl.Length(); i++) {
+            if (IsFull(old_ctrl[i])) {
+                Node* node = old_slots[i];
+                HashCode hash = node->Key().hash;
+                SetSlot(FindInsertionSlot(hash), hash, node);
             }
         }
     }
 
-    /// Slot holds a linked list of nodes. Nodes are assigned to the slot list by calculating the
-    /// modulo of the entry's hash with the slot_ vector length.
-    struct Slot {
-        /// The linked list of nodes in this slot.
-        Node* nodes = nullptr;
-
-        /// Add adds the node @p node to this slot.
-        /// @note The node must be unlinked from any existing list before calling.
-        /// @param node the node to add.
-        void Add(Node* node) {
-            node->next = nodes;
-            nodes = node;
-        }
-
-        /// @returns the node in the slot with the given hash and key.
-        /// @param hash the key hash to search for.
-        /// @param key the key value to search for.
-        template <typename K>
-        const Entry* Find(HashCode hash, K&& key) const {
-            for (auto* node = nodes; node; node = node->next) {
-                if (node->Equals(hash, key)) {
-                    return &node->Entry();
-                }
-            }
-            return nullptr;
-        }
-
-        /// @returns the node in the slot with the given hash and key.
-        /// @param hash the key hash to search for.
-        /// @param key the key value to search for.
-        template <typename K>
-        Entry* Find(HashCode hash, K&& key) {
-            for (auto* node = nodes; node; node = node->next) {
-                if (node->Equals(hash, key)) {
-                    return &node->Entry();
-                }
-            }
-            return nullptr;
-        }
-    };
-
     /// Free holds a linked list of nodes which are currently not used by entries in the map, and a
     /// linked list of node allocations.
     struct FreeNodes {
@@ -678,14 +914,19 @@ class HashmapBase {
     /// The fixed-size array of nodes, used for the first kMinCapacity entries of the map, before
     /// allocating from the heap.
     std::array<Node, kMinCapacity> fixed_;
-    /// The vector of slots. Each slot holds a linked list of nodes which hold entries in the map.
-    Vector<Slot, NumSlots(N)> slots_;
+    /// The control bytes of the table. Each control byte is either kHashmapCtrlEmpty,
+    /// kHashmapCtrlDeleted or the H2 hash of the entry held by the slot.
+    Vector<Ctrl, NumSlots(kMinCapacity)> ctrl_;
+    /// The nodes held by each of the table slots. Only valid for slots with a full control byte.
+    Vector<Node*, NumSlots(kMinCapacity)> slots_;
     /// The linked list of free nodes, and node allocations from the heap.
     FreeNodes free_;
     /// The total number of nodes, including free nodes (kMinCapacity + heap-allocated)
     size_t capacity_ = kMinCapacity;
     /// The total number of nodes that currently hold map entries.
     size_t count_ = 0;
+    /// The number of deleted (tombstone) slots in the table.
+    size_t deleted_ = 0;
 };
 
 }  // namespace tint
@@ -32,6 +32,8 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -319,6 +321,55 @@ TEST(Hashmap, AddMany) {
     }
 }
 
+/// Exposes the group that a hash is probed in first.
+class HashmapProbe : public Hashmap<const void*, int, 8> {
+  public:
+    static size_t FirstGroup(HashCode hash, size_t num_slots) {
+        return ProbeSeq(Mix(hash), num_slots).group;
+    }
+};
+
+TEST(Hashmap, StridedKeysSpreadOverGroups) {
+    constexpr size_t kNumSlots = 1024;
+    constexpr size_t kNumGroups = kNumSlots / detail::HashmapGroup::kWidth;
+    // With twice as many keys as groups, a uniform hash reaches about 86% of the groups.
+    constexpr size_t kNumKeys = kNumGroups * 2;
+    constexpr size_t kMinGroups = kNumGroups * 3 / 4;
+
+    // Pointers to objects of 64-byte allocations.
+    std::vector<std::array<std::byte, 64>> objects(kNumKeys);
+    std::unordered_set<size_t> pointer_groups;
+    for (auto& object : objects) {
+        pointer_groups.insert(
+            HashmapProbe::FirstGroup(Hasher<const void*>{}(&object), kNumSlots));
+    }
+    EXPECT_GE(pointer_groups.size(), kMinGroups);
+
+    // Integers with a common stride.
+    std::unordered_set<size_t> integer_groups;
+    for (size_t i = 0; i < kNumKeys; i++) {
+        integer_groups.insert(
+            HashmapProbe::FirstGroup(Hasher<int>{}(static_cast<int>(i * 256)), kNumSlots));
+    }
+    EXPECT_GE(integer_groups.size(), kMinGroups);
+}
+
+TEST(Hashmap, AddRemoveManyDistinctKeys) {
+    // Churns through many distinct keys while keeping the map small, so that removed entries leave
+    // deleted slots in the table that must be reclaimed.
+    Hashmap<int, int, 4> map;
+    for (int i = 0; i < 100000; i++) {
+        ASSERT_TRUE(map.Add(i, i)) << "i: " << i;
+        if (i >= 16) {
+            ASSERT_TRUE(map.Remove(i - 16)) << "i: " << i;
+        }
+    }
+    ASSERT_EQ(map.Count(), 16u);
+    for (int i = 0; i < 100000; i++) {
+        ASSERT_EQ(map.Contains(i), i >= 100000 - 16) << "i: " << i;
+    }
+}
+
 TEST(Hashmap, GetOrAdd) {
     Hashmap<int, std::string, 8> map;
     std::optional<std::string> value_of_key_0_at_create;
@@ -111,8 +111,8 @@ class Hashset : public HashmapBase<HashmapKey<KEY, HASH, EQUAL>, N> {
     /// @param key the key to search for.
     /// @returns the entry that is equal to @p key
     std::optional<KEY> Get(const KEY& key) const {
-        if (auto [found, index] = this->IndexOf(key); found) {
-            return this->slots_[index].entry;
+        if (auto* entry = this->GetEntry(key)) {
+            return entry->Value();
         }
         return std::nullopt;
     }
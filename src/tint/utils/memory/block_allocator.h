@@ -29,7 +29,9 @@
 #define SRC_TINT_UTILS_MEMORY_BLOCK_ALLOCATOR_H_
 
 #include <array>
+#include <cstdint>
 #include <cstring>
+#include <type_traits>
 #include <utility>
 
 #include "src/tint/utils/macros/compiler.h"
@@ -49,7 +51,10 @@ namespace tint {
 /// A container and allocator of objects of (or deriving from) the template type `T`.
 /// Objects are allocated by calling Create(), and are owned by the BlockAllocator.
 /// When the BlockAllocator is destructed, all constructed objects are automatically destructed and
-/// freed.
+/// freed. If `T` is trivially destructible, no destructors are called, and freeing the objects
+/// only requires releasing the memory blocks, making Reset() O(blocks) instead of O(objects).
+/// Objects can be released early with Reclaim(), after which their memory is reused by later calls
+/// to Create() for types of the same size.
 ///
 /// Objects held by the BlockAllocator can be iterated over using a View.
 template <typename T, size_t BLOCK_SIZE = 64 * 1024, size_t BLOCK_ALIGNMENT = 16>
@@ -60,6 +65,8 @@ class BlockAllocator {
     struct Pointers {
         static constexpr size_t kMax = 32;
         std::array<T*, kMax> ptrs = {};
+        /// The allocation size of each object in #ptrs, used by Reclaim() to recycle the memory.
+        std::array<uint32_t, kMax> sizes = {};
         Pointers* next = nullptr;
         Pointers* prev = nullptr;
         size_t count = 0;
@@ -74,6 +81,24 @@ class BlockAllocator {
         Block* next = nullptr;
     };
 
+    /// FreeSlot is written over the memory of a reclaimed allocation, forming a linked list of
+    /// allocations of the same size that can be reused.
+    struct FreeSlot {
+        FreeSlot* next = nullptr;
+    };
+
+    /// FreeLists holds the reclaimed allocations, bucketed by size.
+    /// FreeLists is allocated out of the block memory by the first call to Reclaim().
+    struct FreeLists {
+        static constexpr size_t kMaxSizes = 32;
+        struct List {
+            size_t size = 0;
+            FreeSlot* head = nullptr;
+        };
+        std::array<List, kMaxSizes> lists = {};
+        size_t count = 0;
+    };
+
     // Forward declaration
     template <bool IS_CONST>
     class TView;
@@ -158,6 +183,9 @@ class BlockAllocator {
     };
 
   public:
+    /// True if the BlockAllocator needs to call the destructor of each object on Reset().
+    static constexpr bool kDestructsObjects = !std::is_trivially_destructible_v<T>;
+
     /// A forward-iterator type over the objects of the BlockAllocator
     using Iterator = TIterator</* const */ false>;
 
@@ -213,16 +241,83 @@ class BlockAllocator {
 
         auto* ptr = Allocate<TYPE>();
         new (ptr) TYPE(std::forward<ARGS>(args)...);
-        AddObjectPointer(ptr);
+        AddObjectPointer(ptr, sizeof(TYPE));
         data.count++;
 
         return ptr;
     }
 
+    /// Destructs and frees each object for which `pred` returns true, removing it from the
+    /// allocator. The order of the remaining objects is preserved. The memory of the reclaimed
+    /// objects is reused by subsequent calls to Create() for types of the same size.
+    /// @warning Reclaim() invalidates all iterators, and leaves any pointer to a reclaimed object
+    /// dangling.
+    /// @param pred a function that takes a `T*` and returns true if the object should be reclaimed.
+    /// `pred` must only inspect the object it is given, as earlier objects may already have been
+    /// destructed.
+    /// @returns the number of reclaimed objects
+    template <typename PREDICATE>
+    size_t Reclaim(PREDICATE&& pred) {
+        size_t reclaimed = 0;
+
+        // Compact the surviving pointers towards the front of the pointers list.
+        Pointers* dst = data.pointers.root;
+        size_t dst_idx = 0;
+        for (Pointers* src = data.pointers.root; src != nullptr; src = src->next) {
+            for (size_t i = 0; i < src->count; i++) {
+                T* ptr = src->ptrs[i];
+                uint32_t size = src->sizes[i];
+                if (pred(ptr)) {
+                    if constexpr (kDestructsObjects) {
+                        ptr->~T();
+                    }
+                    Free(ptr, size);
+                    reclaimed++;
+                    continue;
+                }
+                if (dst_idx == Pointers::kMax) {
+                    dst->count = dst_idx;
+                    dst = dst->next;
+                    dst_idx = 0;
+                }
+                dst->ptrs[dst_idx] = ptr;
+                dst->sizes[dst_idx] = size;
+                dst_idx++;
+            }
+        }
+        if (reclaimed == 0) {
+            return 0;
+        }
+
+        // Release the Pointers that are no longer needed.
+        Pointers* unused = nullptr;
+        if (dst_idx == 0) {
+            // Everything was reclaimed. dst is the root.
+            unused = data.pointers.root;
+            data.pointers.root = nullptr;
+            data.pointers.current = nullptr;
+        } else {
+            dst->count = dst_idx;
+            unused = dst->next;
+            dst->next = nullptr;
+            data.pointers.current = dst;
+        }
+        while (unused != nullptr) {
+            auto* next = unused->next;
+            Free(unused, sizeof(Pointers));
+            unused = next;
+        }
+
+        data.count -= reclaimed;
+        return reclaimed;
+    }
+
     /// Frees all allocations from the allocator.
     void Reset() {
-        for (auto ptr : Objects()) {
-            ptr->~T();
+        if constexpr (kDestructsObjects) {
+            for (auto ptr : Objects()) {
+                ptr->~T();
+            }
         }
         auto* block = data.block.root;
         while (block != nullptr) {
@@ -233,7 +328,7 @@ class BlockAllocator {
         data = {};
     }
 
-    /// @returns the total number of allocated objects.
+    /// @returns the total number of objects owned by the allocator.
     size_t Count() const { return data.count; }
 
   private:
@@ -248,6 +343,12 @@ class BlockAllocator {
                       "Cannot construct TYPE with size greater than BLOCK_SIZE");
         static_assert(alignof(TYPE) <= BLOCK_ALIGNMENT, "alignof(TYPE) is greater than ALIGNMENT");
 
+        if (data.free != nullptr) {
+            if (auto* slot = TakeFreeSlot(sizeof(TYPE), alignof(TYPE))) {
+                return tint::Bitcast<TYPE*>(slot);
+            }
+        }
+
         auto& block = data.block;
 
         block.current_offset = tint::RoundUp(alignof(TYPE), block.current_offset);
@@ -273,9 +374,62 @@ class BlockAllocator {
         return ptr;
     }
 
+    /// Adds the memory at `ptr` of `size` bytes to the free lists, so that it can be reused by
+    /// Allocate(). Allocations too small or too misaligned to hold a FreeSlot are not reused.
+    /// @param ptr the start of the allocation
+    /// @param size the size of the allocation in bytes
+    void Free(void* ptr, size_t size) {
+        if (size < sizeof(FreeSlot) ||
+            tint::Bitcast<uintptr_t>(ptr) % alignof(FreeSlot) != 0) {
+            return;
+        }
+        if (data.free == nullptr) {
+            data.free = Allocate<FreeLists>();
+            if (!data.free) {
+                return;  // out of memory
+            }
+            new (data.free) FreeLists();
+        }
+        auto& free = *data.free;
+        for (size_t i = 0; i < free.count; i++) {
+            auto& list = free.lists[i];
+            if (list.size == size) {
+                list.head = new (ptr) FreeSlot{list.head};
+                return;
+            }
+        }
+        if (free.count < FreeLists::kMaxSizes) {
+            auto& list = free.lists[free.count++];
+            list.size = size;
+            list.head = new (ptr) FreeSlot{nullptr};
+        }
+    }
+
+    /// @returns a reclaimed allocation of exactly `size` bytes, aligned to `align`, or nullptr if
+    /// there is none.
+    /// @param size the size of the allocation in bytes
+    /// @param align the required alignment of the allocation
+    void* TakeFreeSlot(size_t size, size_t align) {
+        auto& free = *data.free;
+        for (size_t i = 0; i < free.count; i++) {
+            auto& list = free.lists[i];
+            if (list.size == size) {
+                FreeSlot* slot = list.head;
+                if (slot == nullptr || tint::Bitcast<uintptr_t>(slot) % align != 0) {
+                    return nullptr;
+                }
+                list.head = slot->next;
+                return slot;
+            }
+        }
+        return nullptr;
+    }
+
     /// Adds `ptr` to the linked list of objects owned by this BlockAllocator.
     /// Once added, `ptr` will be tracked for destruction when the BlockAllocator is destructed.
-    void AddObjectPointer(T* ptr) {
+    /// @param ptr the object
+    /// @param size the allocation size of the object
+    void AddObjectPointer(T* ptr, size_t size) {
         auto& pointers = data.pointers;
 
         if (!pointers.current || pointers.current->count == Pointers::kMax) {
@@ -295,7 +449,9 @@ class BlockAllocator {
             }
         }
 
-        pointers.current->ptrs[pointers.current->count++] = ptr;
+        pointers.current->ptrs[pointers.current->count] = ptr;
+        pointers.current->sizes[pointers.current->count] = static_cast<uint32_t>(size);
+        pointers.current->count++;
     }
 
     struct {
@@ -319,6 +475,9 @@ class BlockAllocator {
             Pointers* current = nullptr;
         } pointers;
 
+        /// The lists of reclaimed allocations, or nullptr if nothing has been reclaimed.
+        FreeLists* free = nullptr;
+
         size_t count = 0;
     } data;
 };
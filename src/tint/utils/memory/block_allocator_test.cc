@@ -27,6 +27,7 @@
 
 #include "src/tint/utils/memory/block_allocator.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -93,6 +94,35 @@ TEST_F(BlockAllocatorTest, ObjectLifetime) {
     EXPECT_EQ(count, 0u);
 }
 
+TEST_F(BlockAllocatorTest, TriviallyDestructibleReset) {
+    struct Point {
+        int x;
+        int y;
+    };
+    using Allocator = BlockAllocator<Point>;
+    static_assert(!Allocator::kDestructsObjects);
+    static_assert(BlockAllocator<LifetimeCounter>::kDestructsObjects);
+
+    Allocator allocator;
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 10000; i++) {
+            allocator.Create(i, -i);
+        }
+        EXPECT_EQ(allocator.Count(), 10000u);
+
+        int expected = 0;
+        for (auto* point : allocator.Objects()) {
+            EXPECT_EQ(point->x, expected);
+            EXPECT_EQ(point->y, -expected);
+            expected++;
+        }
+        EXPECT_EQ(expected, 10000);
+
+        allocator.Reset();
+        EXPECT_EQ(allocator.Count(), 0u);
+    }
+}
+
 TEST_F(BlockAllocatorTest, MoveConstruct) {
     using Allocator = BlockAllocator<LifetimeCounter>;
 
@@ -200,5 +230,110 @@ TEST_F(BlockAllocatorTest, AddWhileIterating) {
     }
 }
 
+TEST_F(BlockAllocatorTest, Reclaim) {
+    struct Counted : LifetimeCounter {
+        Counted(size_t* count, int v) : LifetimeCounter(count), value(v) {}
+        int value;
+    };
+    using Allocator = BlockAllocator<Counted>;
+
+    for (int n : {0, 1, 10, 31, 32, 33, 64, 100, 1000}) {
+        size_t count = 0;
+        {
+            Allocator allocator;
+            for (int i = 0; i < n; i++) {
+                allocator.Create(&count, i);
+            }
+
+            size_t reclaimed = allocator.Reclaim([](Counted* c) { return c->value % 3 != 0; });
+            size_t expected_count = static_cast<size_t>((n + 2) / 3);
+            EXPECT_EQ(reclaimed, static_cast<size_t>(n) - expected_count);
+            EXPECT_EQ(count, expected_count);
+            EXPECT_EQ(allocator.Count(), expected_count);
+
+            int expected = 0;
+            for (auto* c : allocator.Objects()) {
+                EXPECT_EQ(c->value, expected);
+                expected += 3;
+            }
+            EXPECT_EQ(expected, static_cast<int>(expected_count) * 3);
+
+            // The allocator must continue to add objects after the compacted list.
+            allocator.Create(&count, n);
+            EXPECT_EQ(allocator.Count(), expected_count + 1);
+            Counted* last = nullptr;
+            for (auto* c : allocator.Objects()) {
+                last = c;
+            }
+            ASSERT_NE(last, nullptr);
+            EXPECT_EQ(last->value, n);
+        }
+        EXPECT_EQ(count, 0u);
+    }
+}
+
+TEST_F(BlockAllocatorTest, ReclaimAll) {
+    using Allocator = BlockAllocator<LifetimeCounter>;
+
+    size_t count = 0;
+    Allocator allocator;
+    for (int i = 0; i < 100; i++) {
+        allocator.Create(&count);
+    }
+    EXPECT_EQ(allocator.Reclaim([](LifetimeCounter*) { return true; }), 100u);
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(allocator.Count(), 0u);
+    for (auto* c : allocator.Objects()) {
+        (void)c;
+        if ((true)) {  // Workaround for "error: loop will run at most once"
+            FAIL() << "BlockAllocator should be empty";
+        }
+    }
+
+    allocator.Create(&count);
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(allocator.Count(), 1u);
+}
+
+TEST_F(BlockAllocatorTest, ReclaimReusesMemory) {
+    struct Base {
+        virtual ~Base() = default;
+    };
+    struct Small : Base {
+        uint64_t a = 0;
+    };
+    struct Large : Base {
+        uint64_t a = 0;
+        uint64_t b = 0;
+        uint64_t c = 0;
+    };
+    using Allocator = BlockAllocator<Base>;
+
+    Allocator allocator;
+    std::vector<Base*> small;
+    for (int i = 0; i < 100; i++) {
+        small.push_back(allocator.Create<Small>());
+        allocator.Create<Large>();
+    }
+    allocator.Reclaim(
+        [&](Base* b) { return std::find(small.begin(), small.end(), b) != small.end(); });
+    EXPECT_EQ(allocator.Count(), 100u);
+
+    // Objects of a different size must not reuse the reclaimed memory.
+    for (int i = 0; i < 10; i++) {
+        Base* large = allocator.Create<Large>();
+        for (auto* s : small) {
+            EXPECT_NE(large, s);
+        }
+    }
+
+    // Objects of the same size reuse the reclaimed memory.
+    for (int i = 0; i < 100; i++) {
+        Base* s = allocator.Create<Small>();
+        EXPECT_NE(std::find(small.begin(), small.end(), s), small.end());
+    }
+    EXPECT_EQ(allocator.Count(), 210u);
+}
+
 }  // namespace
 }  // namespace tint
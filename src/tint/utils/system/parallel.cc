@@ -0,0 +1,152 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/utils/system/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace tint {
+namespace {
+
+/// Job holds the state of a ParallelFor() call, shared between the calling thread and the pool.
+struct Job {
+    /// Constructor
+    /// @param f the function to call with each index
+    /// @param n the number of indices
+    Job(const std::function<void(size_t)>& f, size_t n) : fn(f), count(n) {}
+
+    /// The function to call with each index
+    const std::function<void(size_t)>& fn;
+    /// The number of indices
+    const size_t count;
+    /// The next index to call #fn with
+    std::atomic<size_t> next{0};
+
+    /// Guards #completed
+    std::mutex mutex;
+    /// Signalled when #completed reaches #count
+    std::condition_variable done;
+    /// The number of calls to #fn that have returned
+    size_t completed = 0;
+
+    /// Calls #fn with indices that no other thread has claimed, until there are none left.
+    void Run() {
+        size_t calls = 0;
+        for (size_t i = next++; i < count; i = next++) {
+            fn(i);
+            calls++;
+        }
+        if (calls > 0) {
+            std::lock_guard lock(mutex);
+            completed += calls;
+            if (completed == count) {
+                done.notify_all();
+            }
+        }
+    }
+};
+
+/// ThreadPool is the set of threads shared by all the ParallelFor() calls of the process.
+/// Its `std::thread::hardware_concurrency() - 1` threads are started on first use, and live until
+/// the process exits.
+class ThreadPool {
+  public:
+    /// @returns the pool of the process
+    static ThreadPool& Get() {
+        // Leaked, as the threads wait on the pool until the process exits.
+        static ThreadPool* pool = new ThreadPool(std::thread::hardware_concurrency() - 1);
+        return *pool;
+    }
+
+    /// @returns the number of threads in the pool
+    size_t Size() const { return size_; }
+
+    /// Makes @p count threads of the pool help with @p job.
+    void Post(const std::shared_ptr<Job>& job, size_t count) {
+        {
+            std::lock_guard lock(mutex_);
+            queue_.insert(queue_.end(), count, job);
+        }
+        cv_.notify_all();
+    }
+
+  private:
+    explicit ThreadPool(size_t size) : size_(size) {
+        for (size_t i = 0; i < size_; i++) {
+            std::thread([this] { WorkerLoop(); }).detach();
+        }
+    }
+
+    void WorkerLoop() {
+        while (true) {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [&] { return !queue_.empty(); });
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            job->Run();
+        }
+    }
+
+    const size_t size_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::shared_ptr<Job>> queue_;
+};
+
+}  // namespace
+
+void ParallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    if (count <= 1 || std::thread::hardware_concurrency() <= 1) {
+        for (size_t i = 0; i < count; i++) {
+            fn(i);
+        }
+        return;
+    }
+
+    // The calling thread runs indices too, so the call completes even if all the threads of the
+    // pool are busy, including with the ParallelFor() call that made this one.
+    auto job = std::make_shared<Job>(fn, count);
+    auto& pool = ThreadPool::Get();
+    pool.Post(job, std::min(count - 1, pool.Size()));
+    job->Run();
+
+    // The pool threads that are still running indices hold a reference to the job, while the ones
+    // that pick it up later find no index left and never call `fn`.
+    std::unique_lock lock(job->mutex);
+    job->done.wait(lock, [&] { return job->completed == count; });
+}
+
+}  // namespace tint
@@ -0,0 +1,47 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_UTILS_SYSTEM_PARALLEL_H_
+#define SRC_TINT_UTILS_SYSTEM_PARALLEL_H_
+
+#include <cstddef>
+#include <functional>
+
+namespace tint {
+
+/// ParallelFor calls @p fn once for each index in `[0, count)`, distributing the calls between the
+/// calling thread and a pool of `std::thread::hardware_concurrency() - 1` threads. The pool is
+/// shared by all the calls of the process, and its threads are started by the first call and are
+/// never stopped. ParallelFor returns once all the calls have completed, and may be called
+/// concurrently, including from @p fn.
+/// @param count the number of times to call @p fn
+/// @param fn the function to call. Must be safe to call concurrently with different indices.
+void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+}  // namespace tint
+
+#endif  // SRC_TINT_UTILS_SYSTEM_PARALLEL_H_